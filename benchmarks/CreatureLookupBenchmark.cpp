@@ -0,0 +1,89 @@
+// file: CreatureLookupBenchmark.cpp
+// Compares the old linear creature scan against CreatureManager's occupancy
+// index for the "who stands here?" query issued by Map::get_actor.
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../src/Actor/Creature.h"
+#include "../src/Combat/HealthPool.h"
+#include "../src/Systems/CreatureManager.h"
+#include "../src/Utils/Vector2D.h"
+
+namespace
+{
+	constexpr int MAP_WIDTH = 120;
+	constexpr int MAP_HEIGHT = 80;
+
+	struct CreatureField
+	{
+		std::vector<std::unique_ptr<Creature>> creatures;
+		std::vector<Vector2D> queries;
+	};
+
+	CreatureField make_field(int count)
+	{
+		CreatureField field;
+		std::mt19937 rng(1234);
+		std::uniform_int_distribution<int> xDist(0, MAP_WIDTH - 1);
+		std::uniform_int_distribution<int> yDist(0, MAP_HEIGHT - 1);
+
+		for (int i = 0; i < count; ++i)
+		{
+			auto creature = std::make_unique<Creature>(Vector2D{ xDist(rng), yDist(rng) }, ActorData{});
+			creature->healthPool = std::make_unique<HealthPool>(5);
+			field.creatures.push_back(std::move(creature));
+		}
+
+		// Mix of hits and misses, like the neighbour probes of A* and AI
+		for (int i = 0; i < 1024; ++i)
+		{
+			field.queries.push_back(Vector2D{ xDist(rng), yDist(rng) });
+		}
+
+		return field;
+	}
+
+	// The lookup Map::get_actor performed before the occupancy index.
+	Creature* linear_lookup(const std::vector<std::unique_ptr<Creature>>& creatures, Vector2D pos)
+	{
+		for (const auto& creature : creatures)
+		{
+			if (creature && creature->position == pos && !creature->is_dead())
+			{
+				return creature.get();
+			}
+		}
+		return nullptr;
+	}
+}
+
+static void BM_CreatureLookup_LinearScan(benchmark::State& state)
+{
+	CreatureField field = make_field(static_cast<int>(state.range(0)));
+	size_t i = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(linear_lookup(field.creatures, field.queries[i++ & 1023]));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CreatureLookup_LinearScan)->Arg(10)->Arg(100)->Arg(1000);
+
+static void BM_CreatureLookup_Occupancy(benchmark::State& state)
+{
+	CreatureField field = make_field(static_cast<int>(state.range(0)));
+	CreatureManager manager;
+	manager.bind_occupancy(MAP_WIDTH, MAP_HEIGHT);
+	size_t i = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(manager.get_actor_at_position(field.creatures, field.queries[i++ & 1023]));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CreatureLookup_Occupancy)->Arg(10)->Arg(100)->Arg(1000);
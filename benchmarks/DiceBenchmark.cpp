@@ -0,0 +1,75 @@
+// file: DiceBenchmark.cpp
+// RandomDice rolls against the std::mt19937 + uniform_int_distribution
+// pair it used to wrap, one at a time and in bulk.
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "../src/Random/RandomDice.h"
+
+namespace
+{
+	constexpr int BULK_ROLLS = 1024;
+}
+
+static void BM_Dice_Mt19937Roll(benchmark::State& state)
+{
+	std::mt19937 gen(42);
+	for (auto _ : state)
+	{
+		std::uniform_int_distribution<int> dist(1, 20);
+		benchmark::DoNotOptimize(dist(gen));
+	}
+}
+BENCHMARK(BM_Dice_Mt19937Roll);
+
+static void BM_Dice_Roll(benchmark::State& state)
+{
+	RandomDice dice{ 42 };
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(dice.combat().d20());
+	}
+}
+BENCHMARK(BM_Dice_Roll);
+
+static void BM_Dice_RollLoop(benchmark::State& state)
+{
+	RandomDice dice{ 42 };
+	std::vector<int> out(BULK_ROLLS);
+	for (auto _ : state)
+	{
+		for (int& value : out)
+		{
+			value = dice.roll(1, 20);
+		}
+		benchmark::DoNotOptimize(out.data());
+	}
+	state.SetItemsProcessed(state.iterations() * BULK_ROLLS);
+}
+BENCHMARK(BM_Dice_RollLoop);
+
+static void BM_Dice_RollMany(benchmark::State& state)
+{
+	RandomDice dice{ 42 };
+	std::vector<int> out(BULK_ROLLS);
+	for (auto _ : state)
+	{
+		dice.roll_many(out, 1, 20);
+		benchmark::DoNotOptimize(out.data());
+	}
+	state.SetItemsProcessed(state.iterations() * BULK_ROLLS);
+}
+BENCHMARK(BM_Dice_RollMany);
+
+static void BM_Dice_Expression(benchmark::State& state)
+{
+	RandomDice dice{ 42 };
+	const DiceExpr expr{ 3, 6, 2 };
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(dice.roll(expr));
+	}
+}
+BENCHMARK(BM_Dice_Expression);
@@ -0,0 +1,364 @@
+// file: DungeonBenchmark.cpp
+// The hot paths of a turn measured on dungeons the game itself generates
+// (GeneratedDungeon, fixed seeds) instead of synthetic grids: generation,
+// FOV while walking a real route, the player flow field, A* and Jump Point
+// queries, the creature lookups AI and movement issue, map save and load,
+// a melee exchange and item creation. Benchmarks take the map size and,
+// where creatures matter, the creature count as arguments.
+//
+// Run from the repository root so the game data resolves; the
+// benchmark_run target does, and writes the results as JSON.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../src/Actor/Attacker.h"
+#include "../src/Actor/Creature.h"
+#include "../src/Actor/Item.h"
+#include "../src/Combat/HealthPool.h"
+#include "../src/Factories/ItemCreator.h"
+#include "../src/Factories/MonsterCreator.h"
+#include "../src/Game.h"
+#include "../src/Map/LevelGenerator.h"
+#include "../src/Map/Map.h"
+#include "../src/Persistent/BinaryStream.h"
+#include "../src/Persistent/SaveFile.h"
+#include "../src/Systems/MessageSystem.h"
+#include "../src/Utils/Dijkstra.h"
+#include "../src/Utils/Vector2D.h"
+#include "GeneratedDungeon.h"
+
+namespace
+{
+	constexpr int QUERY_COUNT = 64;
+	constexpr int PROBE_COUNT = 1024; // power of two, indexed with a mask
+	constexpr int COMBAT_HP = 1000; // restored before every blow so nobody dies
+	constexpr int MESSAGE_FLUSH_INTERVAL = 4096; // combat logs pile up otherwise
+
+	constexpr int DEFAULT_CREATURES = 10;
+
+	// Builds the dungeon for state's (width, height) arguments, or marks the
+	// benchmark skipped and returns null.
+	std::unique_ptr<GeneratedDungeon> make_dungeon(benchmark::State& state, int creatures = DEFAULT_CREATURES)
+	{
+		if (!GeneratedDungeon::load_data())
+		{
+			state.SkipWithError("game data not found; run from the repository root");
+			return nullptr;
+		}
+		try
+		{
+			const int width = static_cast<int>(state.range(0));
+			const int height = static_cast<int>(state.range(1));
+			return std::make_unique<GeneratedDungeon>(width, height, creatures);
+		}
+		catch (const std::exception& e)
+		{
+			state.SkipWithError(e.what());
+			return nullptr;
+		}
+	}
+
+	// Start and goal floor tiles, the mouse-click travel the player issues.
+	std::vector<std::pair<Vector2D, Vector2D>> make_queries(const GeneratedDungeon& dungeon)
+	{
+		const std::vector<Vector2D> starts = dungeon.sample_floor(QUERY_COUNT, 11);
+		const std::vector<Vector2D> goals = dungeon.sample_floor(QUERY_COUNT, 23);
+		std::vector<std::pair<Vector2D, Vector2D>> queries;
+		for (size_t i = 0; i < starts.size(); ++i)
+		{
+			queries.emplace_back(starts[i], goals[i]);
+		}
+		return queries;
+	}
+
+	// The longest of the query paths: a route the player could walk.
+	std::vector<Vector2D> make_route(GeneratedDungeon& dungeon)
+	{
+		GameContext& ctx = dungeon.get_context();
+		std::vector<Vector2D> route;
+		std::vector<Vector2D> path;
+		for (const auto& [start, goal] : make_queries(dungeon))
+		{
+			if (ctx.pathfinder->find_path(*ctx.map, start, goal, PathAlgorithm::ASTAR, ctx, path) && path.size() > route.size())
+			{
+				route = path;
+			}
+		}
+		return route;
+	}
+
+	void run_path_queries(benchmark::State& state, PathAlgorithm algorithm)
+	{
+		auto dungeon = make_dungeon(state, static_cast<int>(state.range(2)));
+		if (!dungeon)
+		{
+			return;
+		}
+		GameContext& ctx = dungeon->get_context();
+		const auto queries = make_queries(*dungeon);
+		std::vector<Vector2D> path;
+		int64_t expanded = 0;
+		size_t i = 0;
+
+		for (auto _ : state)
+		{
+			const auto& [start, goal] = queries[i++ % queries.size()];
+			benchmark::DoNotOptimize(ctx.pathfinder->find_path(*ctx.map, start, goal, algorithm, ctx, path));
+			expanded += ctx.pathfinder->get_expanded_count();
+		}
+		state.counters["expanded"] = benchmark::Counter(static_cast<double>(expanded), benchmark::Counter::kAvgIterations);
+	}
+
+	// Keeps one side of a melee exchange alive and the message log bounded.
+	void run_melee(benchmark::State& state, Creature& attacker, Creature& target, GeneratedDungeon& dungeon)
+	{
+		GameContext& ctx = dungeon.get_context();
+		std::unique_ptr<MessageSystem> messages;
+		int64_t blows = 0;
+		for (auto _ : state)
+		{
+			target.healthPool->set_hp(COMBAT_HP);
+			attacker.attacker->attack(target, ctx);
+			if (++blows % MESSAGE_FLUSH_INTERVAL == 0)
+			{
+				state.PauseTiming();
+				messages = std::make_unique<MessageSystem>();
+				ctx.messageSystem = messages.get();
+				state.ResumeTiming();
+			}
+		}
+		state.SetItemsProcessed(state.iterations());
+		ctx.messageSystem = &dungeon.get_game().messageSystem;
+	}
+}
+
+static void BM_Dungeon_Generate(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state);
+	if (!dungeon)
+	{
+		return;
+	}
+	LevelRequest request = LevelGenerator::make_request(dungeon->get_context(), 1, GeneratedDungeon::DEFAULT_SEED);
+	request.width = static_cast<int>(state.range(0));
+	request.height = static_cast<int>(state.range(1));
+	size_t rooms = 0;
+	size_t creatures = 0;
+
+	for (auto _ : state)
+	{
+		const std::unique_ptr<GeneratedLevel> level = LevelGenerator::generate(request);
+		rooms = level->rooms.size();
+		creatures = level->creatures.size();
+		benchmark::DoNotOptimize(level.get());
+	}
+	state.counters["rooms"] = static_cast<double>(rooms);
+	state.counters["creatures"] = static_cast<double>(creatures);
+}
+BENCHMARK(BM_Dungeon_Generate)->Args({ 120, 80 })->Args({ 240, 160 })->Unit(benchmark::kMillisecond);
+
+// Map::compute_fov as the player steps along a route: FovMap::compute_fov
+// plus the flow field repair that follows it.
+static void BM_Dungeon_ComputeFov(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state);
+	if (!dungeon)
+	{
+		return;
+	}
+	GameContext& ctx = dungeon->get_context();
+	const std::vector<Vector2D> route = make_route(*dungeon);
+	if (route.empty())
+	{
+		state.SkipWithError("no route through the dungeon");
+		return;
+	}
+	size_t step = 0;
+
+	for (auto _ : state)
+	{
+		// Walk the route out and back so every step is a single tile.
+		const size_t leg = step++ % (2 * route.size());
+		ctx.player->position = route[leg < route.size() ? leg : 2 * route.size() - 1 - leg];
+		ctx.map->compute_fov(ctx);
+	}
+	state.counters["route"] = static_cast<double>(route.size());
+}
+BENCHMARK(BM_Dungeon_ComputeFov)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_Dungeon_FlowRebuild(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state);
+	if (!dungeon)
+	{
+		return;
+	}
+	Map& map = *dungeon->get_context().map;
+	const std::vector<Vector2D> goals = dungeon->sample_floor(QUERY_COUNT, 5);
+	size_t i = 0;
+
+	for (auto _ : state)
+	{
+		const Vector2D goal[]{ goals[i++ % goals.size()] };
+		map.rebuild_dijkstra_map(goal);
+		benchmark::DoNotOptimize(map.get_dijkstra_cost(goal[0]));
+	}
+	state.counters["floor"] = static_cast<double>(dungeon->get_floor().size());
+}
+BENCHMARK(BM_Dungeon_FlowRebuild)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_Dungeon_AStar(benchmark::State& state)
+{
+	run_path_queries(state, PathAlgorithm::ASTAR);
+}
+BENCHMARK(BM_Dungeon_AStar)->Args({ 120, 80, 10 })->Args({ 120, 80, 200 })->Args({ 240, 160, 10 })->Args({ 240, 160, 200 });
+
+static void BM_Dungeon_JumpPoint(benchmark::State& state)
+{
+	run_path_queries(state, PathAlgorithm::JUMP_POINT);
+}
+BENCHMARK(BM_Dungeon_JumpPoint)->Args({ 120, 80, 10 })->Args({ 120, 80, 200 })->Args({ 240, 160, 10 })->Args({ 240, 160, 200 });
+
+static void BM_Dungeon_GetActor(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state, static_cast<int>(state.range(2)));
+	if (!dungeon)
+	{
+		return;
+	}
+	const GameContext& ctx = dungeon->get_context();
+	const std::vector<Vector2D> probes = dungeon->sample_floor(PROBE_COUNT, 3);
+	size_t i = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ctx.map->get_actor(probes[i++ & (PROBE_COUNT - 1)], ctx));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Dungeon_GetActor)->Args({ 120, 80, 10 })->Args({ 120, 80, 100 })->Args({ 120, 80, 1000 })->Args({ 240, 160, 1000 });
+
+static void BM_Dungeon_CanWalk(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state, static_cast<int>(state.range(2)));
+	if (!dungeon)
+	{
+		return;
+	}
+	const GameContext& ctx = dungeon->get_context();
+	const std::vector<Vector2D> probes = dungeon->sample_floor(PROBE_COUNT, 3);
+	size_t i = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ctx.map->can_walk(probes[i++ & (PROBE_COUNT - 1)], ctx));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Dungeon_CanWalk)->Args({ 120, 80, 10 })->Args({ 120, 80, 100 })->Args({ 120, 80, 1000 })->Args({ 240, 160, 1000 });
+
+static void BM_Dungeon_SaveMap(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state);
+	if (!dungeon)
+	{
+		return;
+	}
+	const Map& map = *dungeon->get_context().map;
+	size_t bytes = 0;
+
+	for (auto _ : state)
+	{
+		BinaryWriter out;
+		map.save(out);
+		bytes = out.data().size();
+		benchmark::DoNotOptimize(out.data().data());
+	}
+	state.counters["bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_Dungeon_SaveMap)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_Dungeon_LoadMap(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state);
+	if (!dungeon)
+	{
+		return;
+	}
+	BinaryWriter out;
+	dungeon->get_context().map->save(out);
+	const std::vector<uint8_t> saved(out.data().begin(), out.data().end());
+	Map loaded(1, 1);
+
+	for (auto _ : state)
+	{
+		BinaryReader in(saved);
+		loaded.load(in, SaveWriter::VERSION);
+		benchmark::ClobberMemory();
+	}
+	state.counters["bytes"] = static_cast<double>(saved.size());
+}
+BENCHMARK(BM_Dungeon_LoadMap)->Args({ 120, 80 })->Args({ 240, 160 });
+
+// A goblin beside the player trading blows: to-hit and damage rolls,
+// armour, the combat log.
+static void BM_Combat_MonsterAttack(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state);
+	if (!dungeon)
+	{
+		return;
+	}
+	GameContext& ctx = dungeon->get_context();
+	const auto goblin = MonsterCreator::create(ctx.player->position, MonsterId::GOBLIN, ctx);
+	run_melee(state, *goblin, *ctx.player, *dungeon);
+}
+BENCHMARK(BM_Combat_MonsterAttack)->Args({ 120, 80 });
+
+static void BM_Combat_PlayerAttack(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state);
+	if (!dungeon)
+	{
+		return;
+	}
+	GameContext& ctx = dungeon->get_context();
+	const auto goblin = MonsterCreator::create(ctx.player->position, MonsterId::GOBLIN, ctx);
+	run_melee(state, *ctx.player, *goblin, *dungeon);
+}
+BENCHMARK(BM_Combat_PlayerAttack)->Args({ 120, 80 });
+
+// Every item key in turn, as loot and shop stock are rolled.
+static void BM_Items_Create(benchmark::State& state)
+{
+	auto dungeon = make_dungeon(state);
+	if (!dungeon)
+	{
+		return;
+	}
+	ContentRegistry& registry = dungeon->get_game().contentRegistry;
+	const std::vector<std::string> keys = ItemCreator::get_all_keys();
+	if (keys.empty())
+	{
+		state.SkipWithError("no item definitions loaded");
+		return;
+	}
+	const Vector2D pos = dungeon->get_context().player->position;
+	size_t i = 0;
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(ItemCreator::create(keys[i++ % keys.size()], pos, registry));
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.counters["keys"] = static_cast<double>(keys.size());
+}
+BENCHMARK(BM_Items_Create)->Args({ 120, 80 });
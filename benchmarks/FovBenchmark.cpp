@@ -0,0 +1,59 @@
+// file: FovBenchmark.cpp
+// FovMap::compute_fov with the recursive reference engine versus the
+// iterative integer-slope engine, across light radii.
+
+#include <benchmark/benchmark.h>
+#include <random>
+
+#include "../src/Map/FovMap.h"
+
+namespace
+{
+	constexpr int FOV_MAP_WIDTH = 240;
+	constexpr int FOV_MAP_HEIGHT = 160;
+
+	// Mostly open cave with scattered pillars so shadows split the scan.
+	FovMap make_fov_map(FovAlgorithm algorithm)
+	{
+		FovMap fov{ FOV_MAP_WIDTH, FOV_MAP_HEIGHT };
+		fov.set_algorithm(algorithm);
+		std::mt19937 rng(7);
+		for (int y = 0; y < FOV_MAP_HEIGHT; ++y)
+		{
+			for (int x = 0; x < FOV_MAP_WIDTH; ++x)
+			{
+				const bool open = rng() % 100 >= 12;
+				fov.set_properties(x, y, open, open);
+			}
+		}
+		return fov;
+	}
+
+	void run_fov(benchmark::State& state, FovAlgorithm algorithm)
+	{
+		FovMap fov = make_fov_map(algorithm);
+		const int radius = static_cast<int>(state.range(0));
+		const int cx = FOV_MAP_WIDTH / 2;
+		const int cy = FOV_MAP_HEIGHT / 2;
+		fov.set_properties(cx, cy, true, true);
+
+		for (auto _ : state)
+		{
+			fov.compute_fov(cx, cy, radius);
+			benchmark::DoNotOptimize(fov.visible_cells().data());
+		}
+		state.counters["visible"] = static_cast<double>(fov.visible_cells().size());
+	}
+}
+
+static void BM_Fov_Recursive(benchmark::State& state)
+{
+	run_fov(state, FovAlgorithm::RECURSIVE);
+}
+BENCHMARK(BM_Fov_Recursive)->Arg(4)->Arg(12)->Arg(40);
+
+static void BM_Fov_Iterative(benchmark::State& state)
+{
+	run_fov(state, FovAlgorithm::ITERATIVE);
+}
+BENCHMARK(BM_Fov_Iterative)->Arg(4)->Arg(12)->Arg(40);
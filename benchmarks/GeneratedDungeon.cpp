@@ -0,0 +1,169 @@
+// GeneratedDungeon.cpp -- a real generated dungeon for the benchmarks.
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../src/Actor/Creature.h"
+#include "../src/Actor/Stairs.h"
+#include "../src/Core/Paths.h"
+#include "../src/Factories/ItemCreator.h"
+#include "../src/Factories/MonsterCreator.h"
+#include "../src/Game.h"
+#include "../src/Map/LevelGenerator.h"
+#include "../src/Map/Map.h"
+#include "../src/Random/RandomDice.h"
+#include "../src/Systems/CreatureManager.h"
+#include "../src/Systems/Logger.h"
+#include "../src/Systems/SpellSystem.h"
+#include "GeneratedDungeon.h"
+
+namespace
+{
+	// Monsters the top-up cycles through; class-based creatures are left out
+	// because MonsterCreator::create does not build them.
+	constexpr MonsterId TOP_UP_MONSTERS[]{
+		MonsterId::GOBLIN,
+		MonsterId::ORC,
+		MonsterId::KOBOLD,
+		MonsterId::WOLF,
+		MonsterId::ARCHER,
+		MonsterId::BAT,
+		MonsterId::MAGE,
+		MonsterId::TROLL,
+	};
+}
+
+bool GeneratedDungeon::load_data()
+{
+	static const bool loaded = []
+	{
+		// Game messages log at debug level and would dominate the timings.
+		Logger::instance().set_level(LogLevel::LOG_WARN);
+		try
+		{
+			MonsterCreator::load(Paths::MONSTERS);
+			SpellSystem::load(Paths::SPELLS);
+			ItemCreator::load(Paths::ITEMS);
+			ItemCreator::load_enhanced_rules(Paths::ENHANCED_RULES);
+			return true;
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+	}();
+	return loaded;
+}
+
+GeneratedDungeon::GeneratedDungeon(int width, int height, int creatureCount, long seed)
+	: game(std::make_unique<Game>()), pathfinder(width, height)
+{
+	game->tileConfig.load(Paths::TILE_CONFIG);
+	game->prefabLibrary.load(Paths::PREFABS);
+	game->init_world();
+	game->dice = RandomDice{ static_cast<unsigned int>(seed) };
+	game->playerBlueprint.playerClass = "Fighter";
+	game->playerBlueprint.playerRace = "Human";
+
+	// Nothing is drawn: leave the animation systems out, as the headless runner does.
+	const auto windowless_context = [this]
+	{
+		GameContext context = game->context();
+		context.animSystem = nullptr;
+		context.floatingText = nullptr;
+		context.minimap = nullptr;
+		return context;
+	};
+
+	GameContext setup = windowless_context();
+	game->stateManager.init_new_game(setup);
+	game->gameState.set_should_save(false);
+
+	ctx = windowless_context(); // init_new_game replaced the player
+	ctx.pathfinder = &pathfinder;
+
+	LevelRequest request = LevelGenerator::make_request(ctx, 1, seed);
+	request.width = width;
+	request.height = height;
+	std::unique_ptr<GeneratedLevel> level = LevelGenerator::generate(request);
+	LevelGenerator::commit(*level, ctx);
+
+	// Doors opened, as the player leaves them: closed ones would cut most
+	// path queries off at the first room.
+	Map& map = *ctx.map;
+	for (int y = 0; y < map.get_height(); ++y)
+	{
+		for (int x = 0; x < map.get_width(); ++x)
+		{
+			const Vector2D pos{ x, y };
+			const TileType type = map.get_tile_type(pos);
+			if (type == TileType::CLOSED_DOOR)
+			{
+				map.unlock_door(pos, ctx);
+				map.open_door(pos, ctx);
+			}
+			else if (type == TileType::FLOOR || type == TileType::CORRIDOR)
+			{
+				floor.push_back(pos);
+			}
+		}
+	}
+
+	set_creature_count(creatureCount, seed);
+	ctx.map->compute_fov(ctx);
+}
+
+GeneratedDungeon::~GeneratedDungeon() = default;
+
+void GeneratedDungeon::set_creature_count(int creatureCount, long seed)
+{
+	auto& creatures = *ctx.creatures;
+	const size_t target = static_cast<size_t>(std::max(creatureCount, 0));
+	if (creatures.size() > target)
+	{
+		creatures.resize(target);
+	}
+	ctx.creatureManager->bind_occupancy(ctx.map->get_width(), ctx.map->get_height());
+
+	std::vector<Vector2D> spots = floor;
+	std::mt19937 rng(static_cast<unsigned int>(seed));
+	std::ranges::shuffle(spots, rng);
+
+	size_t kind = 0;
+	for (const Vector2D spot : spots)
+	{
+		if (creatures.size() >= target)
+		{
+			break;
+		}
+		if (spot == ctx.player->position || spot == ctx.stairs->position || ctx.map->get_actor(spot, ctx))
+		{
+			continue;
+		}
+		auto monster = MonsterCreator::create(spot, TOP_UP_MONSTERS[kind++ % std::size(TOP_UP_MONSTERS)], ctx);
+		if (monster)
+		{
+			creatures.push_back(std::move(monster));
+		}
+	}
+}
+
+std::vector<Vector2D> GeneratedDungeon::sample_floor(int count, unsigned int seed) const
+{
+	std::vector<Vector2D> sample;
+	if (floor.empty())
+	{
+		return sample;
+	}
+	std::mt19937 rng(seed);
+	std::uniform_int_distribution<size_t> pick(0, floor.size() - 1);
+	sample.reserve(static_cast<size_t>(count));
+	for (int i = 0; i < count; ++i)
+	{
+		sample.push_back(floor[pick(rng)]);
+	}
+	return sample;
+}
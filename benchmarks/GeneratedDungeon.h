@@ -0,0 +1,56 @@
+#pragma once
+// GeneratedDungeon.h -- a real generated dungeon for the benchmarks.
+
+#include <memory>
+#include <vector>
+
+#include "../src/Core/GameContext.h"
+#include "../src/Utils/Dijkstra.h"
+#include "../src/Utils/Vector2D.h"
+
+struct Game;
+
+// ---------------------------------------------------------------------------
+// GeneratedDungeon -- a Game with a new Fighter standing in a level built by
+// LevelGenerator from a fixed seed at the requested size, so the numbers
+// come from the rooms, corridors, doors and water the player walks through
+// rather than a synthetic grid. Every door is opened, and the creature list
+// is trimmed or topped up with MonsterCreator monsters on free floor tiles
+// to the requested count.
+// The same arguments always build the same dungeon.
+//
+// The game data is read from the working directory: run benchmark_exe from
+// the repository root (the benchmark_run target does). Benchmarks skip
+// with an error when it is missing.
+// ---------------------------------------------------------------------------
+class GeneratedDungeon
+{
+public:
+	static constexpr long DEFAULT_SEED = 20240611;
+
+	GeneratedDungeon(int width, int height, int creatureCount, long seed = DEFAULT_SEED);
+	~GeneratedDungeon();
+	GeneratedDungeon(const GeneratedDungeon&) = delete;
+	GeneratedDungeon& operator=(const GeneratedDungeon&) = delete;
+
+	// Loads monsters, spells and items once per process; false if the data
+	// files could not be read.
+	[[nodiscard]] static bool load_data();
+
+	[[nodiscard]] Game& get_game() noexcept { return *game; }
+	[[nodiscard]] GameContext& get_context() noexcept { return ctx; }
+
+	// Floor and corridor tiles in scan order.
+	[[nodiscard]] const std::vector<Vector2D>& get_floor() const noexcept { return floor; }
+
+	// count floor tiles drawn from a fixed sequence, repeats allowed.
+	[[nodiscard]] std::vector<Vector2D> sample_floor(int count, unsigned int seed) const;
+
+private:
+	std::unique_ptr<Game> game;
+	Dijkstra pathfinder; // sized to the generated map, unlike Game's
+	GameContext ctx{};
+	std::vector<Vector2D> floor;
+
+	void set_creature_count(int creatureCount, long seed);
+};
@@ -0,0 +1,327 @@
+// file: PathfindingBenchmark.cpp
+// Mouse-click style A* queries over room-and-corridor dungeons: the original
+// fill-every-search, double-cost, heap-based search versus the reusable
+// integer-cost engine in Dijkstra::find_path, with and without Jump Point
+// Search pruning. Also the player flow field compute_fov maintains: a full
+// rebuild per step, and a door toggled beside a standing player, rebuilt
+// versus repaired.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "../src/Actor/Creature.h"
+#include "../src/Core/GameContext.h"
+#include "../src/Map/Map.h"
+#include "../src/Utils/Dijkstra.h"
+#include "../src/Utils/Vector2D.h"
+
+namespace
+{
+	constexpr int QUERY_COUNT = 64;
+
+	struct DungeonFixture
+	{
+		std::unique_ptr<Map> map;
+		std::vector<std::unique_ptr<Creature>> creatures;
+		GameContext ctx;
+		std::vector<std::pair<Vector2D, Vector2D>> queries;
+	};
+
+	void carve(Map& map, int x1, int y1, int x2, int y2)
+	{
+		for (int y = std::min(y1, y2); y <= std::max(y1, y2); ++y)
+		{
+			for (int x = std::min(x1, x2); x <= std::max(x1, x2); ++x)
+			{
+				map.set_tile(Vector2D{ x, y }, TileType::FLOOR, 1);
+			}
+		}
+	}
+
+	// Grid-cell rooms chained by L-shaped corridors, with a few water pools,
+	// roughly the shape DungeonGenerator produces.
+	std::unique_ptr<DungeonFixture> make_dungeon(int width, int height)
+	{
+		auto fixture = std::make_unique<DungeonFixture>();
+		fixture->map = std::make_unique<Map>(width, height);
+		Map& map = *fixture->map;
+		map.init_tiles();
+		fixture->ctx.map = &map;
+		fixture->ctx.creatures = &fixture->creatures;
+
+		std::mt19937 rng(static_cast<unsigned int>(width * 31 + height));
+		constexpr int CELL = 16;
+		std::vector<Vector2D> centres;
+		std::vector<Vector2D> floor;
+		for (int cy = 0; cy + CELL <= height; cy += CELL)
+		{
+			for (int cx = 0; cx + CELL <= width; cx += CELL)
+			{
+				const int w = 4 + static_cast<int>(rng() % 9);
+				const int h = 3 + static_cast<int>(rng() % 8);
+				const int x = cx + 1 + static_cast<int>(rng() % (CELL - w - 1));
+				const int y = cy + 1 + static_cast<int>(rng() % (CELL - h - 1));
+				carve(map, x, y, x + w - 1, y + h - 1);
+				if (rng() % 4 == 0)
+				{
+					map.set_tile(Vector2D{ x + w / 2, y + h / 2 }, TileType::WATER, 10);
+				}
+				centres.push_back(Vector2D{ x + w / 2, y + h / 2 });
+				floor.push_back(Vector2D{ x, y });
+				floor.push_back(Vector2D{ x + w - 1, y + h - 1 });
+			}
+		}
+
+		for (size_t i = 1; i < centres.size(); ++i)
+		{
+			const Vector2D a = centres[i - 1];
+			const Vector2D b = centres[i];
+			carve(map, a.x, a.y, b.x, a.y);
+			carve(map, b.x, a.y, b.x, b.y);
+		}
+
+		std::uniform_int_distribution<size_t> pick(0, floor.size() - 1);
+		for (int i = 0; i < QUERY_COUNT; ++i)
+		{
+			fixture->queries.emplace_back(floor[pick(rng)], floor[pick(rng)]);
+		}
+		return fixture;
+	}
+
+	// One open hall with scattered pillars and queries from corner to
+	// corner -- the long auto-walk case where jump pruning pays off most.
+	std::unique_ptr<DungeonFixture> make_arena(int width, int height)
+	{
+		auto fixture = std::make_unique<DungeonFixture>();
+		fixture->map = std::make_unique<Map>(width, height);
+		Map& map = *fixture->map;
+		map.init_tiles();
+		fixture->ctx.map = &map;
+		fixture->ctx.creatures = &fixture->creatures;
+		carve(map, 1, 1, width - 2, height - 2);
+
+		std::mt19937 rng(static_cast<unsigned int>(width * 17 + height));
+		for (int i = 0; i < width * height / 150; ++i)
+		{
+			const int x = 3 + static_cast<int>(rng() % (width - 6));
+			const int y = 3 + static_cast<int>(rng() % (height - 6));
+			map.set_tile(Vector2D{ x, y }, TileType::WALL, 0);
+		}
+
+		for (int i = 0; i < QUERY_COUNT; ++i)
+		{
+			const int y = 1 + static_cast<int>(rng() % (height - 2));
+			fixture->queries.emplace_back(Vector2D{ 1, y }, Vector2D{ width - 2, height - 1 - y });
+		}
+		return fixture;
+	}
+
+	// The search Dijkstra::a_star_search ran before the reusable engine:
+	// both work vectors refilled per call, Map::neighbors vectors, double
+	// costs via Map::cost, a binary heap and a fresh result vector.
+	class LegacyAStar
+	{
+	public:
+		LegacyAStar(int width, int height)
+			: cameFrom(static_cast<size_t>(width) * height), costSoFar(cameFrom.size())
+		{
+		}
+
+		std::vector<Vector2D> search(Map& graph, Vector2D start, Vector2D goal, const GameContext& ctx)
+		{
+			constexpr double INF = std::numeric_limits<double>::infinity();
+			std::fill(cameFrom.begin(), cameFrom.end(), Vector2D{ -1, -1 });
+			std::fill(costSoFar.begin(), costSoFar.end(), INF);
+
+			using Node = std::pair<double, Vector2D>;
+			const auto greater = [](const Node& a, const Node& b) { return a.first > b.first; };
+			std::priority_queue<Node, std::vector<Node>, decltype(greater)> frontier(greater);
+			frontier.emplace(0.0, start);
+			cameFrom[graph.get_index(start)] = start;
+			costSoFar[graph.get_index(start)] = 0;
+
+			while (!frontier.empty())
+			{
+				const Vector2D current = frontier.top().second;
+				frontier.pop();
+				if (current == goal)
+				{
+					break;
+				}
+				for (Vector2D next : graph.neighbors(current, ctx, goal))
+				{
+					const size_t currentIndex = graph.get_index(current);
+					const size_t nextIndex = graph.get_index(next);
+					const double newCost = costSoFar[currentIndex] + graph.cost(current, next, ctx);
+					if (costSoFar[nextIndex] == INF || newCost < costSoFar[nextIndex])
+					{
+						costSoFar[nextIndex] = newCost;
+						frontier.emplace(newCost + Dijkstra::heuristic(next, goal) / Dijkstra::STEP_COST, next);
+						cameFrom[nextIndex] = current;
+					}
+				}
+			}
+
+			std::vector<Vector2D> path;
+			if (cameFrom[graph.get_index(goal)] == Vector2D{ -1, -1 })
+			{
+				return path;
+			}
+			for (Vector2D current = goal; current != start; current = cameFrom[graph.get_index(current)])
+			{
+				path.push_back(current);
+			}
+			path.push_back(start);
+			std::reverse(path.begin(), path.end());
+			return path;
+		}
+
+	private:
+		std::vector<Vector2D> cameFrom;
+		std::vector<double> costSoFar;
+	};
+}
+
+static void BM_AStar_Legacy(benchmark::State& state)
+{
+	const int width = static_cast<int>(state.range(0));
+	const int height = static_cast<int>(state.range(1));
+	auto fixture = make_dungeon(width, height);
+	LegacyAStar legacy{ width, height };
+
+	size_t query = 0;
+	for (auto _ : state)
+	{
+		const auto& [start, goal] = fixture->queries[query++ % QUERY_COUNT];
+		auto path = legacy.search(*fixture->map, start, goal, fixture->ctx);
+		benchmark::DoNotOptimize(path.data());
+	}
+	state.counters["searches/s"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_AStar_Legacy)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void run_engine(benchmark::State& state, PathAlgorithm algorithm, bool arena)
+{
+	const int width = static_cast<int>(state.range(0));
+	const int height = static_cast<int>(state.range(1));
+	auto fixture = arena ? make_arena(width, height) : make_dungeon(width, height);
+	Dijkstra pathfinder{ width, height };
+	std::vector<Vector2D> path;
+
+	size_t query = 0;
+	for (auto _ : state)
+	{
+		const auto& [start, goal] = fixture->queries[query++ % QUERY_COUNT];
+		pathfinder.find_path(*fixture->map, start, goal, algorithm, fixture->ctx, path);
+		benchmark::DoNotOptimize(path.data());
+	}
+	state.counters["searches/s"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+	state.counters["expanded"] = static_cast<double>(pathfinder.get_expanded_count());
+}
+
+static void BM_AStar_Engine(benchmark::State& state)
+{
+	run_engine(state, PathAlgorithm::ASTAR, false);
+}
+BENCHMARK(BM_AStar_Engine)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_AStar_JumpPoint(benchmark::State& state)
+{
+	run_engine(state, PathAlgorithm::JUMP_POINT, false);
+}
+BENCHMARK(BM_AStar_JumpPoint)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_Arena_AStar(benchmark::State& state)
+{
+	run_engine(state, PathAlgorithm::ASTAR, true);
+}
+BENCHMARK(BM_Arena_AStar)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_Arena_JumpPoint(benchmark::State& state)
+{
+	run_engine(state, PathAlgorithm::JUMP_POINT, true);
+}
+BENCHMARK(BM_Arena_JumpPoint)->Args({ 120, 80 })->Args({ 240, 160 });
+
+// The player walking from query to query, one tile per step.
+static std::vector<Vector2D> make_walk(DungeonFixture& fixture)
+{
+	Dijkstra pathfinder{ fixture.map->get_width(), fixture.map->get_height() };
+	std::vector<Vector2D> walk;
+	std::vector<Vector2D> path;
+	for (const auto& [start, goal] : fixture.queries)
+	{
+		if (pathfinder.find_path(*fixture.map, start, goal, PathAlgorithm::ASTAR, fixture.ctx, path))
+		{
+			walk.insert(walk.end(), path.begin(), path.end());
+		}
+	}
+	return walk;
+}
+
+static void BM_FlowField_Step(benchmark::State& state)
+{
+	auto fixture = make_dungeon(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	Map& map = *fixture->map;
+	const std::vector<Vector2D> walk = make_walk(*fixture);
+	map.reset_dijkstra_touched_count();
+
+	size_t step = 0;
+	for (auto _ : state)
+	{
+		map.update_dijkstra_map(std::span{ &walk[step++ % walk.size()], 1 });
+		benchmark::DoNotOptimize(map.get_dijkstra_cost(walk.front()));
+	}
+	state.counters["touched/step"] = static_cast<double>(map.get_dijkstra_touched_count()) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_FlowField_Step)->Args({ 120, 80 })->Args({ 240, 160 });
+
+// Opens and closes a corridor tile halfway along the walk while the player
+// stands at its start.
+static void run_flow_door(benchmark::State& state, bool incremental)
+{
+	auto fixture = make_dungeon(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	Map& map = *fixture->map;
+	const std::vector<Vector2D> walk = make_walk(*fixture);
+	const std::span<const Vector2D> goal{ walk.data(), 1 };
+	const Vector2D door = walk[walk.size() / 2];
+	map.rebuild_dijkstra_map(goal);
+	map.reset_dijkstra_touched_count();
+
+	bool closed = false;
+	for (auto _ : state)
+	{
+		closed = !closed;
+		map.set_tile(door, closed ? TileType::CLOSED_DOOR : TileType::OPEN_DOOR, closed ? 2 : 1);
+		if (incremental)
+		{
+			map.update_dijkstra_map(goal);
+		}
+		else
+		{
+			map.rebuild_dijkstra_map(goal);
+		}
+		benchmark::DoNotOptimize(map.get_dijkstra_cost(walk.back()));
+	}
+	state.counters["touched/step"] = static_cast<double>(map.get_dijkstra_touched_count()) / static_cast<double>(state.iterations());
+}
+
+static void BM_FlowField_DoorRebuild(benchmark::State& state)
+{
+	run_flow_door(state, false);
+}
+BENCHMARK(BM_FlowField_DoorRebuild)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_FlowField_DoorRepair(benchmark::State& state)
+{
+	run_flow_door(state, true);
+}
+BENCHMARK(BM_FlowField_DoorRepair)->Args({ 120, 80 })->Args({ 240, 160 });
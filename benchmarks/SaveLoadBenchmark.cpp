@@ -0,0 +1,187 @@
+// file: SaveLoadBenchmark.cpp
+// Map persistence, the bulk of a save: the legacy JSON document (an object
+// per tile, dumped indented), the run-length plane JSON Map::save writes
+// now, and the binary MAP section, raw and LZ-compressed, through the same
+// SaveWriter/SaveReader the game uses. The "bytes" counter is the size of
+// what would land on disk.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "../src/Map/Map.h"
+#include "../src/Persistent/BinaryStream.h"
+#include "../src/Persistent/SaveFile.h"
+#include "../src/Utils/Vector2D.h"
+
+namespace
+{
+	// Rooms joined by corridors, about a third of the rows explored.
+	std::unique_ptr<Map> make_map(int width, int height)
+	{
+		auto map = std::make_unique<Map>(width, height);
+		map->init_tiles();
+
+		std::mt19937 rng(static_cast<unsigned int>(width * 31 + height));
+		constexpr int CELL = 16;
+		for (int cy = 0; cy + CELL <= height; cy += CELL)
+		{
+			for (int cx = 0; cx + CELL <= width; cx += CELL)
+			{
+				const int w = 4 + static_cast<int>(rng() % 9);
+				const int h = 3 + static_cast<int>(rng() % 8);
+				const int x = cx + 1 + static_cast<int>(rng() % (CELL - w - 1));
+				const int y = cy + 1 + static_cast<int>(rng() % (CELL - h - 1));
+				for (int ty = y; ty < y + h; ++ty)
+				{
+					for (int tx = x; tx < x + w; ++tx)
+					{
+						map->set_tile(Vector2D{ tx, ty }, TileType::FLOOR, 1);
+					}
+				}
+				for (int tx = x + w; tx < std::min(cx + CELL + 2, width - 1); ++tx)
+				{
+					map->set_tile(Vector2D{ tx, y }, TileType::CORRIDOR, 1);
+				}
+			}
+		}
+		map->reveal();
+		return map;
+	}
+
+	// The pre-plane format, rebuilt here for comparison; Map::load reads it.
+	std::string save_legacy_json(const Map& map)
+	{
+		nlohmann::json j;
+		j["map_width"] = map.get_width();
+		j["map_height"] = map.get_height();
+		j["seed"] = 0;
+		j["tiles"] = nlohmann::json::array();
+		for (int y = 0; y < map.get_height(); ++y)
+		{
+			for (int x = 0; x < map.get_width(); ++x)
+			{
+				const Vector2D pos{ x, y };
+				j["tiles"].push_back(
+					{ { "position", { { "y", y }, { "x", x } } },
+						{ "type", static_cast<int>(map.get_tile_type(pos)) },
+						{ "explored", map.is_explored(pos) },
+						{ "cost", map.get_cost(pos) } });
+			}
+		}
+		return j.dump(4);
+	}
+
+	std::string save_json(Map& map)
+	{
+		nlohmann::json j;
+		map.save(j);
+		return j.dump(4);
+	}
+
+	std::string save_binary(const Map& map, bool compress)
+	{
+		std::ostringstream stream;
+		SaveWriter writer(stream);
+		BinaryWriter section;
+		map.save(section);
+		writer.write_section(SaveSection::MAP, section.data(), compress);
+		writer.finish();
+		return stream.str();
+	}
+}
+
+static void BM_MapSave_LegacyJson(benchmark::State& state)
+{
+	auto map = make_map(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	size_t bytes = 0;
+	for (auto _ : state)
+	{
+		const std::string file = save_legacy_json(*map);
+		bytes = file.size();
+		benchmark::DoNotOptimize(file.data());
+	}
+	state.counters["bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_MapSave_LegacyJson)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_MapLoad_LegacyJson(benchmark::State& state)
+{
+	auto map = make_map(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	const std::string file = save_legacy_json(*map);
+	Map loaded(1, 1);
+	for (auto _ : state)
+	{
+		loaded.load(nlohmann::json::parse(file));
+		benchmark::ClobberMemory();
+	}
+	state.counters["bytes"] = static_cast<double>(file.size());
+}
+BENCHMARK(BM_MapLoad_LegacyJson)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_MapSave_Json(benchmark::State& state)
+{
+	auto map = make_map(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	size_t bytes = 0;
+	for (auto _ : state)
+	{
+		const std::string file = save_json(*map);
+		bytes = file.size();
+		benchmark::DoNotOptimize(file.data());
+	}
+	state.counters["bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_MapSave_Json)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_MapLoad_Json(benchmark::State& state)
+{
+	auto map = make_map(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	const std::string file = save_json(*map);
+	Map loaded(1, 1);
+	for (auto _ : state)
+	{
+		loaded.load(nlohmann::json::parse(file));
+		benchmark::ClobberMemory();
+	}
+	state.counters["bytes"] = static_cast<double>(file.size());
+}
+BENCHMARK(BM_MapLoad_Json)->Args({ 120, 80 })->Args({ 240, 160 });
+
+static void BM_MapSave_Binary(benchmark::State& state)
+{
+	auto map = make_map(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	const bool compress = state.range(2) != 0;
+	size_t bytes = 0;
+	for (auto _ : state)
+	{
+		const std::string file = save_binary(*map, compress);
+		bytes = file.size();
+		benchmark::DoNotOptimize(file.data());
+	}
+	state.counters["bytes"] = static_cast<double>(bytes);
+}
+BENCHMARK(BM_MapSave_Binary)->Args({ 120, 80, 0 })->Args({ 120, 80, 1 })->Args({ 240, 160, 0 })->Args({ 240, 160, 1 });
+
+static void BM_MapLoad_Binary(benchmark::State& state)
+{
+	auto map = make_map(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	const std::string file = save_binary(*map, state.range(2) != 0);
+	Map loaded(1, 1);
+	for (auto _ : state)
+	{
+		const SaveReader reader(std::vector<uint8_t>(file.begin(), file.end()));
+		const std::vector<uint8_t> payload = reader.payload(SaveSection::MAP);
+		BinaryReader in(payload);
+		loaded.load(in, reader.get_version());
+		benchmark::ClobberMemory();
+	}
+	state.counters["bytes"] = static_cast<double>(file.size());
+}
+BENCHMARK(BM_MapLoad_Binary)->Args({ 120, 80, 0 })->Args({ 120, 80, 1 })->Args({ 240, 160, 0 })->Args({ 240, 160, 1 });
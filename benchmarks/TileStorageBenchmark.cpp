@@ -0,0 +1,165 @@
+// file: TileStorageBenchmark.cpp
+// Footprint and whole-map scan cost of the struct-of-arrays TileGrid versus
+// the array-of-structs layout it replaced (Tile + per-cell FOV flags).
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "../src/Map/BitPlane.h"
+#include "../src/Map/TileGrid.h"
+#include "../src/Utils/Vector2D.h"
+
+namespace
+{
+	// Layout of Map::tiles and FovMap::cells_ before the SoA store.
+	struct LegacyTile
+	{
+		Vector2D position{};
+		TileType type{};
+		bool explored{};
+		double cost{};
+		DoorState doorState{ DoorState::OPEN };
+	};
+
+	struct LegacyFovCell
+	{
+		bool walkable{ false };
+		bool transparent{ false };
+		bool visible{ false };
+	};
+
+	struct LegacyMap
+	{
+		std::vector<LegacyTile> tiles;
+		std::vector<LegacyFovCell> cells;
+	};
+
+	struct SoaMap
+	{
+		TileGrid grid;
+		BitPlane visible;
+	};
+
+	// Roughly one visible tile in 40 -- a torch radius on a full level.
+	constexpr int VISIBLE_ONE_IN = 40;
+
+	LegacyMap make_legacy(int width, int height)
+	{
+		LegacyMap map;
+		std::mt19937 rng(42);
+		for (int y = 0; y < height; ++y)
+		{
+			for (int x = 0; x < width; ++x)
+			{
+				map.tiles.push_back(LegacyTile{ Vector2D{ x, y }, TileType::FLOOR, false, 1.0, DoorState::OPEN });
+				map.cells.push_back(LegacyFovCell{ true, true, rng() % VISIBLE_ONE_IN == 0 });
+			}
+		}
+		return map;
+	}
+
+	SoaMap make_soa(int width, int height)
+	{
+		SoaMap map;
+		map.grid.resize(width, height);
+		map.visible.resize(map.grid.size());
+		std::mt19937 rng(42);
+		for (size_t i = 0; i < map.grid.size(); ++i)
+		{
+			map.grid.set_type(i, TileType::FLOOR);
+			map.grid.set_cost(i, 1.0);
+			if (rng() % VISIBLE_ONE_IN == 0)
+			{
+				map.visible.set(i);
+			}
+		}
+		return map;
+	}
+}
+
+// Map::update: explored |= visible over the whole map.
+static void BM_ExploreStamp_Legacy(benchmark::State& state)
+{
+	const int side = static_cast<int>(state.range(0));
+	const int height = static_cast<int>(state.range(1));
+	LegacyMap map = make_legacy(side, height);
+
+	for (auto _ : state)
+	{
+		for (size_t i = 0; i < map.tiles.size(); ++i)
+		{
+			if (map.cells[i].visible)
+			{
+				map.tiles[i].explored = true;
+			}
+		}
+		benchmark::ClobberMemory();
+	}
+	state.counters["bytes"] = static_cast<double>(map.tiles.size() * (sizeof(LegacyTile) + sizeof(LegacyFovCell)));
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(map.tiles.size()));
+}
+BENCHMARK(BM_ExploreStamp_Legacy)->Args({ 120, 80 })->Args({ 1000, 1000 });
+
+static void BM_ExploreStamp_Soa(benchmark::State& state)
+{
+	const int side = static_cast<int>(state.range(0));
+	const int height = static_cast<int>(state.range(1));
+	SoaMap map = make_soa(side, height);
+
+	for (auto _ : state)
+	{
+		map.grid.explored().merge(map.visible);
+		benchmark::ClobberMemory();
+	}
+	// TileGrid plus FovMap's three bit planes
+	state.counters["bytes"] = static_cast<double>(map.grid.memory_bytes() + 3 * map.visible.memory_bytes());
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(map.grid.size()));
+}
+BENCHMARK(BM_ExploreStamp_Soa)->Args({ 120, 80 })->Args({ 1000, 1000 });
+
+// Lighting / minimap: visit every explored-or-visible tile.
+static void BM_LitTileScan_Legacy(benchmark::State& state)
+{
+	LegacyMap map = make_legacy(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	for (size_t i = 0; i < map.tiles.size(); i += 3)
+	{
+		map.tiles[i].explored = (i % 9) == 0;
+	}
+
+	for (auto _ : state)
+	{
+		size_t lit = 0;
+		for (size_t i = 0; i < map.tiles.size(); ++i)
+		{
+			if (map.cells[i].visible || map.tiles[i].explored)
+			{
+				lit += static_cast<size_t>(map.tiles[i].position.x);
+			}
+		}
+		benchmark::DoNotOptimize(lit);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(map.tiles.size()));
+}
+BENCHMARK(BM_LitTileScan_Legacy)->Args({ 120, 80 })->Args({ 1000, 1000 });
+
+static void BM_LitTileScan_Soa(benchmark::State& state)
+{
+	SoaMap map = make_soa(static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+	for (size_t i = 0; i < map.grid.size(); i += 9)
+	{
+		map.grid.explored().set(i);
+	}
+	const int width = map.grid.get_width();
+
+	for (auto _ : state)
+	{
+		size_t lit = 0;
+		map.visible.for_each_set_in_union(map.grid.explored(), [&](size_t index)
+			{ lit += index % static_cast<size_t>(width); });
+		benchmark::DoNotOptimize(lit);
+	}
+	state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(map.grid.size()));
+}
+BENCHMARK(BM_LitTileScan_Soa)->Args({ 120, 80 })->Args({ 1000, 1000 });
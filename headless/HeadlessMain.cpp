@@ -0,0 +1,170 @@
+// file: HeadlessMain.cpp
+// Entry point of the headless build: plays the game with BotPlayer, no
+// window, and prints turns per second and per-phase timings.
+//
+//   headless_exe [--turns N] [--seed S] [--class NAME] [--race NAME]
+//                [--no-restart] [--verbose] [--trace FILE] [--csv FILE]
+//                [--record FILE | --replay FILE]
+//
+// --trace and --csv write the profiler's last Profiler::FRAME_HISTORY turns
+// (Chrome trace JSON, CSV); the profiler is compiled out of NDEBUG builds.
+// --record writes the bot's last game as an input recording; --replay plays
+// one back (from either build) instead of running the bot and exits 1 if
+// the state it ends in differs from the recorded one.
+// Run from the repository root so the data files resolve.
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "src/Core/Paths.h"
+#include "src/Factories/ItemCreator.h"
+#include "src/Factories/MonsterCreator.h"
+#include "src/Game.h"
+#include "src/Headless/BotPlayer.h"
+#include "src/Headless/HeadlessRunner.h"
+#include "src/Systems/InputRecorder.h"
+#include "src/Systems/Logger.h"
+#include "src/Systems/Profiler.h"
+#include "src/Systems/SpellSystem.h"
+
+namespace
+{
+	void print_usage()
+	{
+		std::cerr << "usage: headless_exe [--turns N] [--seed S] [--class NAME] [--race NAME] [--no-restart] [--verbose] [--trace FILE] [--csv FILE] [--record FILE | --replay FILE]\n";
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	HeadlessOptions options;
+	bool verbose = false;
+	std::string tracePath;
+	std::string csvPath;
+	std::string recordPath;
+	std::string replayPath;
+	try
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg = argv[i];
+			const bool hasValue = i + 1 < argc;
+			if (arg == "--turns" && hasValue)
+			{
+				options.turns = std::stoi(argv[++i]);
+			}
+			else if (arg == "--seed" && hasValue)
+			{
+				options.seed = static_cast<unsigned int>(std::stoul(argv[++i]));
+			}
+			else if (arg == "--class" && hasValue)
+			{
+				options.playerClass = argv[++i];
+			}
+			else if (arg == "--race" && hasValue)
+			{
+				options.playerRace = argv[++i];
+			}
+			else if (arg == "--no-restart")
+			{
+				options.restartOnDeath = false;
+			}
+			else if (arg == "--verbose")
+			{
+				verbose = true;
+			}
+			else if (arg == "--trace" && hasValue)
+			{
+				tracePath = argv[++i];
+			}
+			else if (arg == "--csv" && hasValue)
+			{
+				csvPath = argv[++i];
+			}
+			else if (arg == "--record" && hasValue)
+			{
+				recordPath = argv[++i];
+			}
+			else if (arg == "--replay" && hasValue)
+			{
+				replayPath = argv[++i];
+			}
+			else
+			{
+				print_usage();
+				return 2;
+			}
+		}
+		if (!recordPath.empty() && !replayPath.empty())
+		{
+			print_usage();
+			return 2;
+		}
+	}
+	catch (const std::exception&)
+	{
+		print_usage();
+		return 2;
+	}
+
+	// Game messages log at debug level; at full speed they would drown the report.
+	Logger::instance().set_level(verbose ? LogLevel::LOG_DEBUG : LogLevel::LOG_WARN);
+
+	int status = 0;
+	try
+	{
+		MonsterCreator::load(Paths::MONSTERS);
+		SpellSystem::load(Paths::SPELLS);
+		ItemCreator::load(Paths::ITEMS);
+		ItemCreator::load_enhanced_rules(Paths::ENHANCED_RULES);
+
+		auto game = std::make_unique<Game>();
+		game->tileConfig.load(Paths::TILE_CONFIG);
+		game->init_world();
+		game->decorEditor.load_palette(Paths::TILE_CONFIG);
+		game->prefabLibrary.load_tile_labels(Paths::TILE_CONFIG);
+		game->prefabLibrary.load(Paths::PREFABS);
+
+		HeadlessRunner runner{ *game };
+		if (!replayPath.empty())
+		{
+			const ReplayReport report = runner.replay(InputRecording::read_file(replayPath));
+			std::cout << format_replay(report);
+			status = report.matches() ? 0 : 1;
+		}
+		else
+		{
+			BotPlayer bot{ options.seed };
+			game->inputRecorder.set_output(recordPath); // empty: not recording
+			const HeadlessReport report = runner.run(bot, options);
+			std::cout << format_report(report);
+			status = report.stalled ? 1 : 0;
+			if (!recordPath.empty() && !game->inputRecorder.finish(game->context()))
+			{
+				std::cerr << "Could not write " << recordPath << '\n';
+				status = 1;
+			}
+		}
+		if (!tracePath.empty())
+		{
+			std::ofstream trace{ tracePath };
+			Profiler::instance().write_chrome_trace(trace);
+		}
+		if (!csvPath.empty())
+		{
+			std::ofstream csv{ csvPath };
+			Profiler::instance().write_csv(csv);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "Headless run failed: " << e.what() << '\n';
+		status = 1;
+	}
+
+	Logger::instance().shutdown();
+	return status;
+}
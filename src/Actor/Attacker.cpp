@@ -59,14 +59,14 @@ void Attacker::perform_single_attack(
 	const int strIndex = owner.get_strength() - 1;
 	if (strIndex < 0 || static_cast<size_t>(strIndex) >= ctx.dataManager->get_strength_attributes().size())
 	{
-		ctx.messageSystem->log(std::format("ERROR: Invalid strength {} for {}", owner.get_strength(), owner.actorData.name));
+		ctx.messageSystem->debug("ERROR: Invalid strength {} for {}", owner.get_strength(), owner.actorData.name);
 		return;
 	}
 	const auto& strengthAttr = ctx.dataManager->get_strength_attributes().at(strIndex);
 
 	// Roll dice
-	const int attackRoll = ctx.dice->d20();
-	const int damageRoll = ctx.dice->roll(attackDamage.minDamage, attackDamage.maxDamage);
+	const int attackRoll = ctx.dice->combat().d20();
+	const int damageRoll = ctx.dice->combat().roll(attackDamage.minDamage, attackDamage.maxDamage);
 
 	// Calculate backstab and to-hit roll
 	const BackstabInfo backstab = calculate_backstab_bonus(owner);
@@ -176,10 +176,10 @@ int Attacker::calculate_to_hit_roll(
 
 			if (dexAttr.MissileAttackAdj != 0)
 			{
-				ctx.messageSystem->log(std::format(
+				ctx.messageSystem->debug(
 					"Ranged modifier: {} from DEX {}",
 					dexAttr.MissileAttackAdj,
-					attacker.get_dexterity()));
+					attacker.get_dexterity());
 			}
 		}
 	}
@@ -239,7 +239,7 @@ void Attacker::log_attack_hit(
 	ctx.messageSystem->append_message_part(WHITE_BLACK_PAIR, std::format(" dmg ({}).", attackDamage.displayRoll));
 	ctx.messageSystem->finalize_message();
 
-	ctx.messageSystem->log(std::format(
+	ctx.messageSystem->debug(
 		"HIT ({}): {} rolled {} vs {} | {} ({}) + {} str - {} DR = {} dmg",
 		handName,
 		attacker.actorData.name,
@@ -249,7 +249,7 @@ void Attacker::log_attack_hit(
 		attackDamage.get_damage_range(),
 		strengthBonus,
 		dr,
-		finalDamage));
+		finalDamage);
 }
 
 void Attacker::log_attack_miss(
@@ -272,7 +272,7 @@ void Attacker::log_attack_miss(
 	ctx.messageSystem->append_message_part(RED_BLACK_PAIR, ". Miss!");
 	ctx.messageSystem->finalize_message();
 
-	ctx.messageSystem->log(std::format(
+	ctx.messageSystem->debug(
 		"MISS ({}): {} rolled {} vs {} (THAC0:{}, AC:{}, Penalty:{})",
 		handName,
 		attacker.actorData.name,
@@ -280,7 +280,7 @@ void Attacker::log_attack_miss(
 		rollNeeded,
 		attacker.get_thaco(),
 		target.get_armor_class(),
-		attackPenalty));
+		attackPenalty);
 }
 
 void Attacker::load(const json& j)
@@ -260,7 +260,7 @@ void Creature::update_constitution_bonus(GameContext& ctx)
 		}
 		else
 		{
-			ctx.messageSystem->log(std::format("{} dies from stat drain.", get_name()));
+			ctx.messageSystem->debug("{} dies from stat drain.", get_name());
 		}
 		die(ctx);
 	}
@@ -337,19 +337,19 @@ void Creature::equip(Item& item, GameContext& ctx)
 	{
 		weaponEquipped = item.get_name();
 		std::string weaponDamage = WeaponDamageRegistry::get_damage_roll(item.itemKey);
-		ctx.messageSystem->log(std::format("Equipped {} - damage: {}", item.get_name(), weaponDamage));
+		ctx.messageSystem->debug("Equipped {} - damage: {}", item.get_name(), weaponDamage);
 	}
 
 	// Log shield equipped
 	if (isShield)
 	{
-		ctx.messageSystem->log(std::format("Equipped {}", item.get_name()));
+		ctx.messageSystem->debug("Equipped {}", item.get_name());
 	}
 
 	// Log armor equipped
 	if (isArmor)
 	{
-		ctx.messageSystem->log(std::format("Equipped {}", item.get_name()));
+		ctx.messageSystem->debug("Equipped {}", item.get_name());
 	}
 }
 
@@ -374,7 +374,7 @@ void Creature::unequip(Item& item, GameContext& ctx)
 				if (has_state(ActorState::IS_RANGED))
 				{
 					remove_state(ActorState::IS_RANGED);
-					ctx.messageSystem->log("Removed IS_RANGED state after unequipping " + item.actorData.name);
+					ctx.messageSystem->debug("Removed IS_RANGED state after unequipping {}", item.actorData.name);
 				}
 			}
 		}
@@ -105,7 +105,7 @@ const std::string& Item::get_true_name() const noexcept
 	// Returns the complete, true name (for internal use)
 	if (is_enhanced())
 	{
-		static std::string enhancedName;
+		thread_local std::string enhancedName; // thread_local: levels also generate off the game thread
 		enhancedName = enhancement.get_full_name(actorData.name);
 		return enhancedName;
 	}
@@ -115,7 +115,7 @@ const std::string& Item::get_true_name() const noexcept
 const std::string& Item::get_name() const noexcept
 {
 	// Returns identified parts only; unknown parts marked with "?"
-	static std::string displayName;
+	thread_local std::string displayName;
 
 	if (!is_enhanced())
 	{
@@ -189,19 +189,19 @@ void Item::apply_enhancement(const ItemEnhancement& newEnhancement)
 	// Name is computed dynamically by get_name() -- do not modify actorData.name
 }
 
-void Item::generate_random_enhancement(bool allowMagical)
+void Item::generate_random_enhancement(bool allowMagical, RandomDice& dice)
 {
 	if (is_weapon())
 	{
-		enhancement = ItemEnhancement::generate_weapon_enhancement();
+		enhancement = ItemEnhancement::generate_weapon_enhancement(dice);
 	}
 	else if (is_armor())
 	{
-		enhancement = ItemEnhancement::generate_armor_enhancement();
+		enhancement = ItemEnhancement::generate_armor_enhancement(dice);
 	}
 	else
 	{
-		enhancement = ItemEnhancement::generate_random_enhancement(allowMagical);
+		enhancement = ItemEnhancement::generate_random_enhancement(allowMagical, dice);
 	}
 }
 
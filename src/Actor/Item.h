@@ -31,7 +31,7 @@ public:
 
 	// Enhancement system
 	void apply_enhancement(const ItemEnhancement& newEnhancement);
-	void generate_random_enhancement(bool allowMagical);
+	void generate_random_enhancement(bool allowMagical, RandomDice& dice);
 	const ItemEnhancement& get_enhancement() const noexcept { return enhancement; }
 	bool is_enhanced() const noexcept;
 
@@ -19,18 +19,18 @@
 Mimic::Mimic(Vector2D position, GameContext& ctx)
 	: Creature(position, ActorData{ MonsterCreator::get_tile(MonsterId::MIMIC), "mimic", RED_YELLOW_PAIR })
 {
-	const int hp = ctx.dice->d6() + ctx.dice->d4();
+	const int hp = ctx.dice->mapgen().d6() + ctx.dice->mapgen().d4();
 	const int thaco = 17;
 	const int ac = 7;
 
 	// Mimic: AD&D 2e -- strong pseudopod, average dex, tough, low animal INT,
 	// decent predator WIS, very low CHA (horrifying when revealed).
-	set_strength(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6() + 2); // 3d6+2 avg 12
-	set_dexterity(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6());    // 3d6    avg 10
-	set_constitution(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6()); // 3d6    avg 10
-	set_intelligence(ctx.dice->d4() + 2);                               // 1d4+2  avg  4
-	set_wisdom(ctx.dice->d6() + ctx.dice->d6() + 1);                    // 2d6+1  avg  8
-	set_charisma(ctx.dice->d4());                                        // 1d4    avg  2
+	set_strength(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + 2); // 3d6+2 avg 12
+	set_dexterity(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6());    // 3d6    avg 10
+	set_constitution(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6()); // 3d6    avg 10
+	set_intelligence(ctx.dice->mapgen().d4() + 2);                               // 1d4+2  avg  4
+	set_wisdom(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + 1);                    // 2d6+1  avg  8
+	set_charisma(ctx.dice->mapgen().d4());                                        // 1d4    avg  2
 
 	set_weapon_equipped("Pseudopod");
 
@@ -50,7 +50,7 @@ Mimic::Mimic(Vector2D position, GameContext& ctx)
 	}
 
 	// Apply initial random disguise to this creature's visible appearance.
-	const size_t index = ctx.dice->roll(0, static_cast<int>(disguises.size()) - 1);
+	const size_t index = ctx.dice->mapgen().roll(0, static_cast<int>(disguises.size()) - 1);
 	const auto& chosen = disguises.at(index);
 	actorData.tile = chosen.tile;
 	actorData.name = chosen.name;
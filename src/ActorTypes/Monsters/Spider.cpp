@@ -55,16 +55,16 @@ void Spider::init_spider_type(GameContext& ctx)
 		actorData = ActorData{ MonsterCreator::get_tile(MonsterId::SPIDER_SMALL), "small spider", GREEN_BLACK_PAIR };
 
 		// Stats for small spider
-		set_strength(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6()); // Minimum strength of 3
-		set_dexterity(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6()); // Small spiders are very agile
-		set_constitution(ctx.dice->d6());
+		set_strength(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6()); // Minimum strength of 3
+		set_dexterity(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6()); // Small spiders are very agile
+		set_constitution(ctx.dice->mapgen().d6());
 
 		// Combat properties - TRIPLED XP for solo play
 		experienceReward = std::make_unique<ExperienceReward>(45); // TRIPLED from 15 for solo play bonus
 		set_dr(0);
 		set_thaco(20);
 		armorClass = std::make_unique<ArmorClass>(7);
-		healthPool = std::make_unique<HealthPool>(ctx.dice->d2() + 2);
+		healthPool = std::make_unique<HealthPool>(ctx.dice->mapgen().d2() + 2);
 		attacker = std::make_unique<MonsterAttacker>(*this, DamageInfo{ 1, 4, "1d4" });
 		set_weapon_equipped("Venomous fangs");
 
@@ -76,16 +76,16 @@ void Spider::init_spider_type(GameContext& ctx)
 		actorData = ActorData{ MonsterCreator::get_tile(MonsterId::SPIDER_GIANT), "giant spider", RED_BLACK_PAIR };
 
 		// Stats for giant spider
-		set_strength(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6());
-		set_dexterity(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6());
-		set_constitution(ctx.dice->d6() + 1);
+		set_strength(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6());
+		set_dexterity(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6());
+		set_constitution(ctx.dice->mapgen().d6() + 1);
 
 		// Combat properties - giant spiders have more HP and do more damage - TRIPLED XP for solo play
 		experienceReward = std::make_unique<ExperienceReward>(120); // TRIPLED from 40 for solo play bonus
 		set_dr(1);
 		set_thaco(19);
 		armorClass = std::make_unique<ArmorClass>(5);
-		healthPool = std::make_unique<HealthPool>(ctx.dice->d4() + 3);
+		healthPool = std::make_unique<HealthPool>(ctx.dice->mapgen().d4() + 3);
 		attacker = std::make_unique<MonsterAttacker>(*this, DamageInfo{ 1, 6, "1d6" });
 		set_weapon_equipped("Giant fangs");
 
@@ -97,16 +97,16 @@ void Spider::init_spider_type(GameContext& ctx)
 		actorData = ActorData{ MonsterCreator::get_tile(MonsterId::SPIDER_WEAVER), "web weaver", BLACK_GREEN_PAIR };
 
 		// Stats for web spinner - now much more formidable
-		set_strength(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6());
-		set_dexterity(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6());
-		set_constitution(ctx.dice->d6() + ctx.dice->d6() + ctx.dice->d6());
+		set_strength(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6());
+		set_dexterity(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6());
+		set_constitution(ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6() + ctx.dice->mapgen().d6());
 
 		// Combat properties - significantly stronger - TRIPLED XP for solo play
 		experienceReward = std::make_unique<ExperienceReward>(180); // TRIPLED from 60 for solo play bonus
 		set_dr(1);
 		set_thaco(17);
 		armorClass = std::make_unique<ArmorClass>(5);
-		healthPool = std::make_unique<HealthPool>(ctx.dice->d8() + 5);
+		healthPool = std::make_unique<HealthPool>(ctx.dice->mapgen().d8() + 5);
 		attacker = std::make_unique<MonsterAttacker>(*this, DamageInfo{ 1, 8, "1d8" });
 		set_weapon_equipped("Toxic fangs");
 
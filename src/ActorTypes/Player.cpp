@@ -572,6 +572,11 @@ bool Player::rest(GameContext& ctx)
 
 void Player::animate_resting(GameContext& ctx)
 {
+	if (!ctx.floatingText)
+	{
+		return; // headless: nothing to animate
+	}
+
 	// Spawn one floating 'z'/'Z' above the player each rest turn.
 	// The floating text system handles the animated drift and fade.
 	// Alternate lowercase/uppercase by hp recovered so far (varies nicely).
@@ -784,11 +789,11 @@ bool Player::equip_item(std::unique_ptr<Item> item, EquipmentSlot slot, GameCont
 	{
 		if (ctx.messageSystem->is_debug_mode())
 		{
-			ctx.messageSystem->log("DEBUG: can_equip failed for " + item->actorData.name);
-			ctx.messageSystem->log("DEBUG: Item class: " + std::to_string(static_cast<int>(item->itemClass)));
-			ctx.messageSystem->log("DEBUG: Is armor: " + std::string(item->is_armor() ? "true" : "false"));
-			ctx.messageSystem->log("DEBUG: Slot: " + std::to_string(static_cast<int>(slot)));
-			ctx.messageSystem->log("DEBUG: equip_item failed - can_equip returned false for " + item->actorData.name + " in slot " + std::to_string(static_cast<int>(slot)));
+			ctx.messageSystem->debug("DEBUG: can_equip failed for {}", item->actorData.name);
+			ctx.messageSystem->debug("DEBUG: Item class: {}", static_cast<int>(item->itemClass));
+			ctx.messageSystem->debug("DEBUG: Is armor: {}", item->is_armor() ? "true" : "false");
+			ctx.messageSystem->debug("DEBUG: Slot: {}", static_cast<int>(slot));
+			ctx.messageSystem->debug("DEBUG: equip_item failed - can_equip returned false for {} in slot {}", item->actorData.name, static_cast<int>(slot));
 		}
 		// Return item to inventory since we can't equip it
 		assert(InventoryOperations::add_item_to_inventory(inventoryData, std::move(item), *this).has_value());
@@ -819,10 +824,12 @@ bool Player::equip_item(std::unique_ptr<Item> item, EquipmentSlot slot, GameCont
 	add_stat_bonuses_from_equipment(*equippedItems.back().item);
 
 	// Log weapon equip
-	if (slot == EquipmentSlot::RIGHT_HAND && equippedItems.back().item->is_weapon())
+	if (slot == EquipmentSlot::RIGHT_HAND && equippedItems.back().item->is_weapon() && ctx.messageSystem->is_debug_mode())
 	{
-		std::string weaponDamage = WeaponDamageRegistry::get_damage_roll(equippedItems.back().item->itemKey);
-		ctx.messageSystem->log("Equipped " + equippedItems.back().item->actorData.name + " - damage: " + weaponDamage);
+		ctx.messageSystem->debug(
+			"Equipped {} - damage: {}",
+			equippedItems.back().item->actorData.name,
+			WeaponDamageRegistry::get_damage_roll(equippedItems.back().item->itemKey));
 	}
 
 	// Update armor class if armor or shield was equipped
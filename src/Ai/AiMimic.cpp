@@ -143,7 +143,7 @@ void AiMimic::update(Creature& owner, GameContext& ctx)
 		return false;
 	}
 
-	ctx.messageSystem->log(std::format("Checking for items. Inventory size: {}", ctx.floorInventory->items.size()));
+	ctx.messageSystem->debug("Checking for items. Inventory size: {}", ctx.floorInventory->items.size());
 
 	std::vector<size_t> itemsToRemove;
 	bool itemConsumed = false;
@@ -157,13 +157,13 @@ void AiMimic::update(Creature& owner, GameContext& ctx)
 		}
 
 		const int itemDistance = owner.get_tile_distance(item->position);
-		ctx.messageSystem->log(std::format("Item at distance {}: {}", itemDistance, item->actorData.name));
+		ctx.messageSystem->debug("Item at distance {}: {}", itemDistance, item->actorData.name);
 
 		if (itemDistance <= CONSUMPTION_RADIUS)
 		{
 			if (!item->behavior)
 			{
-				ctx.messageSystem->log(std::format("Mimic found non-pickable item, skipping: {}", item->actorData.name));
+				ctx.messageSystem->debug("Mimic found non-pickable item, skipping: {}", item->actorData.name);
 				continue;
 			}
 
@@ -173,7 +173,7 @@ void AiMimic::update(Creature& owner, GameContext& ctx)
 			ctx.messageSystem->append_message_part(WHITE_BLACK_PAIR, "!");
 			ctx.messageSystem->finalize_message();
 
-			ctx.messageSystem->log(std::format("Mimic consuming item: {}", item->actorData.name));
+			ctx.messageSystem->debug("Mimic consuming item: {}", item->actorData.name);
 
 			++itemsConsumed;
 			apply_item_bonus(owner, item->itemClass, ctx);
@@ -191,7 +191,7 @@ void AiMimic::update(Creature& owner, GameContext& ctx)
 
 	for (size_t index : std::views::reverse(itemsToRemove))
 	{
-		ctx.messageSystem->log(std::format("Removing consumed item at index {}", index));
+		ctx.messageSystem->debug("Removing consumed item at index {}", index);
 
 		if (index < ctx.floorInventory->items.size() && ctx.floorInventory->items[index])
 		{
@@ -217,7 +217,7 @@ void AiMimic::apply_item_bonus(Creature& owner, ItemClass itemClass, GameContext
 	case MimicBonusType::HEALTH:
 	{
 		boost_health(owner, HEALTH_BONUS, ctx);
-		ctx.messageSystem->log(std::format("Mimic gained {} HP", HEALTH_BONUS));
+		ctx.messageSystem->debug("Mimic gained {} HP", HEALTH_BONUS);
 		break;
 	}
 
@@ -232,7 +232,7 @@ void AiMimic::apply_item_bonus(Creature& owner, ItemClass itemClass, GameContext
 		boost_defense(owner, DR_BONUS, MAX_GOLD_DR_BONUS, ctx);
 		if (owner.get_dr() <= MAX_GOLD_DR_BONUS)
 		{
-			ctx.messageSystem->log(std::format("Mimic gained {} DR from gold", DR_BONUS));
+			ctx.messageSystem->debug("Mimic gained {} DR from gold", DR_BONUS);
 		}
 		break;
 	}
@@ -242,7 +242,7 @@ void AiMimic::apply_item_bonus(Creature& owner, ItemClass itemClass, GameContext
 		boost_defense(owner, DR_BONUS, MAX_ARMOR_DR_BONUS, ctx);
 		if (owner.get_dr() <= MAX_ARMOR_DR_BONUS)
 		{
-			ctx.messageSystem->log(std::format("Mimic gained {} DR from armor", DR_BONUS));
+			ctx.messageSystem->debug("Mimic gained {} DR from armor", DR_BONUS);
 		}
 		break;
 	}
@@ -267,7 +267,7 @@ void AiMimic::boost_health(Creature& owner, int amount, GameContext& ctx)
 		owner.get_hp() + amount,
 		owner.get_max_hp());
 	owner.set_hp(newCurrentHp);
-	ctx.messageSystem->log(std::format("Mimic gained {} health from food", amount));
+	ctx.messageSystem->debug("Mimic gained {} health from food", amount);
 }
 
 void AiMimic::boost_defense(Creature& owner, int amount, int maxDR, GameContext& ctx)
@@ -290,14 +290,14 @@ void AiMimic::boost_attack(Creature& owner, GameContext& ctx)
 			newMaxDamage,
 			std::format("1d{}", newMaxDamage));
 		owner.attacker->set_damage_info(improvedDamage);
-		ctx.messageSystem->log(std::format("Mimic improved attack to {}", improvedDamage.displayRoll));
+		ctx.messageSystem->debug("Mimic improved attack to {}", improvedDamage.displayRoll);
 	}
 }
 
 void AiMimic::boost_confusion_power(GameContext& ctx)
 {
 	confusionDuration = std::min(confusionDuration + CONFUSION_BONUS, MAX_CONFUSION_DURATION);
-	ctx.messageSystem->log(std::format("Mimic increased confusion duration to {}", confusionDuration));
+	ctx.messageSystem->debug("Mimic increased confusion duration to {}", confusionDuration);
 }
 
 void AiMimic::transform_to_greater_mimic(Creature& owner, GameContext& ctx)
@@ -311,7 +311,7 @@ void AiMimic::transform_to_greater_mimic(Creature& owner, GameContext& ctx)
 void AiMimic::check_revealing(Creature& owner, GameContext& ctx)
 {
 	int distanceToPlayer = owner.get_tile_distance(ctx.player->position);
-	ctx.messageSystem->log("Mimic distance to player: " + std::to_string(distanceToPlayer));
+	ctx.messageSystem->debug("Mimic distance to player: {}", distanceToPlayer);
 
 	if (distanceToPlayer <= revealDistance)
 	{
@@ -323,7 +323,7 @@ void AiMimic::check_revealing(Creature& owner, GameContext& ctx)
 
 		ctx.messageSystem->log("Mimic revealed itself!");
 
-		if (ctx.dice->d20() > ctx.player->get_wisdom())
+		if (ctx.dice->ai().d20() > ctx.player->get_wisdom())
 		{
 			ctx.messageSystem->append_message_part(WHITE_GREEN_PAIR, "The ");
 			ctx.messageSystem->append_message_part(RED_YELLOW_PAIR, "mimic");
@@ -332,7 +332,7 @@ void AiMimic::check_revealing(Creature& owner, GameContext& ctx)
 
 			ctx.player->add_state(ActorState::IS_CONFUSED);
 			ctx.player->apply_confusion(confusionDuration);
-			ctx.messageSystem->log("Applied confusion to player for " + std::to_string(confusionDuration) + " turns");
+			ctx.messageSystem->debug("Applied confusion to player for {} turns", confusionDuration);
 		}
 		else
 		{
@@ -353,7 +353,7 @@ void AiMimic::change_disguise(Creature& owner, GameContext& ctx)
 
 	if (!possibleDisguises.empty())
 	{
-		const size_t index = ctx.dice->roll(0, static_cast<int>(possibleDisguises.size()) - 1);
+		const size_t index = ctx.dice->ai().roll(0, static_cast<int>(possibleDisguises.size()) - 1);
 		const auto& chosen = possibleDisguises.at(index);
 		owner.actorData.tile = chosen.tile;
 		owner.actorData.name = chosen.name;
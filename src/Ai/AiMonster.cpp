@@ -8,6 +8,7 @@
 #include "../Core/GameContext.h"
 #include "../Map/Map.h"
 #include "../Persistent/Persistent.h"
+#include "../Systems/CreatureManager.h"
 #include "../Utils/Vector2D.h"
 #include "Ai.h"
 #include "AiMonster.h"
@@ -58,7 +59,7 @@ namespace
 
 		if (bestStep)
 		{
-			owner.position = *bestStep;
+			ctx.creatureManager->move_creature(owner, *bestStep);
 		}
 		else
 		{
@@ -89,7 +90,7 @@ namespace
 			return;
 		}
 
-		const int moraleRoll = ctx.dice->roll(1, 10) + ctx.dice->roll(1, 10);
+		const int moraleRoll = ctx.dice->ai().roll(1, 10) + ctx.dice->ai().roll(1, 10);
 		if (moraleRoll > owner.get_morale())
 		{
 			owner.add_state(ActorState::IS_FLEEING);
@@ -99,8 +100,8 @@ namespace
 	// One step of random drift. No-ops when the chosen tile is blocked or occupied.
 	void random_wander(Creature& owner, GameContext& ctx)
 	{
-		int dx = ctx.dice->roll(-1, 1);
-		int dy = ctx.dice->roll(-1, 1);
+		int dx = ctx.dice->ai().roll(-1, 1);
+		int dy = ctx.dice->ai().roll(-1, 1);
 		if (dx == 0 && dy == 0)
 		{
 			return;
@@ -108,7 +109,7 @@ namespace
 		Vector2D newPos = owner.position + Vector2D{ dx, dy };
 		if (ctx.map->can_walk(newPos, ctx) && !ctx.map->get_actor(newPos, ctx))
 		{
-			owner.position = newPos;
+			ctx.creatureManager->move_creature(owner, newPos);
 		}
 	}
 	// Returns true when this creature must skip its turn entirely.
@@ -133,7 +134,7 @@ bool blocked_by_sanctuary(GameContext& ctx)
 	{
 		return false;
 	}
-	return ctx.dice->roll(1, 20) < 15;
+	return ctx.dice->ai().roll(1, 20) < 15;
 }
 
 void AiMonster::move_or_attack(Creature& owner, Vector2D targetPosition, GameContext& ctx)
@@ -183,14 +184,14 @@ void AiMonster::move_or_attack(Creature& owner, Vector2D targetPosition, GameCon
 
 	if (bestStep)
 	{
-		owner.position = *bestStep;
+		ctx.creatureManager->move_creature(owner, *bestStep);
 	}
 }
 
 // Keeps moveCount current: full reset when player is visible, decay when not.
 void AiMonster::update_tracking(Creature& owner, const GameContext& ctx)
 {
-	if (ctx.map->is_in_fov(owner.position) && !ctx.player->is_invisible())
+	if (ctx.map->creature_can_see(owner, ctx.player->position) && !ctx.player->is_invisible())
 	{
 		moveCount = TRACKING_TURNS;
 	}
@@ -218,16 +219,16 @@ void AiMonster::decide_action(Creature& owner, GameContext& ctx)
 	}
 	else if (distanceToPlayer <= 15 && !ctx.player->is_invisible())
 	{
-		if (ctx.dice->d6() == 1)
+		if (ctx.dice->ai().d6() == 1)
 		{
 			move_or_attack(owner, ctx.player->position, ctx);
 		}
-		else if (ctx.dice->d10() == 1)
+		else if (ctx.dice->ai().d10() == 1)
 		{
 			random_wander(owner, ctx);
 		}
 	}
-	else if (ctx.dice->d20() == 1)
+	else if (ctx.dice->ai().d20() == 1)
 	{
 		random_wander(owner, ctx);
 	}
@@ -6,6 +6,7 @@
 #include "../Map/Map.h"
 #include "../Persistent/Persistent.h"
 #include "../Random/RandomDice.h"
+#include "../Systems/CreatureManager.h"
 #include "../Utils/Vector2D.h"
 #include "Ai.h"
 #include "AiMonsterConfused.h"
@@ -39,8 +40,8 @@ void AiMonsterConfused::update(Creature& owner, GameContext& ctx)
 [[nodiscard]] Vector2D AiMonsterConfused::get_random_direction(GameContext& ctx) const
 {
 	return Vector2D{
-		ctx.dice->roll(MIN_DIRECTION, MAX_DIRECTION),
-		ctx.dice->roll(MIN_DIRECTION, MAX_DIRECTION)
+		ctx.dice->ai().roll(MIN_DIRECTION, MAX_DIRECTION),
+		ctx.dice->ai().roll(MIN_DIRECTION, MAX_DIRECTION)
 	};
 }
 
@@ -48,7 +49,7 @@ void AiMonsterConfused::attempt_move(Creature& owner, const Vector2D& destinatio
 {
 	if (ctx.map->can_walk(destination, ctx))
 	{
-		owner.position = destination;
+		ctx.creatureManager->move_creature(owner, destination);
 	}
 	else
 	{
@@ -10,6 +10,7 @@
 #include "../Map/Map.h"
 #include "../Persistent/Persistent.h"
 #include "../Systems/AnimationSystem.h"
+#include "../Systems/CreatureManager.h"
 #include "../Systems/TileConfig.h"
 #include "../Utils/Vector2D.h"
 #include "AiMonster.h"
@@ -22,7 +23,7 @@ void AiMonsterRanged::update(Creature& owner, GameContext& ctx)
 		return;
 	}
 
-	if (ctx.map->is_in_fov(owner.position))
+	if (ctx.map->creature_can_see(owner, ctx.player->position))
 	{
 		// Move towards the player if we can see them
 		moveCount = TRACKING_TURNS;
@@ -74,7 +75,7 @@ void AiMonsterRanged::move_or_attack(Creature& owner, Vector2D targetPosition, G
 		Vector2D newPos = owner.position + moveDir;
 		if (ctx.map->can_walk(newPos, ctx) && !ctx.map->get_actor(newPos, ctx))
 		{
-			owner.position = newPos;
+			ctx.creatureManager->move_creature(owner, newPos);
 			return;
 		}
 	}
@@ -103,7 +104,10 @@ bool AiMonsterRanged::tryRangedAttack(Creature& owner, Vector2D targetPos, GameC
 
 void AiMonsterRanged::animate_arrow(Vector2D from, Vector2D to, GameContext& ctx)
 {
-	assert(ctx.animSystem && "AiMonsterRanged::animate_arrow called without an animSystem");
+	if (!ctx.animSystem)
+	{
+		return; // headless: nothing to animate
+	}
 	assert(ctx.tileConfig && "AiMonsterRanged::animate_arrow called without a tileConfig");
 
 	const TileRef boltTile = ctx.tileConfig->get("TILE_EFFECT_BOLT");
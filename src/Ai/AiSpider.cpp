@@ -11,6 +11,7 @@
 #include "../Core/GameContext.h"
 #include "../Map/Map.h"
 #include "../Persistent/Persistent.h"
+#include "../Systems/CreatureManager.h"
 #include "../Systems/MessageSystem.h"
 #include "../Utils/Vector2D.h"
 #include "AiMonster.h"
@@ -76,7 +77,7 @@ void AiSpider::update(Creature& owner, GameContext& ctx)
 				{
 					// Surprise attack gets a damage bonus - use proper damage system
 					int normalDamage = owner.attacker->roll_damage(ctx.dice);
-					int bonusDamage = ctx.dice->roll(1, 2); // Ambush damage bonus
+					int bonusDamage = ctx.dice->ai().roll(1, 2); // Ambush damage bonus
 					int totalDamage = normalDamage + bonusDamage;
 
 					ctx.messageSystem->message(owner.actorData.color, owner.actorData.name);
@@ -114,7 +115,7 @@ void AiSpider::update(Creature& owner, GameContext& ctx)
 			ambushChance += 20; // Higher ambush chance when player is close
 		}
 
-		if (ctx.dice->d100() <= ambushChance)
+		if (ctx.dice->ai().d100() <= ambushChance)
 		{
 			// Find a good ambush position
 			std::optional<Vector2D> ambushPos = find_ambush_position(owner, ctx.player->position, ctx);
@@ -122,12 +123,12 @@ void AiSpider::update(Creature& owner, GameContext& ctx)
 			if (ambushPos && !ctx.map->get_actor(*ambushPos, ctx))
 			{
 				// Move to ambush position
-				owner.position = *ambushPos;
+				ctx.creatureManager->move_creature(owner, *ambushPos);
 				isAmbushing = true;
 				ambushCounter = AMBUSH_DURATION;
 
 				// Debug log
-				ctx.messageSystem->log("Spider setting ambush at " + std::to_string(ambushPos->x) + "," + std::to_string(ambushPos->y));
+				ctx.messageSystem->debug("Spider setting ambush at {},{}", ambushPos->x, ambushPos->y);
 
 				return;
 			}
@@ -179,7 +180,7 @@ void AiSpider::update(Creature& owner, GameContext& ctx)
 	else
 	{
 		// Occasional random movement
-		if (ctx.dice->d20() == 1)
+		if (ctx.dice->ai().d20() == 1)
 		{
 			random_move(owner, ctx);
 		}
@@ -199,7 +200,7 @@ void AiSpider::move_toward_player(Creature& owner, GameContext& ctx)
 	// Check if the move is valid
 	if (ctx.map->can_walk(newPos, ctx) && !ctx.map->get_actor(newPos, ctx))
 	{
-		owner.position = newPos;
+		ctx.creatureManager->move_creature(owner, newPos);
 	}
 	else
 	{
@@ -207,7 +208,7 @@ void AiSpider::move_toward_player(Creature& owner, GameContext& ctx)
 		newPos = owner.position + Vector2D{ dx, 0 };
 		if (ctx.map->can_walk(newPos, ctx) && !ctx.map->get_actor(newPos, ctx))
 		{
-			owner.position = newPos;
+			ctx.creatureManager->move_creature(owner, newPos);
 		}
 		else
 		{
@@ -215,7 +216,7 @@ void AiSpider::move_toward_player(Creature& owner, GameContext& ctx)
 			newPos = owner.position + Vector2D{ 0, dy };
 			if (ctx.map->can_walk(newPos, ctx) && !ctx.map->get_actor(newPos, ctx))
 			{
-				owner.position = newPos;
+				ctx.creatureManager->move_creature(owner, newPos);
 			}
 		}
 	}
@@ -223,15 +224,15 @@ void AiSpider::move_toward_player(Creature& owner, GameContext& ctx)
 
 void AiSpider::random_move(Creature& owner, GameContext& ctx)
 {
-	int dx = ctx.dice->roll(-1, 1);
-	int dy = ctx.dice->roll(-1, 1);
+	int dx = ctx.dice->ai().roll(-1, 1);
+	int dy = ctx.dice->ai().roll(-1, 1);
 
 	if (dx != 0 || dy != 0)
 	{
 		Vector2D newPos = owner.position + Vector2D{ dx, dy };
 		if (ctx.map->can_walk(newPos, ctx) && !ctx.map->get_actor(newPos, ctx))
 		{
-			owner.position = newPos;
+			ctx.creatureManager->move_creature(owner, newPos);
 		}
 	}
 }
@@ -338,7 +339,7 @@ void AiSpider::move_or_attack(Creature& owner, Vector2D targetPosition, GameCont
 	// Move to best position - final validation to prevent stacking
 	if (bestMove != owner.position && !ctx.map->get_actor(bestMove, ctx))
 	{
-		owner.position = bestMove;
+		ctx.creatureManager->move_creature(owner, bestMove);
 	}
 }
 
@@ -351,7 +352,7 @@ bool AiSpider::can_poison_attack(Creature& owner, GameContext& ctx)
 	}
 
 	// Roll for poison chance (set at construction by spider type)
-	return ctx.dice->d100() <= poisonChance;
+	return ctx.dice->ai().d100() <= poisonChance;
 }
 
 void AiSpider::poison_attack(Creature& owner, Creature& target, GameContext& ctx)
@@ -360,7 +361,7 @@ void AiSpider::poison_attack(Creature& owner, Creature& target, GameContext& ctx
 	if (&target == ctx.player)
 	{
 		// Calculate poison damage (1-3 points)
-		int poisonDamage = ctx.dice->roll(1, 3);
+		int poisonDamage = ctx.dice->ai().roll(1, 3);
 
 		// Display poison message with damage amount
 		ctx.messageSystem->message(RED_BLACK_PAIR, owner.actorData.name);
@@ -418,7 +419,7 @@ std::optional<Vector2D> AiSpider::find_ambush_position(Creature& owner, Vector2D
 	// Pick a random good position if available
 	if (!candidates.empty())
 	{
-		int index = ctx.dice->roll(0, static_cast<int>(candidates.size()) - 1);
+		int index = ctx.dice->ai().roll(0, static_cast<int>(candidates.size()) - 1);
 		return candidates.at(index);
 	}
 
@@ -91,7 +91,7 @@ void AiWebSpinner::update(Creature& owner, GameContext& ctx)
 	else
 	{
 		// Occasional random movement
-		if (ctx.dice->d20() == 1)
+		if (ctx.dice->ai().d20() == 1)
 		{
 			random_move(owner, ctx);
 		}
@@ -111,7 +111,7 @@ bool AiWebSpinner::should_create_web(Creature& owner, GameContext& ctx)
 	if (has_laid_web())
 	{
 		// Reduced chance if already laid a web (20% instead of 40%)
-		if (distToPlayer <= 10 && ctx.dice->d100() < 20)
+		if (distToPlayer <= 10 && ctx.dice->ai().d100() < 20)
 		{
 			return true;
 		}
@@ -120,14 +120,14 @@ bool AiWebSpinner::should_create_web(Creature& owner, GameContext& ctx)
 	{
 		// Higher chance if hasn't laid a web yet
 		// If player is nearby, moderate chance to create defensive web
-		if (distToPlayer <= 10 && ctx.dice->d100() < 40)
+		if (distToPlayer <= 10 && ctx.dice->ai().d100() < 40)
 		{
 			return true;
 		}
 	}
 
 	// Even if player is far, occasional web creation for traps (10% chance)
-	if (ctx.dice->d100() < 10)
+	if (ctx.dice->ai().d100() < 10)
 	{
 		return true;
 	}
@@ -270,7 +270,7 @@ void AiWebSpinner::generate_web_entities(Vector2D center, int size, GameContext&
 	};
 
 	// Choose a random pattern
-	WebPattern pattern = static_cast<WebPattern>(ctx.dice->roll(0, 3));
+	WebPattern pattern = static_cast<WebPattern>(ctx.dice->ai().roll(0, 3));
 
 	// Track positions where we want to create webs
 	std::vector<Vector2D> webPositions;
@@ -288,7 +288,7 @@ void AiWebSpinner::generate_web_entities(Vector2D center, int size, GameContext&
 
 				// Create web with higher density near the edges
 				if (normalizedDist <= 1.0f &&
-					(normalizedDist >= 0.7f || ctx.dice->d100() < 40))
+					(normalizedDist >= 0.7f || ctx.dice->ai().d100() < 40))
 				{
 
 					Vector2D pos = center + Vector2D{ x, y };
@@ -327,12 +327,12 @@ void AiWebSpinner::generate_web_entities(Vector2D center, int size, GameContext&
 				angle += 0.5f;
 
 				// Add some random offshoots from the spiral
-				if (ctx.dice->d100() < 30)
+				if (ctx.dice->ai().d100() < 30)
 				{
 					for (int j = 1; j <= 3; j++)
 					{
-						int offX = x + ctx.dice->roll(-1, 1);
-						int offY = y + ctx.dice->roll(-1, 1);
+						int offX = x + ctx.dice->ai().roll(-1, 1);
+						int offY = y + ctx.dice->ai().roll(-1, 1);
 
 						Vector2D offPos{ offX, offY };
 						if (is_valid_web_position(offPos, ctx))
@@ -349,7 +349,7 @@ void AiWebSpinner::generate_web_entities(Vector2D center, int size, GameContext&
 		// Create a radial web with spokes and connecting threads
 		{
 			// First create the spokes
-			int numSpokes = 6 + ctx.dice->roll(0, 4); // 6-10 spokes
+			int numSpokes = 6 + ctx.dice->ai().roll(0, 4); // 6-10 spokes
 
 			for (int i = 0; i < numSpokes; i++)
 			{
@@ -406,16 +406,16 @@ void AiWebSpinner::generate_web_entities(Vector2D center, int size, GameContext&
 			}
 
 			// Then create random strands extending outward
-			for (int strand = 0; strand < 8 + ctx.dice->roll(0, 7); strand++)
+			for (int strand = 0; strand < 8 + ctx.dice->ai().roll(0, 7); strand++)
 			{
 				Vector2D strandPos = center;
-				int strandLength = ctx.dice->roll(3, size);
+				int strandLength = ctx.dice->ai().roll(3, size);
 
 				for (int step = 0; step < strandLength; step++)
 				{
 					// Random direction but with bias toward continuing current direction
-					int dx = ctx.dice->roll(-1, 1);
-					int dy = ctx.dice->roll(-1, 1);
+					int dx = ctx.dice->ai().roll(-1, 1);
+					int dy = ctx.dice->ai().roll(-1, 1);
 
 					strandPos.x += dx;
 					strandPos.y += dy;
@@ -430,15 +430,15 @@ void AiWebSpinner::generate_web_entities(Vector2D center, int size, GameContext&
 					}
 
 					// Occasionally branch the strand
-					if (ctx.dice->d100() < 30)
+					if (ctx.dice->ai().d100() < 30)
 					{
 						Vector2D branchPos = strandPos;
-						int branchLength = ctx.dice->roll(2, 4);
+						int branchLength = ctx.dice->ai().roll(2, 4);
 
 						for (int bStep = 0; bStep < branchLength; bStep++)
 						{
-							branchPos.x += ctx.dice->roll(-1, 1);
-							branchPos.y += ctx.dice->roll(-1, 1);
+							branchPos.x += ctx.dice->ai().roll(-1, 1);
+							branchPos.y += ctx.dice->ai().roll(-1, 1);
 
 							if (is_valid_web_position(branchPos, ctx))
 							{
@@ -461,10 +461,10 @@ void AiWebSpinner::generate_web_entities(Vector2D center, int size, GameContext&
 	{
 		// Set variable web strength
 		int webStrength = WEB_STRENGTH;
-		if (ctx.dice->d100() < 25)
+		if (ctx.dice->ai().d100() < 25)
 		{
 			// Some webs are stronger or weaker
-			webStrength += ctx.dice->roll(-1, 2);
+			webStrength += ctx.dice->ai().roll(-1, 2);
 		}
 
 		// Create a new Web entity
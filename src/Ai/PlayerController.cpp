@@ -3,6 +3,7 @@
 #include <cassert>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -31,6 +32,7 @@
 #include "../Renderer/Renderer.h"
 #include "../Systems/CreatureManager.h"
 #include "../Systems/DisplayManager.h"
+#include "../Systems/GameStateManager.h"
 #include "../Systems/InputHandler.h"
 #include "../Systems/LevelManager.h"
 #include "../Systems/Shopkeepers/ShopkeeperFactory.h"
@@ -369,9 +371,7 @@ bool PlayerController::look_to_attack(Vector2D& target, GameContext& ctx)
 			--decor->hp;
 			if (decor->hp <= 0)
 			{
-				decor->isBroken = true;
-				if (ctx.decorEditor)
-					ctx.decorEditor->erase(decor->position.x, decor->position.y);
+				ctx.map->break_decoration(*decor, ctx);
 
 				ctx.messageSystem->message(
 					WHITE_BLACK_PAIR,
@@ -470,6 +470,12 @@ bool PlayerController::look_to_move(const Vector2D& targetPosition, GameContext&
 
 bool PlayerController::resolve_mouse_world_tile(GameContext& ctx, Vector2D& out_world_tile) const
 {
+	if (const std::optional<Vector2D> tile = ctx.inputHandler->get_click_tile())
+	{
+		out_world_tile = *tile;
+		return ctx.map->is_in_bounds(out_world_tile);
+	}
+
 	if (!ctx.renderer || !ctx.inputSystem)
 		return false;
 
@@ -481,6 +487,7 @@ bool PlayerController::resolve_mouse_world_tile(GameContext& ctx, Vector2D& out_
 		ctx.renderer->get_camera_x(),
 		ctx.renderer->get_camera_y(),
 		tileSize);
+	ctx.inputHandler->set_click_tile(out_world_tile); // recorded with the step
 
 	return ctx.map->is_in_bounds(out_world_tile);
 }
@@ -612,14 +619,13 @@ void PlayerController::begin_path_walk(
 		return;
 	}
 
-	auto path = ctx.pathfinder->a_star_search(*ctx.map, ctx.player->position, walkDest, true, ctx);
-
-	if (path.empty())
+	if (!ctx.pathfinder->find_path(*ctx.map, ctx.player->position, walkDest, PathAlgorithm::JUMP_POINT, ctx, pathScratch))
 	{
 		return;
 	}
 
-	*ctx.mousePathOverlay = std::move(path);
+	// Swap keeps both buffers' capacity, so repeated clicks stop allocating.
+	ctx.mousePathOverlay->swap(pathScratch);
 	mouseMode = mode;
 	mouseDoorAction = doorAction;
 	mouseDoorTarget = actionTarget;
@@ -1043,6 +1049,15 @@ void PlayerController::call_action(Controls key, GameContext& ctx)
 	case Controls::DEBUG:
 	{
 		ctx.messageSystem->display_debug_messages();
+		try
+		{
+			ctx.stateManager->export_json(ctx);
+			ctx.messageSystem->message(WHITE_BLACK_PAIR, "DEBUG: Game state exported to saves/game.json.", true);
+		}
+		catch (const std::exception& e)
+		{
+			ctx.messageSystem->debug("JSON export failed: {}", e.what());
+		}
 		break;
 	}
 
@@ -3,6 +3,8 @@
 // Not an AI -- does not inherit from Ai. Player owns this; monsters never touch it.
 #pragma once
 
+#include <vector>
+
 #include "../Core/GameContext.h"
 #include "../Persistent/Persistent.h"
 
@@ -42,6 +44,7 @@ private:
 	MouseMode mouseMode{ MouseMode::IDLE };
 	PendingDoorAction mouseDoorAction{ PendingDoorAction::NONE };
 	Vector2D mouseDoorTarget{ -1, -1 };
+	std::vector<Vector2D> pathScratch; // A* output buffer, swapped into the overlay on success
 
 	void move(Vector2D target);
 	void pick_item(GameContext& ctx);
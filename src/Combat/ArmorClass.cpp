@@ -33,14 +33,14 @@ void ArmorClass::update(Creature& owner, GameContext& ctx)
 
 		if (&owner == ctx.player)
 		{
-			ctx.messageSystem->log(std::format(
+			ctx.messageSystem->debug(
 				"Armor Class updated: {} -> {} (Base: {}, Dex: {:+}, Equipment: {:+}, Temp: {:+})",
 				oldAC,
 				calculatedAC,
 				baseAC,
 				dexBonus,
 				equipBonus,
-				tempBonus));
+				tempBonus);
 		}
 	}
 }
@@ -59,10 +59,10 @@ void ArmorClass::update(Creature& owner, GameContext& ctx)
 
 	if (&owner == ctx.player && defensiveAdj != 0)
 	{
-		ctx.messageSystem->log(std::format(
+		ctx.messageSystem->debug(
 			"Dexterity Defensive Adjustment: {:+} (Dex: {})",
 			defensiveAdj,
-			dexterity));
+			dexterity);
 	}
 
 	return defensiveAdj;
@@ -87,10 +87,10 @@ void ArmorClass::update(Creature& owner, GameContext& ctx)
 
 			if (&owner == ctx.player)
 			{
-				ctx.messageSystem->log(std::format(
+				ctx.messageSystem->debug(
 					"Armor bonus: {:+} from {}",
 					armorBonus,
-					equippedArmor->actorData.name));
+					equippedArmor->actorData.name);
 			}
 		}
 	}
@@ -110,10 +110,10 @@ void ArmorClass::update(Creature& owner, GameContext& ctx)
 
 			if (&owner == ctx.player)
 			{
-				ctx.messageSystem->log(std::format(
+				ctx.messageSystem->debug(
 					"Shield bonus: {:+} from {}",
 					shieldBonus,
-					equippedShield->actorData.name));
+					equippedShield->actorData.name);
 			}
 		}
 	}
@@ -141,10 +141,10 @@ void ArmorClass::update(Creature& owner, GameContext& ctx)
 
 		if (&owner == ctx.player)
 		{
-			ctx.messageSystem->log(std::format(
+			ctx.messageSystem->debug(
 				"Ring bonus: {:+} from {}",
 				bestRingBonus,
-				bestRing->actorData.name));
+				bestRing->actorData.name);
 		}
 	}
 
@@ -157,10 +157,10 @@ void ArmorClass::update(Creature& owner, GameContext& ctx)
 
 			if (&owner == ctx.player)
 			{
-				ctx.messageSystem->log(std::format(
+				ctx.messageSystem->debug(
 					"Helm bonus: {:+} from {}",
 					helmBonus,
-					equippedHelm->actorData.name));
+					equippedHelm->actorData.name);
 			}
 		}
 	}
@@ -44,7 +44,7 @@ struct DamageInfo
 	{
 		if (minDamage == maxDamage)
 			return minDamage;
-		return dice->roll(minDamage, maxDamage);
+		return dice->combat().roll(minDamage, maxDamage);
 	}
 
 	int get_average_damage() const { return (minDamage + maxDamage) / 2; }
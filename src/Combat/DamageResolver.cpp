@@ -63,13 +63,13 @@ int DamageResolver::apply_resistances(
 		? damageTypeNames.at(damageType)
 		: "unknown";
 
-	ctx.messageSystem->log(std::format(
+	ctx.messageSystem->debug(
 		"You resisted {} {} damage! ({}% resistance, {} -> {})",
 		damageReduced,
 		typeName,
 		resistancePercent,
 		originalDamage,
-		damage));
+		damage);
 
 	return damage;
 }
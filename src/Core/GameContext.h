@@ -12,6 +12,7 @@
 struct Game;
 class Map;
 class Minimap;
+class ProfilerOverlay;
 struct Decoration;
 class TileConfig;
 class Gui;
@@ -19,8 +20,10 @@ class MessageSystem;
 class RandomDice;
 class CreatureManager;
 class LevelManager;
+class LevelGenerator;
 class RenderingManager;
 class InputHandler;
+class InputRecorder;
 class GameStateManager;
 class MenuManager;
 class DisplayManager;
@@ -145,8 +148,10 @@ struct GameContext
 	// Managers
 	CreatureManager* creatureManager{ nullptr };
 	LevelManager* levelManager{ nullptr };
+	LevelGenerator* levelGenerator{ nullptr };
 	RenderingManager* renderingManager{ nullptr };
 	InputHandler* inputHandler{ nullptr };
+	InputRecorder* inputRecorder{ nullptr };
 	GameStateManager* stateManager{ nullptr };
 	MenuManager* menuManager{ nullptr };
 	DisplayManager* displayManager{ nullptr };
@@ -166,6 +171,7 @@ struct GameContext
 	CurseSystem* curseSystem{ nullptr };
 	ContentRegistry* contentRegistry{ nullptr };
 	Minimap* minimap{ nullptr };
+	ProfilerOverlay* profilerOverlay{ nullptr };
 	Dijkstra* pathfinder{ nullptr };  // Persistent pathfinding object (reused across turns)
 	DecorEditor* decorEditor{ nullptr };
 	PrefabLibrary* prefabLibrary{ nullptr };
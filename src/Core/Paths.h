@@ -11,6 +11,11 @@ namespace Paths
 {
 inline constexpr std::string_view LOG      = "clog.txt";
 inline constexpr std::string_view SAVE_FILE = "saves/game->sav";
+inline constexpr std::string_view SAVE_JSON_EXPORT = "saves/game.json";
+inline constexpr std::string_view AUTOSAVE_SLOT_A = "saves/autosave-a.sav";
+inline constexpr std::string_view AUTOSAVE_SLOT_B = "saves/autosave-b.sav";
+inline constexpr std::string_view PROFILE_TRACE = "profile_trace.json";
+inline constexpr std::string_view PROFILE_CSV = "profile.csv";
 
 inline constexpr std::string_view DAWNLIKE_DIR = "DawnLike";
 inline constexpr std::string_view DAWNLIKE_FONT = "DawnLike/GUI/SDS_8x8.ttf";
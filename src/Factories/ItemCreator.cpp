@@ -1399,7 +1399,7 @@ std::unique_ptr<Item> ItemCreator::create_with_enhancement(
 
 std::unique_ptr<Item> ItemCreator::create_gold_pile(Vector2D pos, GameContext& ctx)
 {
-	const int goldAmount = ctx.dice->roll(5, 20);
+	const int goldAmount = ctx.dice->loot().roll(5, 20);
 
 	return create_with_gold_amount(pos, goldAmount, *ctx.contentRegistry);
 }
@@ -1446,7 +1446,7 @@ std::unique_ptr<Item> ItemCreator::create_random_of_category(
 		return nullptr;
 	}
 
-	int roll = ctx.dice->roll(1, totalWeight);
+	int roll = ctx.dice->loot().roll(1, totalWeight);
 	for (const auto& [key, weight] : candidates)
 	{
 		roll -= weight;
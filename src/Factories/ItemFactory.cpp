@@ -58,7 +58,7 @@ void ItemFactory::load_from_registry()
 				  [](Vector2D pos, GameContext& ctx)
 				  {
 					  const int level = ctx.levelManager->get_dungeon_level();
-					  const int amount = ctx.dice->roll(level * 3, level * 10);
+					  const int amount = ctx.dice->loot().roll(level * 3, level * 10);
 					  assert(InventoryOperations::add_item(
 						  *ctx.floorInventory,
 						  ItemCreator::create_with_gold_amount(pos, amount, *ctx.contentRegistry)).has_value());
@@ -98,11 +98,11 @@ void ItemFactory::load_enhanced_rules(std::span<const EnhancedItemSpawnRule> rul
 				rule.category,
 				[rule](Vector2D pos, GameContext& ctx)
 				{
-					const int idx = ctx.dice->roll(0, static_cast<int>(rule.itemPool.size()) - 1);
+					const int idx = ctx.dice->loot().roll(0, static_cast<int>(rule.itemPool.size()) - 1);
 					const std::string_view baseKey = rule.itemPool[idx];
 					if (rule.enhancementCategory == EnhancedItemCategory::WEAPON)
 					{
-						auto enh = ItemEnhancement::generate_weapon_enhancement();
+						auto enh = ItemEnhancement::generate_weapon_enhancement(*ctx.dice);
 						assert(InventoryOperations::add_item(
 							*ctx.floorInventory,
 							ItemCreator::create_with_enhancement(
@@ -110,7 +110,7 @@ void ItemFactory::load_enhanced_rules(std::span<const EnhancedItemSpawnRule> rul
 					}
 					else
 					{
-						auto enh = ItemEnhancement::generate_armor_enhancement();
+						auto enh = ItemEnhancement::generate_armor_enhancement(*ctx.dice);
 						assert(InventoryOperations::add_item(
 							*ctx.floorInventory,
 							ItemCreator::create_with_enhancement(
@@ -132,19 +132,19 @@ void ItemFactory::generate_treasure(Vector2D position, GameContext& ctx, int dun
 
 	case 1:
 	{
-		itemCount = ctx.dice->roll(1, 2);
+		itemCount = ctx.dice->loot().roll(1, 2);
 		break;
 	}
 
 	case 2:
 	{
-		itemCount = ctx.dice->roll(2, 3);
+		itemCount = ctx.dice->loot().roll(2, 3);
 		break;
 	}
 
 	case 3:
 	{
-		itemCount = ctx.dice->roll(3, 5);
+		itemCount = ctx.dice->loot().roll(3, 5);
 		break;
 	}
 
@@ -160,7 +160,7 @@ void ItemFactory::generate_treasure(Vector2D position, GameContext& ctx, int dun
 	// Always include gold with amount based on quality
 	int goldMin = 10 * dungeonLevel * quality;
 	int goldMax = 20 * dungeonLevel * quality;
-	int goldAmount = ctx.dice->roll(goldMin, goldMax);
+	int goldAmount = ctx.dice->loot().roll(goldMin, goldMax);
 
 	// Create gold pile
 	auto goldPile = std::make_unique<Item>(position, ActorData{ ctx.tileConfig->get("TILE_GOLD"), "gold pile", YELLOW_BLACK_PAIR });
@@ -172,8 +172,8 @@ void ItemFactory::generate_treasure(Vector2D position, GameContext& ctx, int dun
 	{
 		// Small offset to avoid items on same tile
 		Vector2D itemPos = position;
-		itemPos.x += ctx.dice->roll(-1, 1);
-		itemPos.y += ctx.dice->roll(-1, 1);
+		itemPos.x += ctx.dice->loot().roll(-1, 1);
+		itemPos.y += ctx.dice->loot().roll(-1, 1);
 
 		// Ensure position is valid
 		if (!ctx.map->can_walk(itemPos, ctx))
@@ -182,12 +182,12 @@ void ItemFactory::generate_treasure(Vector2D position, GameContext& ctx, int dun
 		}
 
 		// Determine item type with biased probabilities
-		int roll = ctx.dice->d100();
+		int roll = ctx.dice->loot().d100();
 
 		if (quality == 3 && roll <= 5)
 		{
 			// 5% chance of very special items in exceptional quality treasure
-			if (effectiveLevel >= 8 && ctx.dice->d100() <= 10)
+			if (effectiveLevel >= 8 && ctx.dice->loot().d100() <= 10)
 			{
 				// 10% chance for Amulet at high enough level
 				spawn_item_of_category(itemPos, ctx, effectiveLevel, "artifact");
@@ -220,8 +220,7 @@ void ItemFactory::generate_treasure(Vector2D position, GameContext& ctx, int dun
 		}
 	}
 
-	ctx.messageSystem->log("Generated treasure of quality " + std::to_string(quality) +
-		" with " + std::to_string(itemCount + 1) + " items including gold");
+	ctx.messageSystem->debug("Generated treasure of quality {} with {} items including gold", quality, itemCount + 1);
 }
 
 // Get the probability distribution for the current dungeon level
@@ -260,7 +259,7 @@ void ItemFactory::spawn_item_of_category(Vector2D position, GameContext& ctx, in
 	auto it = itemCategories.find(category);
 	if (it == itemCategories.end() || it->second.empty())
 	{
-		ctx.messageSystem->log("No items found in category: " + category);
+		ctx.messageSystem->debug("No items found in category: {}", category);
 		return;
 	}
 
@@ -280,12 +279,12 @@ void ItemFactory::spawn_item_of_category(Vector2D position, GameContext& ctx, in
 	// If no valid items for this level in this category, do nothing
 	if (totalWeight <= 0)
 	{
-		ctx.messageSystem->log("No valid items in category " + category + " for this dungeon level!");
+		ctx.messageSystem->debug("No valid items in category {} for this dungeon level!", category);
 		return;
 	}
 
 	// Roll random number and select item
-	int roll = ctx.dice->roll(1, totalWeight);
+	int roll = ctx.dice->loot().roll(1, totalWeight);
 	int runningTotal = 0;
 
 	for (size_t i = 0; i < indices.size(); i++)
@@ -322,7 +321,7 @@ void ItemFactory::spawn_random_item(Vector2D position, GameContext& ctx, int dun
 	}
 
 	// Roll random number and select item
-	int roll = ctx.dice->roll(1, totalWeight);
+	int roll = ctx.dice->loot().roll(1, totalWeight);
 	int runningTotal = 0;
 
 	for (size_t i = 0; i < itemTypes.size(); i++)
@@ -362,19 +361,19 @@ void ItemFactory::spawn_all_enhanced_items_debug(Vector2D position, GameContext&
 	{
 		for (const auto& rule : rules)
 		{
-			const int idx = ctx.dice->roll(
+			const int idx = ctx.dice->loot().roll(
 				0, static_cast<int>(rule.itemPool.size()) - 1);
 			const std::string_view baseKey = rule.itemPool[idx];
 			if (rule.enhancementCategory == EnhancedItemCategory::WEAPON)
 			{
-				auto enh = ItemEnhancement::generate_weapon_enhancement();
+				auto enh = ItemEnhancement::generate_weapon_enhancement(*ctx.dice);
 				assert(InventoryOperations::add_item(
 					*ctx.floorInventory,
 					ItemCreator::create_with_enhancement(baseKey, position, enh.prefix, enh.suffix, *ctx.contentRegistry)).has_value());
 			}
 			else
 			{
-				auto enh = ItemEnhancement::generate_armor_enhancement();
+				auto enh = ItemEnhancement::generate_armor_enhancement(*ctx.dice);
 				assert(InventoryOperations::add_item(
 					*ctx.floorInventory,
 					ItemCreator::create_with_enhancement(baseKey, position, enh.prefix, enh.suffix, *ctx.contentRegistry)).has_value());
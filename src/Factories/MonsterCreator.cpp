@@ -234,22 +234,6 @@ nlohmann::json encode_full_params(const MonsterParams& p)
 	};
 }
 
-int roll_dice(RandomDice* dice, const DiceExpr& expr)
-{
-	if (expr.num == 0)
-	{
-		return 0;
-	}
-
-	int total = 0;
-	for (int i = 0; i < expr.num; ++i)
-	{
-		total += dice->roll(1, expr.sides);
-	}
-
-	return total + expr.bonus;
-}
-
 // ---------------------------------------------------------------------------
 // String-key helpers
 // ---------------------------------------------------------------------------
@@ -525,19 +509,19 @@ std::unique_ptr<Creature> MonsterCreator::create_from_params(
 {
 	auto c = std::make_unique<Creature>(pos, ActorData{ params.symbol, params.name, params.color });
 
-	c->set_strength(std::max(1, roll_dice(ctx.dice, params.strDice)));
-	c->set_dexterity(std::max(1, roll_dice(ctx.dice, params.dexDice)));
-	c->set_constitution(std::max(1, roll_dice(ctx.dice, params.conDice)));
-	c->set_intelligence(std::max(1, roll_dice(ctx.dice, params.intDice)));
-	c->set_wisdom(std::max(1, roll_dice(ctx.dice, params.wisDice)));
-	c->set_charisma(std::max(1, roll_dice(ctx.dice, params.chaDice)));
+	c->set_strength(std::max(1, ctx.dice->mapgen().roll(params.strDice)));
+	c->set_dexterity(std::max(1, ctx.dice->mapgen().roll(params.dexDice)));
+	c->set_constitution(std::max(1, ctx.dice->mapgen().roll(params.conDice)));
+	c->set_intelligence(std::max(1, ctx.dice->mapgen().roll(params.intDice)));
+	c->set_wisdom(std::max(1, ctx.dice->mapgen().roll(params.wisDice)));
+	c->set_charisma(std::max(1, ctx.dice->mapgen().roll(params.chaDice)));
 
 	c->set_weapon_equipped(params.weaponName);
 	c->set_morale(params.morale);
 	c->set_corpse_weight(params.corpseWeight);
 	c->set_creature_level(params.hpDice.num);
 
-	const int hp = std::max(1, roll_dice(ctx.dice, params.hpDice));
+	const int hp = std::max(1, ctx.dice->mapgen().roll(params.hpDice));
 
 	c->attacker = std::make_unique<MonsterAttacker>(*c, params.damage);
 	c->experienceReward = std::make_unique<ExperienceReward>(params.xp);
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "../Combat/DamageInfo.h"
+#include "../Random/RandomDice.h"
 #include "../Renderer/Renderer.h"
 
 // Forward declarations
@@ -43,14 +44,6 @@ enum class MonsterAiType
 	RANGED,
 };
 
-// Dice expression: roll num dice of sides sides, add bonus. num=0 means skip.
-struct DiceExpr
-{
-	int num{ 0 };
-	int sides{ 0 };
-	int bonus{ 0 };
-};
-
 struct MonsterParams
 {
 	// Identity
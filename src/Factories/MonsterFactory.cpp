@@ -125,7 +125,7 @@ MonsterFactory::MonsterFactory()
 				if (ShopkeeperFactory::should_spawn_shopkeeper(dungeonLevel, ctx))
 				{
 					ctx.creatures->push_back(ShopkeeperFactory::create_shopkeeper(pos, dungeonLevel, ctx));
-					ctx.messageSystem->log("Shopkeeper spawned at level " + std::to_string(dungeonLevel));
+					ctx.messageSystem->debug("Shopkeeper spawned at level {}", dungeonLevel);
 				}
 				else
 				{
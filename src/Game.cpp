@@ -1,4 +1,5 @@
 #include "Game.h"
+#include "Systems/Profiler.h"
 
 // Single source of truth: build context from owned systems
 [[nodiscard]] GameContext Game::context() noexcept
@@ -18,8 +19,10 @@
 		// Managers
 		.creatureManager = &creatureManager,
 		.levelManager = &levelManager,
+		.levelGenerator = &levelGenerator,
 		.renderingManager = &renderingManager,
 		.inputHandler = &inputHandler,
+		.inputRecorder = &inputRecorder,
 		.stateManager = &stateManager,
 		.menuManager = &menuManager,
 		.displayManager = &displayManager,
@@ -39,6 +42,7 @@
 		.curseSystem = &curseSystem,
 		.contentRegistry = &contentRegistry,
 		.minimap = &minimap,
+		.profilerOverlay = &profilerOverlay,
 		.pathfinder = &pathfinder,
 
 		.decorEditor = &decorEditor,
@@ -79,6 +83,8 @@ bool Game::tick(int& loopNum)
 		return false;
 	}
 
+	PROFILE_FRAME();
+
 #ifndef EMSCRIPTEN
 	if (roomEditor.is_active())
 	{
@@ -102,12 +108,18 @@ bool Game::tick(int& loopNum)
 		gameState.set_window_state(menus.empty() ? WindowState::GAME : WindowState::MENU);
 	}
 
+	if (gameState.get_window_state() != WindowState::GAME && gameState.get_window_state() != WindowState::MENU)
+	{
+		levelGenerator.discard(); // editors change what the next level is built from
+	}
+
 	auto ctx = context();
 	switch (gameState.get_window_state())
 	{
 
 	case WindowState::MENU:
 	{
+		PROFILE_ZONE("menus");
 		menuManager.handle_menus(menus, ctx);
 		break;
 	}
@@ -165,6 +177,8 @@ void Game::init_world()
 // Save on exit if needed
 void Game::shutdown()
 {
+	minimap.unload();
+	inputRecorder.finish(context());
 	if (gameState.get_should_save())
 	{
 		try
@@ -174,7 +188,7 @@ void Game::shutdown()
 		}
 		catch (const std::exception& e)
 		{
-			messageSystem.log("Error saving: " + std::string(e.what()));
+			messageSystem.debug("Error saving: {}", e.what());
 		}
 	}
 }
@@ -11,8 +11,10 @@
 #include "ActorTypes/Player.h"
 #include "Core/GameContext.h"
 #include "Gui/Gui.h"
+#include "Gui/ProfilerOverlay.h"
 #include "Map/Decoration.h"
 #include "Map/DungeonRoom.h"
+#include "Map/LevelGenerator.h"
 #include "Map/Map.h"
 #include "Map/Minimap.h"
 #include "Menu/BaseMenu.h"
@@ -30,6 +32,7 @@
 #include "Systems/GameStateManager.h"
 #include "Systems/HungerSystem.h"
 #include "Systems/InputHandler.h"
+#include "Systems/InputRecorder.h"
 #include "Systems/LevelManager.h"
 #include "Systems/MenuManager.h"
 #include "Systems/MessageSystem.h"
@@ -62,6 +65,9 @@ struct Game
 	// Minimap overlay
 	Minimap minimap{};
 
+	// Frame profiler overlay (F9)
+	ProfilerOverlay profilerOverlay{};
+
 	// Rendering (raylib)
 	Renderer renderer{};
 	InputSystem inputSystem{};
@@ -71,6 +77,7 @@ struct Game
 	MessageSystem messageSystem{};
 	RenderingManager renderingManager{};
 	InputHandler inputHandler{};
+	InputRecorder inputRecorder{};
 	GameStateManager stateManager{};
 	LevelManager levelManager{};
 	CreatureManager creatureManager{};
@@ -117,6 +124,10 @@ struct Game
 	// Mouse path overlay — persistent across frames, owned here
 	std::vector<Vector2D> mousePathOverlay{};
 
+	// Background generation of the next level -- last so it is destroyed
+	// (and its worker joined) before the content the worker reads.
+	LevelGenerator levelGenerator{};
+
 	[[nodiscard]] GameContext context() noexcept;
 	bool tick(int& loopNum);
 	void init_world();
@@ -71,6 +71,10 @@ void Gui::gui_update(GameContext& ctx)
 void Gui::gui_render(const GameContext& ctx)
 {
 	assert(ctx.renderer && "Gui::gui_render called without a renderer");
+	if (!ctx.renderer->is_initialized())
+	{
+		return;
+	}
 
 	const int tileSize = ctx.renderer->get_tile_size();
 	const int vcols = ctx.renderer->get_viewport_cols();
@@ -0,0 +1,116 @@
+// ProfilerOverlay.cpp -- frame-time graph and top zones over the game view.
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <raylib.h>
+
+#include "../Core/Paths.h"
+#include "../Renderer/Renderer.h"
+#include "../Systems/Profiler.h"
+#include "../Utils/Vector2D.h"
+#include "ProfilerOverlay.h"
+
+namespace
+{
+	constexpr double FRAME_BUDGET_MS = 1000.0 / 60.0;
+
+	double to_ms(int64_t ns) noexcept
+	{
+		return static_cast<double>(ns) / 1'000'000.0;
+	}
+
+	Color bar_color(double ms) noexcept
+	{
+		if (ms <= FRAME_BUDGET_MS)
+		{
+			return Color{ 80, 200, 90, 255 };
+		}
+		if (ms <= 2.0 * FRAME_BUDGET_MS)
+		{
+			return Color{ 230, 200, 60, 255 };
+		}
+		return Color{ 230, 70, 60, 255 };
+	}
+} // namespace
+
+void ProfilerOverlay::render(const Renderer& renderer) const
+{
+	if (!visible)
+	{
+		return;
+	}
+
+	const Profiler& profiler = Profiler::instance();
+	const size_t frames = profiler.frame_count();
+	const int lineHeight = renderer.get_font_size() + 2;
+	const int panelW = static_cast<int>(Profiler::FRAME_HISTORY) * BAR_WIDTH;
+	const int panelH = GRAPH_HEIGHT + PADDING + (2 + static_cast<int>(TOP_ZONES)) * lineHeight;
+	const int originX = PADDING;
+	const int originY = PADDING;
+	const Color text{ 230, 230, 230, 255 };
+
+	DrawRectangle(originX - 4, originY - 4, panelW + 8, panelH + 8, Color{ 0, 0, 0, 200 });
+
+	double totalMs = 0.0;
+	double maxMs = 0.0;
+	for (size_t i = 0; i < frames; ++i)
+	{
+		const double ms = to_ms(profiler.frame(i).durationNs);
+		totalMs += ms;
+		maxMs = std::max(maxMs, ms);
+		const int barH = std::max(1, static_cast<int>(std::min(ms / GRAPH_MAX_MS, 1.0) * GRAPH_HEIGHT));
+		DrawRectangle(originX + static_cast<int>(i) * BAR_WIDTH, originY + GRAPH_HEIGHT - barH, BAR_WIDTH, barH, bar_color(ms));
+	}
+	const int budgetY = originY + GRAPH_HEIGHT - static_cast<int>(FRAME_BUDGET_MS / GRAPH_MAX_MS * GRAPH_HEIGHT);
+	DrawLine(originX, budgetY, originX + panelW, budgetY, Color{ 255, 255, 255, 120 });
+
+	int y = originY + GRAPH_HEIGHT + PADDING;
+	if (frames == 0)
+	{
+		renderer.draw_text_color(Vector2D{ originX, y }, "No frames recorded", text);
+		return;
+	}
+
+	renderer.draw_text_color(
+		Vector2D{ originX, y },
+		std::format("frame {:.2f} ms avg  {:.2f} ms max  ({} frames)", totalMs / static_cast<double>(frames), maxMs, frames),
+		text);
+	y += lineHeight;
+
+	// Turn counters (fov, paths, flow) are zero on frames without a turn, so
+	// each shows the newest frame that counted it.
+	std::string counters;
+	for (size_t c = 0; c < static_cast<size_t>(ProfileCounter::COUNT); ++c)
+	{
+		int64_t latest = 0;
+		for (size_t i = frames; i-- > 0 && latest == 0;)
+		{
+			latest = profiler.frame(i).counters[c];
+		}
+		counters += std::format("{} {}  ", counter_name(static_cast<ProfileCounter>(c)), latest);
+	}
+	renderer.draw_text_color(Vector2D{ originX, y }, counters, text);
+	y += lineHeight;
+
+	for (const ZoneTotal& zone : profiler.top_zones(TOP_ZONES, frames))
+	{
+		renderer.draw_text_color(
+			Vector2D{ originX, y },
+			std::format("{:<14}{:>8.3f} ms/frame{:>7} calls", zone.name, to_ms(zone.totalNs) / static_cast<double>(frames), zone.calls),
+			text);
+		y += lineHeight;
+	}
+}
+
+bool ProfilerOverlay::export_history()
+{
+	std::ofstream trace{ std::string(Paths::PROFILE_TRACE) };
+	Profiler::instance().write_chrome_trace(trace);
+	std::ofstream csv{ std::string(Paths::PROFILE_CSV) };
+	Profiler::instance().write_csv(csv);
+	return trace.good() && csv.good();
+}
@@ -0,0 +1,36 @@
+#pragma once
+// ProfilerOverlay.h -- frame-time graph and top zones over the game view.
+
+#include <cstddef>
+
+class Renderer;
+
+// Drawn in the top-left corner when visible: one bar per frame in the
+// Profiler's history (the line marks 60 fps), the newest value of each
+// counter and the zones that cost the most over the history. Toggled with
+// F9; F10 writes the history to Paths::PROFILE_TRACE and Paths::PROFILE_CSV.
+class ProfilerOverlay
+{
+	static constexpr int PADDING = 8;
+	static constexpr int GRAPH_HEIGHT = 60;
+	static constexpr int BAR_WIDTH = 2;
+	static constexpr double GRAPH_MAX_MS = 33.3; // bars are clipped at two 60 fps frames
+	static constexpr size_t TOP_ZONES = 6;
+
+	bool visible{ false };
+
+public:
+	ProfilerOverlay() = default;
+	~ProfilerOverlay() = default;
+
+	ProfilerOverlay(const ProfilerOverlay&) = delete;
+	ProfilerOverlay& operator=(const ProfilerOverlay&) = delete;
+
+	void toggle() noexcept { visible = !visible; }
+	[[nodiscard]] bool is_visible() const noexcept { return visible; }
+
+	void render(const Renderer& renderer) const;
+
+	// Writes both exports; returns false if either file could not be written.
+	static bool export_history();
+};
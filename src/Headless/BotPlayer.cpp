@@ -0,0 +1,213 @@
+// BotPlayer.cpp -- a simple scripted player for headless runs.
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include "../Actor/Creature.h"
+#include "../Actor/Stairs.h"
+#include "../Ai/Ai.h"
+#include "../Controls/Controls.h"
+#include "../Core/GameContext.h"
+#include "../Map/Map.h"
+#include "../Map/TileGrid.h"
+#include "../Utils/Dijkstra.h"
+#include "BotPlayer.h"
+
+namespace
+{
+	constexpr std::array<std::pair<Vector2D, Controls>, 8> STEPS{ {
+		{ DIR_N, Controls::UP_ARROW },
+		{ DIR_S, Controls::DOWN_ARROW },
+		{ DIR_W, Controls::LEFT_ARROW },
+		{ DIR_E, Controls::RIGHT_ARROW },
+		{ DIR_NW, Controls::KP_NW },
+		{ DIR_NE, Controls::KP_NE },
+		{ DIR_SW, Controls::KP_SW },
+		{ DIR_SE, Controls::KP_SE },
+	} };
+
+	int key_for_step(Vector2D step) noexcept
+	{
+		for (const auto& [direction, key] : STEPS)
+		{
+			if (direction == step)
+			{
+				return static_cast<int>(key);
+			}
+		}
+		return static_cast<int>(Controls::WAIT);
+	}
+
+	bool is_hostile(const Creature& creature) noexcept
+	{
+		return !creature.is_dead() && creature.ai && creature.ai->is_hostile();
+	}
+} // namespace
+
+void BotPlayer::on_new_game(const GameContext& /*ctx*/)
+{
+	path.clear();
+	lastTurn = -1;
+	stalledKeys = 0;
+	lastKeyStepped = false;
+	blockedSteps = 0;
+	doorGoal.reset();
+	refusedDoors.clear();
+	knownStairs.reset();
+}
+
+int BotPlayer::next_key(const GameContext& ctx)
+{
+	const Creature& player = *ctx.player;
+
+	// The previous key did not cost a turn: try something that will.
+	const int turn = ctx.gameState->get_time();
+	stalledKeys = (turn == lastTurn) ? stalledKeys + 1 : 0;
+	lastTurn = turn;
+	if (ctx.stairs && knownStairs != ctx.stairs->position)
+	{
+		knownStairs = ctx.stairs->position; // a new level: its doors are new too
+		doorGoal.reset();
+		refusedDoors.clear();
+	}
+	blockedSteps = (lastKeyStepped && player.position == lastPosition) ? blockedSteps + 1 : 0;
+	lastPosition = player.position;
+	lastKeyStepped = false;
+	if (stalledKeys > 0)
+	{
+		return (stalledKeys % 2 == 1) ? static_cast<int>(Controls::WAIT) : random_step(ctx);
+	}
+
+	bool hostileNear = false;
+	for (const auto& creature : *ctx.creatures)
+	{
+		if (!creature || !is_hostile(*creature))
+		{
+			continue;
+		}
+		const int distance = player.get_tile_distance(creature->position);
+		if (distance <= 1)
+		{
+			return key_for_step(creature->position - player.position);
+		}
+		hostileNear = hostileNear || distance <= SAFE_REST_RADIUS;
+	}
+
+	if (ctx.stairs && ctx.stairs->position == player.position)
+	{
+		return static_cast<int>(Controls::DESCEND);
+	}
+
+	if (!hostileNear && player.get_hp() < player.get_max_hp() / 2)
+	{
+		return static_cast<int>(Controls::REST);
+	}
+
+	return step_towards(choose_target(ctx), ctx);
+}
+
+Vector2D BotPlayer::choose_target(const GameContext& ctx) const
+{
+	const Creature& player = *ctx.player;
+	Vector2D target = ctx.stairs ? ctx.stairs->position : player.position;
+	int bestDistance = std::numeric_limits<int>::max();
+	for (const auto& creature : *ctx.creatures)
+	{
+		if (!creature || !is_hostile(*creature) || !ctx.map->is_in_fov(creature->position))
+		{
+			continue;
+		}
+		const int distance = player.get_tile_distance(creature->position);
+		if (distance <= HUNT_RADIUS && distance < bestDistance)
+		{
+			bestDistance = distance;
+			target = creature->position;
+		}
+	}
+	return target;
+}
+
+int BotPlayer::step_towards(Vector2D target, const GameContext& ctx)
+{
+	const Vector2D from = ctx.player->position;
+	if (blockedSteps >= MAX_BLOCKED_STEPS)
+	{
+		if (doorGoal)
+		{
+			refusedDoors.push_back(*doorGoal); // locked, and the bot cannot get through
+			doorGoal.reset();
+		}
+		return random_step(ctx);
+	}
+
+	if (target == from)
+	{
+		return random_step(ctx);
+	}
+	if (ctx.pathfinder->find_path(*ctx.map, from, target, PathAlgorithm::ASTAR, ctx, path))
+	{
+		doorGoal.reset();
+	}
+	else if (!path_to_door(ctx))
+	{
+		return random_step(ctx);
+	}
+	if (path.size() < 2)
+	{
+		return random_step(ctx);
+	}
+
+	// Never bump a shopkeeper: that opens the trade menu instead of moving.
+	const Creature* blocker = ctx.map->get_actor(path[1], ctx);
+	if (blocker && !is_hostile(*blocker))
+	{
+		return random_step(ctx);
+	}
+	lastKeyStepped = true;
+	return key_for_step(path[1] - from);
+}
+
+bool BotPlayer::path_to_door(const GameContext& ctx)
+{
+	const Map& map = *ctx.map;
+	const Creature& player = *ctx.player;
+	if (doorGoal && map.get_tile_type(*doorGoal) == TileType::CLOSED_DOOR
+		&& ctx.pathfinder->find_path(*ctx.map, player.position, *doorGoal, PathAlgorithm::ASTAR, ctx, path))
+	{
+		return true; // still on the way to the same door
+	}
+
+	std::vector<Vector2D> doors;
+	for (int y = 0; y < map.get_height(); ++y)
+	{
+		for (int x = 0; x < map.get_width(); ++x)
+		{
+			const Vector2D pos{ x, y };
+			if (map.get_tile_type(pos) == TileType::CLOSED_DOOR && std::ranges::find(refusedDoors, pos) == refusedDoors.end())
+			{
+				doors.push_back(pos);
+			}
+		}
+	}
+	std::ranges::sort(doors, {}, [&player](Vector2D door) { return player.get_tile_distance(door); });
+
+	for (size_t i = 0; i < std::min(doors.size(), MAX_DOOR_CANDIDATES); ++i)
+	{
+		if (ctx.pathfinder->find_path(*ctx.map, player.position, doors[i], PathAlgorithm::ASTAR, ctx, path))
+		{
+			doorGoal = doors[i];
+			return true;
+		}
+	}
+	return false;
+}
+
+int BotPlayer::random_step(const GameContext& ctx)
+{
+	const auto& [step, key] = STEPS[rng.roll(0, static_cast<int>(STEPS.size()) - 1)];
+	const Creature* occupant = ctx.map->get_actor(ctx.player->position + step, ctx);
+	lastKeyStepped = true;
+	return (occupant && !is_hostile(*occupant)) ? static_cast<int>(Controls::WAIT) : static_cast<int>(key);
+}
@@ -0,0 +1,57 @@
+#pragma once
+// BotPlayer.h -- a simple scripted player for headless runs.
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "../Random/RandomDice.h"
+#include "../Utils/Vector2D.h"
+#include "HeadlessPlayer.h"
+
+// ---------------------------------------------------------------------------
+// BotPlayer -- dives for the stairs and fights whatever gets in the way.
+//
+// Keys are chosen in priority order: attack an adjacent hostile, descend
+// when standing on the stairs, rest when hurt and nothing hostile is near,
+// otherwise take one A* step towards the nearest hostile in view or else
+// the stairs. A* does not path through closed doors, so when the goal is
+// shut off the bot walks to the nearest closed door and bumps it open; a
+// door that stays shut is skipped for the rest of the level. When a key
+// does not advance the turn (a wall bump, a refused rest), no path exists
+// or steps keep costing turns without moving the bot (a decoration in the
+// way), it waits or steps in a random direction, so a run never stalls.
+// Shopkeepers are walked around, never bumped: trading needs a menu.
+// ---------------------------------------------------------------------------
+class BotPlayer final : public HeadlessPlayer
+{
+public:
+	explicit BotPlayer(unsigned int seed) : rng(seed) {}
+
+	[[nodiscard]] int next_key(const GameContext& ctx) override;
+	void on_new_game(const GameContext& ctx) override;
+
+private:
+	static constexpr int HUNT_RADIUS = 8; // tiles; hostiles further off are ignored
+	static constexpr int SAFE_REST_RADIUS = 6; // Player::rest refuses within 5
+	static constexpr int MAX_BLOCKED_STEPS = 3; // steps that cost a turn but left the bot in place
+	static constexpr size_t MAX_DOOR_CANDIDATES = 8; // nearest closed doors tried when the goal is walled off
+
+	RandomDice rng;
+	std::vector<Vector2D> path;
+	int lastTurn{ -1 };
+	int stalledKeys{ 0 };
+	Vector2D lastPosition{};
+	bool lastKeyStepped{ false };
+	int blockedSteps{ 0 };
+	std::optional<Vector2D> doorGoal; // the closed door the current path ends at
+	std::vector<Vector2D> refusedDoors; // doors on this level that would not open
+	std::optional<Vector2D> knownStairs;
+
+	[[nodiscard]] Vector2D choose_target(const GameContext& ctx) const;
+	[[nodiscard]] int step_towards(Vector2D target, const GameContext& ctx);
+	[[nodiscard]] int random_step(const GameContext& ctx);
+
+	// Paths to the nearest reachable closed door; bumping it opens it.
+	[[nodiscard]] bool path_to_door(const GameContext& ctx);
+};
@@ -0,0 +1,23 @@
+#pragma once
+// HeadlessPlayer.h -- where a headless run gets the player's keys from.
+
+struct GameContext;
+
+// ---------------------------------------------------------------------------
+// HeadlessPlayer -- stands in for the keyboard when no window exists.
+//
+// Before every GameLoopCoordinator::update the runner asks for one key and
+// stores it in the InputHandler, exactly where key_listen would have put a
+// key press, so PlayerController handles it the same way. Keys are
+// Controls values (or plain characters, as the keyboard produces).
+// ---------------------------------------------------------------------------
+class HeadlessPlayer
+{
+public:
+	virtual ~HeadlessPlayer() = default;
+
+	[[nodiscard]] virtual int next_key(const GameContext& ctx) = 0;
+
+	// Called when a run starts a new game (first game and after a death).
+	virtual void on_new_game(const GameContext& /*ctx*/) {}
+};
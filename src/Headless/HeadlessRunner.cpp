@@ -0,0 +1,301 @@
+// HeadlessRunner.cpp -- runs the game loop without a window.
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <string_view>
+
+#include "../ActorTypes/Player.h"
+#include "../Core/GameContext.h"
+#include "../Game.h"
+#include "../Random/RandomDice.h"
+#include "../Renderer/InputSystem.h"
+#include "../Renderer/Renderer.h"
+#include "../Systems/GameLoopCoordinator.h"
+#include "../Systems/GameStateManager.h"
+#include "../Systems/InputHandler.h"
+#include "../Systems/InputRecorder.h"
+#include "../Systems/LevelManager.h"
+#include "../Systems/MenuManager.h"
+#include "../Systems/Profiler.h"
+#include "HeadlessPlayer.h"
+#include "HeadlessRunner.h"
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	// Adds the time since construction to one phase.
+	class PhaseTimer
+	{
+	public:
+		PhaseTimer(HeadlessReport& report, HeadlessPhase phase) noexcept
+			: stats(report.phases[static_cast<size_t>(phase)]), start(Clock::now())
+		{
+		}
+
+		~PhaseTimer()
+		{
+			stats.total += Clock::now() - start;
+			++stats.calls;
+		}
+
+		PhaseTimer(const PhaseTimer&) = delete;
+		PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+	private:
+		PhaseStats& stats;
+		Clock::time_point start;
+	};
+} // namespace
+
+std::string_view phase_name(HeadlessPhase phase) noexcept
+{
+	switch (phase)
+	{
+
+	case HeadlessPhase::NEW_GAME:
+	{
+		return "new game";
+	}
+
+	case HeadlessPhase::THINK:
+	{
+		return "think";
+	}
+
+	case HeadlessPhase::TURN:
+	{
+		return "turn";
+	}
+
+	case HeadlessPhase::DESCENT:
+	{
+		return "descent";
+	}
+
+	default:
+	{
+		return "?";
+	}
+
+	}
+}
+
+double HeadlessReport::turns_per_second() const noexcept
+{
+	const double seconds = std::chrono::duration<double>(elapsed).count();
+	return seconds > 0.0 ? turns / seconds : 0.0;
+}
+
+std::string format_report(const HeadlessReport& report)
+{
+	std::string out = std::format(
+		"{} turns in {:.3f} s: {:.0f} turns/s ({} updates, {} games, {} deaths, deepest level {}){}\n",
+		report.turns,
+		std::chrono::duration<double>(report.elapsed).count(),
+		report.turns_per_second(),
+		report.updates,
+		report.games,
+		report.deaths,
+		report.deepestLevel,
+		report.stalled ? " -- stopped: stalled" : "");
+	out += std::format("{:<10}{:>10}{:>12}{:>12}\n", "phase", "calls", "total ms", "mean us");
+	for (size_t i = 0; i < report.phases.size(); ++i)
+	{
+		const PhaseStats& stats = report.phases[i];
+		const double totalMs = std::chrono::duration<double, std::milli>(stats.total).count();
+		const double meanUs = stats.calls > 0
+			? std::chrono::duration<double, std::micro>(stats.total).count() / static_cast<double>(stats.calls)
+			: 0.0;
+		out += std::format(
+			"{:<10}{:>10}{:>12.2f}{:>12.2f}\n",
+			phase_name(static_cast<HeadlessPhase>(i)),
+			stats.calls,
+			totalMs,
+			meanUs);
+	}
+	return out;
+}
+
+double ReplayReport::steps_per_second() const noexcept
+{
+	const double seconds = std::chrono::duration<double>(elapsed).count();
+	return seconds > 0.0 ? steps / seconds : 0.0;
+}
+
+std::string format_replay(const ReplayReport& report)
+{
+	return std::format(
+		"{} steps ({} turns) in {:.3f} s: {:.0f} steps/s, checksum {:016x} {} {:016x}\n",
+		report.steps,
+		report.turns,
+		std::chrono::duration<double>(report.elapsed).count(),
+		report.steps_per_second(),
+		report.checksum,
+		report.matches() ? "matches" : "DIFFERS from recorded",
+		report.expectedChecksum);
+}
+
+GameContext HeadlessRunner::headless_context()
+{
+	GameContext ctx = game.context();
+	ctx.animSystem = nullptr;
+	ctx.floatingText = nullptr;
+	ctx.minimap = nullptr;
+	return ctx;
+}
+
+void HeadlessRunner::start_game(HeadlessPlayer& player, const HeadlessOptions& options, HeadlessReport& report)
+{
+	PhaseTimer timer(report, HeadlessPhase::NEW_GAME);
+	game.levelGenerator.discard();
+	game.playerBlueprint.playerClass = options.playerClass;
+	game.playerBlueprint.playerRace = options.playerRace;
+
+	GameContext ctx = headless_context();
+	game.stateManager.init_new_game(ctx);
+	game.gameState.set_should_save(false);
+	++report.games;
+	player.on_new_game(headless_context());
+}
+
+HeadlessReport HeadlessRunner::run(HeadlessPlayer& player, const HeadlessOptions& options)
+{
+	HeadlessReport report;
+	const Clock::time_point start = Clock::now();
+
+	game.dice = RandomDice{ options.seed };
+	start_game(player, options, report);
+
+	int finishedTurns = 0; // turns of games already over
+	int stalledUpdates = 0;
+	while (game.gameState.get_run() && finishedTurns + game.gameState.get_time() < options.turns)
+	{
+		PROFILE_FRAME();
+		GameContext ctx = headless_context();
+		int key = 0;
+		{
+			PROFILE_ZONE("think");
+			PhaseTimer timer(report, HeadlessPhase::THINK);
+			key = player.next_key(ctx);
+		}
+
+		const int level = game.levelManager.get_dungeon_level();
+		const int turn = game.gameState.get_time();
+		const Clock::time_point updateStart = Clock::now();
+		game.inputHandler.reset_key();
+		game.inputHandler.set_key(key);
+		{
+			PROFILE_ZONE("update");
+			game.gameLoopCoordinator.update(ctx);
+		}
+		if (!game.menus.empty())
+		{
+			game.menus.clear(); // nothing can answer them; the game carries on without
+			game.inputRecorder.record_menus_dismissed();
+		}
+		++report.updates;
+
+		PhaseStats& stats = report.phases[static_cast<size_t>(
+			game.levelManager.get_dungeon_level() != level ? HeadlessPhase::DESCENT : HeadlessPhase::TURN)];
+		stats.total += Clock::now() - updateStart;
+		++stats.calls;
+		report.deepestLevel = std::max(report.deepestLevel, game.levelManager.get_dungeon_level());
+
+		stalledUpdates = (game.gameState.get_time() == turn) ? stalledUpdates + 1 : 0;
+		if (stalledUpdates >= MAX_STALLED_UPDATES)
+		{
+			report.stalled = true;
+			break;
+		}
+
+		if (game.player && game.player->is_dead())
+		{
+			++report.deaths;
+			if (!options.restartOnDeath)
+			{
+				break;
+			}
+			finishedTurns += game.gameState.get_time();
+			start_game(player, options, report);
+		}
+	}
+
+	report.turns = finishedTurns + game.gameState.get_time();
+	report.elapsed = Clock::now() - start;
+	game.levelGenerator.discard();
+	return report;
+}
+
+ReplayReport HeadlessRunner::replay(const InputRecording& recording)
+{
+	ReplayReport report;
+	report.expectedChecksum = recording.checksum;
+	const Clock::time_point start = Clock::now();
+
+	game.levelGenerator.discard();
+	game.dice.reseed(recording.seed);
+	game.playerBlueprint = recording.blueprint;
+	GameContext ctx = headless_context();
+	game.stateManager.init_new_game(ctx);
+	game.gameState.set_should_save(false);
+	game.inputSystem.set_scripted(true);
+
+	for (const InputStep& step : recording.steps)
+	{
+		PROFILE_FRAME();
+		ctx = headless_context();
+		switch (step.kind)
+		{
+
+		case InputStep::Kind::UPDATE:
+		{
+			game.inputHandler.reset_key();
+			game.inputHandler.set_key(step.key);
+			if (step.click)
+			{
+				game.inputHandler.set_click_tile(*step.click);
+			}
+			PROFILE_ZONE("update");
+			game.gameLoopCoordinator.update(ctx);
+			break;
+		}
+
+		case InputStep::Kind::MENU:
+		{
+			if (step.input)
+			{
+				game.inputSystem.push_event(*step.input);
+			}
+			PROFILE_ZONE("menus");
+			game.menuManager.handle_menus(game.menus, ctx);
+			break;
+		}
+
+		case InputStep::Kind::DISMISS_MENUS:
+		{
+			game.menus.clear();
+			break;
+		}
+
+		case InputStep::Kind::VIEW:
+		{
+			if (!game.renderer.is_initialized())
+			{
+				game.renderer.set_view_size(step.view.tileSize, step.view.width, step.view.height);
+			}
+			break;
+		}
+
+		}
+		++report.steps;
+	}
+
+	report.turns = game.gameState.get_time();
+	report.checksum = state_checksum(game.context());
+	report.elapsed = Clock::now() - start;
+	game.levelGenerator.discard();
+	return report;
+}
@@ -0,0 +1,113 @@
+#pragma once
+// HeadlessRunner.h -- runs the game loop without a window.
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+struct Game;
+struct GameContext;
+struct InputRecording;
+class HeadlessPlayer;
+
+enum class HeadlessPhase
+{
+	NEW_GAME, // GameStateManager::init_new_game: data load, player, first level
+	THINK, // HeadlessPlayer::next_key
+	TURN, // GameLoopCoordinator::update on the current level
+	DESCENT, // GameLoopCoordinator::update that took the stairs
+	COUNT // sentinel -- keep last
+};
+
+[[nodiscard]] std::string_view phase_name(HeadlessPhase phase) noexcept;
+
+struct HeadlessOptions
+{
+	int turns{ 1000 }; // game turns to simulate, summed over all games
+	unsigned int seed{ 1 }; // seeds the game dice; the bot seeds its own
+	bool restartOnDeath{ true };
+	std::string playerClass{ "Fighter" };
+	std::string playerRace{ "Human" };
+};
+
+struct PhaseStats
+{
+	std::chrono::nanoseconds total{};
+	int64_t calls{ 0 };
+};
+
+struct HeadlessReport
+{
+	int turns{ 0 }; // game turns, as counted by GameState::increment_time
+	int updates{ 0 }; // GameLoopCoordinator::update calls, turn or not
+	int games{ 0 };
+	int deaths{ 0 };
+	int deepestLevel{ 0 };
+	bool stalled{ false }; // stopped because updates stopped advancing turns
+	std::chrono::nanoseconds elapsed{};
+	std::array<PhaseStats, static_cast<size_t>(HeadlessPhase::COUNT)> phases{};
+
+	[[nodiscard]] double turns_per_second() const noexcept;
+	[[nodiscard]] const PhaseStats& phase(HeadlessPhase p) const noexcept { return phases[static_cast<size_t>(p)]; }
+};
+
+// Human-readable summary: totals, turns per second and a phase table.
+[[nodiscard]] std::string format_report(const HeadlessReport& report);
+
+struct ReplayReport
+{
+	int steps{ 0 }; // recorded steps fed back: updates, menu frames and the rest
+	int turns{ 0 };
+	uint64_t checksum{ 0 }; // state_checksum after the last step
+	uint64_t expectedChecksum{ 0 }; // the one the recording ended with
+	std::chrono::nanoseconds elapsed{};
+
+	[[nodiscard]] bool matches() const noexcept { return checksum == expectedChecksum; }
+	[[nodiscard]] double steps_per_second() const noexcept;
+};
+
+// One line: steps, turns, speed and whether the checksum matched.
+[[nodiscard]] std::string format_replay(const ReplayReport& report);
+
+// ---------------------------------------------------------------------------
+// HeadlessRunner -- drives a Game at full speed with no window.
+//
+// The run never opens a window: the Renderer stays uninitialised, so
+// anything drawn is dropped, and the animation and floating-text systems
+// are left out of the context. Each iteration asks the HeadlessPlayer for
+// a key, stores it in the InputHandler and calls
+// GameLoopCoordinator::update -- the same player controller, creature AI,
+// combat and level generation the windowed game runs. The bot cannot
+// answer menus, so any an update opens are discarded (and recorded as
+// discarded). Autosave is off.
+//
+// replay() starts a new game from a recording's seed and character and
+// feeds its steps back in order: keys to the InputHandler, one update
+// each, so a walk along a clicked path runs without the 0.12 s pacing the
+// windowed loop puts between its steps; menu polls through a scripted
+// InputSystem to MenuManager::handle_menus, laid out in the recorded view
+// size. Without a font, text is measured at an estimated width, so a click
+// on a text-width target such as an inventory tab label can land
+// elsewhere than it did. The Game must not be recording itself.
+// ---------------------------------------------------------------------------
+class HeadlessRunner
+{
+public:
+	explicit HeadlessRunner(Game& game) noexcept : game(game) {}
+
+	HeadlessReport run(HeadlessPlayer& player, const HeadlessOptions& options);
+	ReplayReport replay(const InputRecording& recording);
+
+private:
+	// An update that does not advance the turn this many times in a row
+	// means the player is stuck in something the run cannot answer.
+	static constexpr int MAX_STALLED_UPDATES = 1000;
+
+	Game& game;
+
+	[[nodiscard]] GameContext headless_context();
+	void start_game(HeadlessPlayer& player, const HeadlessOptions& options, HeadlessReport& report);
+};
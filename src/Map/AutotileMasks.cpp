@@ -0,0 +1,157 @@
+// AutotileMasks.cpp -- neighbour rules behind the floor and wall autotiles.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+
+#include "../Utils/Vector2D.h"
+#include "AutotileMasks.h"
+#include "TileGrid.h"
+
+namespace
+{
+	struct Cardinal
+	{
+		Vector2D offset;
+		uint8_t bit;
+	};
+
+	constexpr std::array<Cardinal, 4> CARDINAL_DIRS{ {
+		{ DIR_N, AutotileMasks::NORTH },
+		{ DIR_E, AutotileMasks::EAST },
+		{ DIR_S, AutotileMasks::SOUTH },
+		{ DIR_W, AutotileMasks::WEST },
+	} };
+
+	constexpr std::array<Vector2D, 8> ALL_DIRS{ { DIR_NW, DIR_N, DIR_NE, DIR_W, DIR_E, DIR_SW, DIR_S, DIR_SE } };
+
+	bool is_walkable(const TileGrid& grid, Vector2D pos)
+	{
+		if (!grid.in_bounds(pos))
+		{
+			return false;
+		}
+		const TileType type = grid.type(grid.index_of(pos));
+		return type == TileType::FLOOR || type == TileType::CORRIDOR || type == TileType::OPEN_DOOR || type == TileType::WATER;
+	}
+
+	bool is_wall_or_door(const TileGrid& grid, Vector2D pos)
+	{
+		if (!grid.in_bounds(pos))
+		{
+			return false;
+		}
+		const TileType type = grid.type(grid.index_of(pos));
+		return type == TileType::WALL || type == TileType::CLOSED_DOOR;
+	}
+
+	bool is_border_wall_tile(const TileGrid& grid, Vector2D pos)
+	{
+		if (!is_wall_or_door(grid, pos))
+		{
+			return false;
+		}
+		return std::ranges::any_of(ALL_DIRS, [&](Vector2D dir) { return is_walkable(grid, pos + dir); });
+	}
+
+	// Two border walls connect only if they share a common walkable 8-neighbour.
+	// Corner walls (only diagonally adjacent to floor) still connect because
+	// their shared floor tile is a common 8-neighbour of both.
+	bool is_connected_wall(const TileGrid& grid, Vector2D pos, Vector2D neighbour)
+	{
+		if (!is_border_wall_tile(grid, neighbour))
+		{
+			return false;
+		}
+		for (const Vector2D& dir : ALL_DIRS)
+		{
+			const Vector2D shared = pos + dir;
+			if (!is_walkable(grid, shared))
+			{
+				continue;
+			}
+			const Vector2D diff = shared - neighbour;
+			if (std::abs(diff.x) <= 1 && std::abs(diff.y) <= 1)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+uint8_t AutotileMasks::compute(const TileGrid& grid, Vector2D pos)
+{
+	uint8_t mask = 0;
+	switch (grid.type(grid.index_of(pos)))
+	{
+	case TileType::WALL:
+	{
+		if (!is_border_wall_tile(grid, pos))
+		{
+			return 0;
+		}
+		mask = BORDER_WALL;
+		for (const Cardinal& dir : CARDINAL_DIRS)
+		{
+			if (is_connected_wall(grid, pos, pos + dir.offset))
+			{
+				mask |= dir.bit;
+			}
+		}
+		return mask;
+	}
+
+	case TileType::CLOSED_DOOR:
+	case TileType::FLOOR:
+	case TileType::OPEN_DOOR:
+	{
+		if (is_border_wall_tile(grid, pos))
+		{
+			mask = BORDER_WALL;
+		}
+		for (const Cardinal& dir : CARDINAL_DIRS)
+		{
+			if (is_walkable(grid, pos + dir.offset))
+			{
+				mask |= dir.bit;
+			}
+		}
+		return mask;
+	}
+
+	default:
+		return 0;
+	}
+}
+
+void AutotileMasks::rebuild(const TileGrid& grid)
+{
+	masks.assign(grid.size(), 0);
+	for (size_t index = 0; index < masks.size(); ++index)
+	{
+		masks[index] = compute(grid, grid.position_of(index));
+	}
+}
+
+void AutotileMasks::patch(const TileGrid& grid, Vector2D pos)
+{
+	if (masks.size() != grid.size())
+	{
+		rebuild(grid);
+		return;
+	}
+	const int firstX = std::max(0, pos.x - REACH);
+	const int firstY = std::max(0, pos.y - REACH);
+	const int lastX = std::min(grid.get_width() - 1, pos.x + REACH);
+	const int lastY = std::min(grid.get_height() - 1, pos.y + REACH);
+	for (int y = firstY; y <= lastY; ++y)
+	{
+		for (int x = firstX; x <= lastX; ++x)
+		{
+			const Vector2D tile{ x, y };
+			masks[grid.index_of(tile)] = compute(grid, tile);
+		}
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+// AutotileMasks.h -- per-tile autotile neighbour masks, patched on tile edits.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../Utils/Vector2D.h"
+#include "TileGrid.h"
+
+// ---------------------------------------------------------------------------
+// AutotileMasks -- one byte per tile holding what Map::render used to work
+// out from the neighbours every frame: the 4-bit cardinal mask fed to
+// Autotile::resolve_mask / wall_resolve_mask, and whether a wall is a
+// border wall (a wall or closed door with a walkable 8-neighbour; only
+// those are drawn).
+//
+// Floors and doors use the walkable-neighbour mask. Walls use the
+// connected-wall mask: a cardinal border-wall neighbour counts only if the
+// two share a walkable tile, so a wall between a room and a corridor does
+// not bleed into the room outline. That reads border status one step
+// further out, so a tile edit can change masks up to REACH tiles away and
+// patch() recomputes that (2 * REACH + 1)^2 square.
+// ---------------------------------------------------------------------------
+class AutotileMasks
+{
+public:
+	static constexpr uint8_t NORTH = 8;
+	static constexpr uint8_t EAST = 4;
+	static constexpr uint8_t SOUTH = 2;
+	static constexpr uint8_t WEST = 1;
+	static constexpr uint8_t CARDINALS = NORTH | EAST | SOUTH | WEST;
+	static constexpr uint8_t BORDER_WALL = 16;
+	static constexpr int REACH = 2;
+
+	// Recomputes every tile from grid.
+	void rebuild(const TileGrid& grid);
+
+	// Recomputes the tiles whose mask may depend on the tile at pos.
+	void patch(const TileGrid& grid, Vector2D pos);
+
+	size_t size() const noexcept { return masks.size(); }
+	uint8_t get(size_t index) const noexcept { return masks[index]; }
+	int cardinal_mask(size_t index) const noexcept { return masks[index] & CARDINALS; }
+	bool is_border_wall(size_t index) const noexcept { return (masks[index] & BORDER_WALL) != 0; }
+
+	// What rebuild() stores for the tile at pos.
+	static uint8_t compute(const TileGrid& grid, Vector2D pos);
+
+private:
+	std::vector<uint8_t> masks;
+};
@@ -0,0 +1,121 @@
+#pragma once
+// BitPlane.h -- one bit per map tile, packed 64 tiles to a word.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// BitPlane -- dense per-tile flag set indexed like Map::get_index.
+//
+// Whole-map passes (explored |= visible, reveal, lighting/minimap scans)
+// work a word at a time and skip empty words, so they touch 1/8th of the
+// bytes a bool-per-tile layout would and 1/256th of an array of structs.
+// Bits past size() are kept zero so word-wise counts and unions are exact.
+// ---------------------------------------------------------------------------
+class BitPlane
+{
+public:
+	BitPlane() = default;
+	explicit BitPlane(size_t size) { resize(size); }
+
+	// Resizes and clears every bit.
+	void resize(size_t size)
+	{
+		size_ = size;
+		words_.assign((size + 63) / 64, 0);
+	}
+
+	size_t size() const noexcept { return size_; }
+	size_t memory_bytes() const noexcept { return words_.size() * sizeof(uint64_t); }
+	const std::vector<uint64_t>& words() const noexcept { return words_; }
+
+	bool test(size_t index) const noexcept { return (words_[index >> 6] >> (index & 63)) & 1u; }
+	void set(size_t index) noexcept { words_[index >> 6] |= bit(index); }
+	void reset(size_t index) noexcept { words_[index >> 6] &= ~bit(index); }
+	void assign(size_t index, bool value) noexcept { value ? set(index) : reset(index); }
+
+	void clear_all() noexcept
+	{
+		for (uint64_t& word : words_)
+		{
+			word = 0;
+		}
+	}
+
+	void set_all() noexcept
+	{
+		for (uint64_t& word : words_)
+		{
+			word = ~uint64_t{ 0 };
+		}
+		trim_tail();
+	}
+
+	// this |= other; planes must be the same size.
+	void merge(const BitPlane& other) noexcept
+	{
+		for (size_t w = 0; w < words_.size(); ++w)
+		{
+			words_[w] |= other.words_[w];
+		}
+	}
+
+	size_t count() const noexcept
+	{
+		size_t total = 0;
+		for (uint64_t word : words_)
+		{
+			total += static_cast<size_t>(std::popcount(word));
+		}
+		return total;
+	}
+
+	// Visits every set bit in ascending order as fn(size_t index).
+	template <typename Fn>
+	void for_each_set(Fn&& fn) const
+	{
+		for (size_t w = 0; w < words_.size(); ++w)
+		{
+			for_each_bit(words_[w], w, fn);
+		}
+	}
+
+	// Visits every index set in this plane or in other (same size) as
+	// fn(size_t index), without materialising the union.
+	template <typename Fn>
+	void for_each_set_in_union(const BitPlane& other, Fn&& fn) const
+	{
+		for (size_t w = 0; w < words_.size(); ++w)
+		{
+			for_each_bit(words_[w] | other.words_[w], w, fn);
+		}
+	}
+
+private:
+	size_t size_{ 0 };
+	std::vector<uint64_t> words_;
+
+	static uint64_t bit(size_t index) noexcept { return uint64_t{ 1 } << (index & 63); }
+
+	template <typename Fn>
+	static void for_each_bit(uint64_t word, size_t wordIndex, Fn& fn)
+	{
+		while (word != 0)
+		{
+			const int offset = std::countr_zero(word);
+			fn(wordIndex * 64 + static_cast<size_t>(offset));
+			word &= word - 1;
+		}
+	}
+
+	void trim_tail() noexcept
+	{
+		const size_t used = size_ & 63;
+		if (used != 0 && !words_.empty())
+		{
+			words_.back() &= (uint64_t{ 1 } << used) - 1;
+		}
+	}
+};
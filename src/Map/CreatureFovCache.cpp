@@ -0,0 +1,82 @@
+// CreatureFovCache.cpp -- per-creature field of view for monster perception.
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <span>
+
+#include "../Actor/Creature.h"
+#include "CreatureFovCache.h"
+#include "FovMap.h"
+
+CreatureFovCache::CreatureFovCache(int radius)
+	: radius_(std::max(0, radius)),
+	  side_(2 * std::max(0, radius) + 1)
+{
+}
+
+void CreatureFovCache::refresh(const FovMap& fov, std::span<const std::unique_ptr<Creature>> creatures)
+{
+	for (auto& [viewer, entry] : entries_)
+	{
+		entry.refreshed = false;
+	}
+
+	for (const auto& creature : creatures)
+	{
+		if (!creature || creature->is_dead())
+		{
+			continue;
+		}
+		entry_for(fov, *creature).refreshed = true;
+	}
+
+	std::erase_if(entries_, [](const auto& item) { return !item.second.refreshed; });
+}
+
+bool CreatureFovCache::can_see(const FovMap& fov, const Creature& viewer, Vector2D target)
+{
+	const Vector2D offset = target - viewer.position;
+	if (std::abs(offset.x) > radius_ || std::abs(offset.y) > radius_)
+	{
+		return false;
+	}
+
+	const Entry& entry = entry_for(fov, viewer);
+	const size_t bit = static_cast<size_t>(offset.y + radius_) * side_ + (offset.x + radius_);
+	return (entry.bits[bit >> 6] >> (bit & 63)) & 1u;
+}
+
+void CreatureFovCache::clear() noexcept
+{
+	entries_.clear();
+}
+
+CreatureFovCache::Entry& CreatureFovCache::entry_for(const FovMap& fov, const Creature& viewer)
+{
+	Entry& entry = entries_[&viewer];
+	if (entry.bits.empty() || entry.origin != viewer.position || entry.version != fov.get_version())
+	{
+		compute(fov, viewer.position, entry);
+	}
+	return entry;
+}
+
+void CreatureFovCache::compute(const FovMap& fov, Vector2D origin, Entry& entry)
+{
+	++computeCount_;
+	entry.origin = origin;
+	entry.version = fov.get_version();
+	entry.bits.assign((static_cast<size_t>(side_) * side_ + 63) / 64, 0);
+
+	fov.compute_fov_from(origin.x, origin.y, radius_, scratch_);
+
+	const int width = fov.get_width();
+	for (int index : scratch_.cells)
+	{
+		const int dx = index % width - origin.x;
+		const int dy = index / width - origin.y;
+		const size_t bit = static_cast<size_t>(dy + radius_) * side_ + (dx + radius_);
+		entry.bits[bit >> 6] |= uint64_t{ 1 } << (bit & 63);
+	}
+}
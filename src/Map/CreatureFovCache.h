@@ -0,0 +1,62 @@
+#pragma once
+// CreatureFovCache.h -- per-creature field of view for monster perception.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "../Utils/Vector2D.h"
+#include "FovMap.h"
+
+class Creature;
+
+// ---------------------------------------------------------------------------
+// CreatureFovCache -- "can X see Y" in O(1) for every creature.
+//
+// Each viewer's visible set is stored as a bitset over the (2r+1)^2 window
+// centred on it. An entry is valid while the viewer stays on the same tile
+// and the FovMap version is unchanged; visibility depends on nothing else,
+// so entries are keyed by creature address but never dereferenced.
+// refresh() recomputes every stale entry once per turn in one batch;
+// can_see() recomputes a single stale entry on demand (a creature that
+// moved earlier in the same turn).
+// ---------------------------------------------------------------------------
+class CreatureFovCache
+{
+public:
+	explicit CreatureFovCache(int radius);
+
+	int get_radius() const noexcept { return radius_; }
+
+	// Brings every living creature's entry up to date and drops entries for
+	// creatures no longer in the list.
+	void refresh(const FovMap& fov, std::span<const std::unique_ptr<Creature>> creatures);
+
+	bool can_see(const FovMap& fov, const Creature& viewer, Vector2D target);
+
+	void clear() noexcept;
+
+	// Number of visibility sets computed since construction (cache misses).
+	size_t get_compute_count() const noexcept { return computeCount_; }
+
+private:
+	struct Entry
+	{
+		Vector2D origin{};
+		uint64_t version{ 0 };
+		bool refreshed{ false }; // seen by the current refresh() pass
+		std::vector<uint64_t> bits;
+	};
+
+	int radius_;
+	int side_; // 2 * radius + 1
+	size_t computeCount_{ 0 };
+	std::unordered_map<const Creature*, Entry> entries_;
+	FovScratch scratch_;
+
+	Entry& entry_for(const FovMap& fov, const Creature& viewer);
+	void compute(const FovMap& fov, Vector2D origin, Entry& entry);
+};
@@ -0,0 +1,229 @@
+// FlowField.cpp -- full BFS build and incremental repair of a step-distance field.
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "../Utils/Vector2D.h"
+#include "BitPlane.h"
+#include "FlowField.h"
+
+void FlowField::resize(int newWidth, int newHeight)
+{
+	width = newWidth;
+	height = newHeight;
+	const size_t size = static_cast<size_t>(width) * height;
+	costs.assign(size, UNREACHABLE);
+	passable.resize(size);
+	pendingMark.resize(size);
+	pending.clear();
+	goalCells.clear();
+	// Distances run up to width * height, and a repair seeds tiles at any of them.
+	queue = BucketQueue{ static_cast<int>(size) + 2 };
+	needsRebuild = true;
+}
+
+void FlowField::set_passable(size_t index, bool value)
+{
+	if (passable.test(index) == value)
+	{
+		return;
+	}
+	passable.assign(index, value);
+	if (needsRebuild || pendingMark.test(index))
+	{
+		return;
+	}
+
+	// Past ~1/16th of the map one BFS is cheaper than repairing around each tile.
+	if (pending.size() * 16 >= costs.size())
+	{
+		needsRebuild = true;
+		return;
+	}
+	pendingMark.set(index);
+	pending.push_back(static_cast<int>(index));
+}
+
+void FlowField::assign_passable(const BitPlane& plane)
+{
+	passable = plane;
+	needsRebuild = true;
+}
+
+void FlowField::collect_goals(std::span<const Vector2D> goals)
+{
+	nextGoals.clear();
+	for (const Vector2D& goal : goals)
+	{
+		if (goal.x >= 0 && goal.x < width && goal.y >= 0 && goal.y < height)
+		{
+			nextGoals.push_back(goal.y * width + goal.x);
+		}
+	}
+}
+
+bool FlowField::is_goal(int index) const noexcept
+{
+	return std::ranges::find(nextGoals, index) != nextGoals.end();
+}
+
+void FlowField::clear_pending() noexcept
+{
+	for (int index : pending)
+	{
+		pendingMark.reset(static_cast<size_t>(index));
+	}
+	pending.clear();
+}
+
+void FlowField::update(std::span<const Vector2D> goals)
+{
+	collect_goals(goals);
+	if (!needsRebuild && pending.empty() && nextGoals == goalCells)
+	{
+		return;
+	}
+	if (needsRebuild || nextGoals != goalCells)
+	{
+		rebuild(goals);
+		return;
+	}
+	repair();
+	clear_pending();
+}
+
+void FlowField::rebuild(std::span<const Vector2D> goals)
+{
+	collect_goals(goals);
+	std::ranges::fill(costs, UNREACHABLE);
+	touched += costs.size();
+
+	fifo.clear();
+	for (int goal : nextGoals)
+	{
+		if (costs[goal] != 0)
+		{
+			write(goal, 0);
+			fifo.push_back(goal);
+		}
+	}
+	for (size_t head = 0; head < fifo.size(); ++head)
+	{
+		const int current = fifo[head];
+		const int next = costs[current] + 1;
+		for_each_neighbour(current, [&](int neighbour)
+			{
+				if (costs[neighbour] == UNREACHABLE && passable.test(neighbour))
+				{
+					write(neighbour, next);
+					fifo.push_back(neighbour);
+				}
+			});
+	}
+
+	clear_pending();
+	goalCells.swap(nextGoals);
+	needsRebuild = false;
+}
+
+// Both phases rely on the previous field being exact for the same goals and
+// the previous passability: neighbouring unchanged tiles then differ by at
+// most one, so only tiles that lost their support or can now do better need
+// a visit.
+void FlowField::repair()
+{
+	// Raise: tiles that became impassable lose their cost, and any tile that
+	// counted on one of them is re-checked in increasing old-cost order. A
+	// tile keeps its cost if some neighbour still holds cost - 1; otherwise
+	// it is orphaned and its own dependants are checked in turn.
+	queue.clear();
+	orphans.clear();
+	const auto push_dependants = [this](int index, int oldCost)
+	{
+		for_each_neighbour(index, [&](int neighbour)
+			{
+				if (costs[neighbour] == oldCost + 1)
+				{
+					queue.push(neighbour, oldCost + 1);
+				}
+			});
+	};
+	for (int index : pending)
+	{
+		if (!passable.test(index) && costs[index] != UNREACHABLE && !is_goal(index))
+		{
+			const int oldCost = costs[index];
+			write(index, UNREACHABLE);
+			push_dependants(index, oldCost);
+		}
+	}
+	while (!queue.empty())
+	{
+		const int current = queue.pop();
+		const int key = queue.cursor();
+		if (costs[current] != key || is_goal(current))
+		{
+			continue;
+		}
+
+		bool supported = false;
+		for_each_neighbour(current, [&](int neighbour)
+			{ supported = supported || costs[neighbour] == key - 1; });
+		if (!supported)
+		{
+			write(current, UNREACHABLE);
+			orphans.push_back(current);
+			push_dependants(current, key);
+		}
+	}
+
+	// Lower: flood outward from orphans that border a kept tile and from
+	// newly opened tiles, keeping only strict improvements.
+	queue.clear();
+	const auto seed = [this](int index)
+	{
+		if (!passable.test(index) || is_goal(index))
+		{
+			return;
+		}
+		int best = UNREACHABLE;
+		for_each_neighbour(index, [&](int neighbour)
+			{
+				if (costs[neighbour] != UNREACHABLE)
+				{
+					best = std::min(best, costs[neighbour] + 1);
+				}
+			});
+		if (best < costs[index])
+		{
+			write(index, best);
+			queue.push(index, best);
+		}
+	};
+	for (int index : orphans)
+	{
+		seed(index);
+	}
+	for (int index : pending)
+	{
+		seed(index);
+	}
+	while (!queue.empty())
+	{
+		const int current = queue.pop();
+		const int key = queue.cursor();
+		if (costs[current] != key)
+		{
+			continue;
+		}
+		for_each_neighbour(current, [&](int neighbour)
+			{
+				if (key + 1 < costs[neighbour] && passable.test(neighbour))
+				{
+					write(neighbour, key + 1);
+					queue.push(neighbour, key + 1);
+				}
+			});
+	}
+}
@@ -0,0 +1,111 @@
+#pragma once
+// FlowField.h -- step-distance map to a goal set, repaired incrementally.
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "../Utils/BucketQueue.h"
+#include "../Utils/Vector2D.h"
+#include "BitPlane.h"
+
+// ---------------------------------------------------------------------------
+// FlowField -- 8-way step distance from every passable tile to the nearest
+// goal (Map's player flow: monsters descend it to chase, climb it to flee).
+//
+// Every step costs 1, so a full build is a plain BFS. When only a few tiles
+// changed passability (a door, a decoration) update() repairs the previous
+// field instead: it first drops the costs that lost their support -- taken
+// in cost order, so only tiles whose distance really grew are visited --
+// and then re-floods from the dropped and newly opened tiles through a
+// bucket queue. With nothing changed update() returns at once, so FOV
+// recomputes for zoom or resize cost nothing here. Moving a goal, even one
+// step, shifts the cost of most tiles, and there the BFS is the faster
+// repair, so any goal change rebuilds. Goals count 0 even on impassable
+// tiles, as the old full rebuild did.
+// ---------------------------------------------------------------------------
+class FlowField
+{
+public:
+	static constexpr int UNREACHABLE = std::numeric_limits<int>::max();
+
+	FlowField() : queue(1) {}
+
+	// Resizes to width x height with every tile impassable and unreachable.
+	void resize(int width, int height);
+
+	int get_width() const noexcept { return width; }
+	int get_height() const noexcept { return height; }
+	int cost(size_t index) const noexcept { return costs[index]; }
+	bool is_passable(size_t index) const noexcept { return passable.test(index); }
+
+	// Records a passability change; costs follow on the next update().
+	void set_passable(size_t index, bool value);
+
+	// Replaces passability wholesale; the next update() rebuilds.
+	void assign_passable(const BitPlane& plane);
+
+	// Forces the next update() to rebuild from scratch.
+	void invalidate() noexcept { needsRebuild = true; }
+
+	// Brings costs up to date for goals (out-of-bounds goals are ignored):
+	// nothing when nothing changed, a repair when only passability did, a
+	// rebuild when the goals moved, many tiles changed or after invalidate().
+	void update(std::span<const Vector2D> goals);
+	void rebuild(std::span<const Vector2D> goals);
+
+	// Cost entries written by update()/rebuild() since the last reset.
+	size_t get_touched_count() const noexcept { return touched; }
+	void reset_touched_count() noexcept { touched = 0; }
+
+private:
+	int width{ 0 };
+	int height{ 0 };
+	std::vector<int> costs;
+	BitPlane passable;
+	BitPlane pendingMark; // set for tiles already in pending
+	std::vector<int> pending; // tiles whose passability changed since the last update
+	std::vector<int> goalCells; // goals the current costs were built for
+	std::vector<int> nextGoals; // scratch: goals requested by the current call
+	std::vector<int> orphans; // scratch: tiles cut off during a repair
+	std::vector<int> fifo; // scratch: BFS order for rebuild
+	BucketQueue queue;
+	size_t touched{ 0 };
+	bool needsRebuild{ true };
+
+	void collect_goals(std::span<const Vector2D> goals);
+	bool is_goal(int index) const noexcept;
+	void clear_pending() noexcept;
+	void repair();
+	void write(int index, int value) noexcept
+	{
+		costs[index] = value;
+		++touched;
+	}
+
+	// Calls fn(int neighbourIndex) for each in-bounds 8-way neighbour.
+	template <typename Fn>
+	void for_each_neighbour(int index, Fn&& fn) const
+	{
+		const int x = index % width;
+		const int y = index / width;
+		for (int dy = -1; dy <= 1; ++dy)
+		{
+			const int ny = y + dy;
+			if (ny < 0 || ny >= height)
+			{
+				continue;
+			}
+			for (int dx = -1; dx <= 1; ++dx)
+			{
+				const int nx = x + dx;
+				if ((dx == 0 && dy == 0) || nx < 0 || nx >= width)
+				{
+					continue;
+				}
+				fn(ny * width + nx);
+			}
+		}
+	}
+};
@@ -1,9 +1,39 @@
-// FovMap.cpp -- standalone FOV grid using recursive shadowcasting.
+// FovMap.cpp -- standalone FOV grid using shadowcasting.
 // Replaces libtcod TCODMap/TCODPath entirely.
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "../Systems/Profiler.h"
 #include "FovMap.h"
 
+namespace
+{
+	// Each column is {xx, xy, yx, yy} for one octant.
+	constexpr int OCTANT_MULT[4][8] = {
+		{ 1, 0, 0, -1, -1, 0, 0, 1 },
+		{ 0, 1, -1, 0, 0, -1, 1, 0 },
+		{ 0, 1, 1, 0, 0, -1, -1, 0 },
+		{ 1, 0, 0, 1, -1, 0, 0, -1 },
+	};
+
+	// Shared by every FovMap -- maps may be built on a worker thread.
+	std::atomic<uint64_t> nextFovVersion{ 1 };
+
+	uint64_t take_fov_version() noexcept
+	{
+		return nextFovVersion.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
 FovMap::FovMap(int width, int height)
-	: width_(width), height_(height), cells_(width * height)
+	: width_(width),
+	  height_(height),
+	  walkable_(static_cast<size_t>(width) * height),
+	  transparent_(static_cast<size_t>(width) * height),
+	  visible_(static_cast<size_t>(width) * height),
+	  version_(take_fov_version()),
+	  walkableVersion_(take_fov_version())
 {
 }
 
@@ -14,9 +44,42 @@ void FovMap::set_properties(int x, int y, bool walkable, bool transparent) noexc
 		return;
 	}
 
-	FovCell& c = cells_[cell_index(x, y)];
-	c.walkable = walkable;
-	c.transparent = transparent;
+	const int index = cell_index(x, y);
+	if (walkable_.test(index) != walkable)
+	{
+		walkable_.assign(index, walkable);
+		walkableVersion_ = take_fov_version();
+		if (!walkableChangesOverflowed_)
+		{
+			// Past ~1/16th of the map a rescan is cheaper than replaying the log.
+			if (walkableChanges_.size() * 16 >= walkable_.size())
+			{
+				walkableChangesOverflowed_ = true;
+				walkableChanges_.clear();
+			}
+			else
+			{
+				walkableChanges_.push_back(index);
+			}
+		}
+	}
+	if (transparent_.test(index) != transparent)
+	{
+		transparent_.assign(index, transparent);
+		version_ = take_fov_version();
+	}
+}
+
+bool FovMap::take_walkable_changes(std::vector<int>& out)
+{
+	out.clear();
+	const bool complete = !walkableChangesOverflowed_;
+	if (complete)
+	{
+		out.swap(walkableChanges_);
+	}
+	walkableChangesOverflowed_ = false;
+	return complete;
 }
 
 bool FovMap::is_walkable(int x, int y) const noexcept
@@ -26,7 +89,17 @@ bool FovMap::is_walkable(int x, int y) const noexcept
 		return false;
 	}
 
-	return cells_[cell_index(x, y)].walkable;
+	return walkable_.test(cell_index(x, y));
+}
+
+bool FovMap::is_transparent(int x, int y) const noexcept
+{
+	if (!in_bounds(x, y))
+	{
+		return false;
+	}
+
+	return transparent_.test(cell_index(x, y));
 }
 
 bool FovMap::is_in_fov(int x, int y) const noexcept
@@ -36,7 +109,7 @@ bool FovMap::is_in_fov(int x, int y) const noexcept
 		return false;
 	}
 
-	return cells_[cell_index(x, y)].visible;
+	return visible_.test(cell_index(x, y));
 }
 
 bool FovMap::in_bounds(int x, int y) const noexcept
@@ -49,49 +122,111 @@ int FovMap::cell_index(int x, int y) const noexcept
 	return y * width_ + x;
 }
 
+bool FovMap::radius_fits(int cx, int cy, int radius) const noexcept
+{
+	return cx - radius >= 0 && cx + radius < width_ && cy - radius >= 0 && cy + radius < height_;
+}
+
+void FovMap::mark_visible(int index)
+{
+	// Octant edges overlap, so a cell can be reached more than once.
+	if (!visible_.test(index))
+	{
+		visible_.set(index);
+		visibleCells_.push_back(index);
+	}
+}
+
 // ---------------------------------------------------------------------------
-// FOV -- recursive shadowcasting
+// FOV -- shadowcasting
 //
 // Reference: Bjorn Pettersen's algorithm (Roguebasin C++ shadowcasting).
 // For each of 8 octants, scan_octant() casts shadows row by row.
-//   mult[4][8]: each column is {xx, xy, yx, yy} for one octant.
+//   OCTANT_MULT[4][8]: each column is {xx, xy, yx, yy} for one octant.
 // ---------------------------------------------------------------------------
 
 void FovMap::compute_fov(int panelX, int panelY, int radius)
 {
-	for (auto& c : cells_)
+	// Clear only what the previous call lit instead of the whole plane.
+	for (int index : visibleCells_)
 	{
-		c.visible = false;
+		visible_.reset(index);
 	}
+	visibleCells_.clear();
 
 	if (!in_bounds(panelX, panelY))
 	{
 		return;
 	}
 
-	cells_[cell_index(panelX, panelY)].visible = true;
+	mark_visible(cell_index(panelX, panelY));
 
-	static const int mult[4][8] = {
-		{ 1, 0, 0, -1, -1, 0, 0, 1 },
-		{ 0, 1, -1, 0, 0, -1, 1, 0 },
-		{ 0, 1, 1, 0, 0, -1, -1, 0 },
-		{ 1, 0, 0, 1, -1, 0, 0, -1 },
-	};
+	if (algorithm_ == FovAlgorithm::RECURSIVE)
+	{
+		for (int oct = 0; oct < 8; ++oct)
+		{
+			scan_octant(
+				panelX,
+				panelY,
+				radius,
+				1,
+				1.0f,
+				0.0f,
+				OCTANT_MULT[0][oct],
+				OCTANT_MULT[1][oct],
+				OCTANT_MULT[2][oct],
+				OCTANT_MULT[3][oct]);
+		}
+		PROFILE_COUNT(ProfileCounter::FOV_CELLS, static_cast<int64_t>(visibleCells_.size()));
+		return;
+	}
+
+	// When the whole radius square lies on the map no cell needs a bounds check.
+	const bool interior = radius_fits(panelX, panelY, radius);
 
 	for (int oct = 0; oct < 8; ++oct)
 	{
-		scan_octant(
+		scan_octant_iterative(
 			panelX,
 			panelY,
 			radius,
-			1,
-			1.0f,
-			0.0f,
-			mult[0][oct],
-			mult[1][oct],
-			mult[2][oct],
-			mult[3][oct]);
+			interior,
+			OCTANT_MULT[0][oct],
+			OCTANT_MULT[1][oct],
+			OCTANT_MULT[2][oct],
+			OCTANT_MULT[3][oct],
+			scratch_.stack,
+			[this](int index) { mark_visible(index); });
 	}
+	PROFILE_COUNT(ProfileCounter::FOV_CELLS, static_cast<int64_t>(visibleCells_.size()));
+}
+
+void FovMap::compute_fov_from(int x, int y, int radius, FovScratch& scratch) const
+{
+	scratch.cells.clear();
+	if (!in_bounds(x, y))
+	{
+		return;
+	}
+
+	scratch.cells.push_back(cell_index(x, y));
+
+	const bool interior = radius_fits(x, y, radius);
+	for (int oct = 0; oct < 8; ++oct)
+	{
+		scan_octant_iterative(
+			x,
+			y,
+			radius,
+			interior,
+			OCTANT_MULT[0][oct],
+			OCTANT_MULT[1][oct],
+			OCTANT_MULT[2][oct],
+			OCTANT_MULT[3][oct],
+			scratch.stack,
+			[&scratch](int index) { scratch.cells.push_back(index); });
+	}
+	PROFILE_COUNT(ProfileCounter::FOV_CELLS, static_cast<int64_t>(scratch.cells.size()));
 }
 
 void FovMap::scan_octant(
@@ -138,12 +273,12 @@ void FovMap::scan_octant(
 
 			if (in_bounds(sx, sy) && dx * dx + dy * dy <= radius * radius)
 			{
-				cells_[cell_index(sx, sy)].visible = true;
+				mark_visible(cell_index(sx, sy));
 			}
 
 			if (blocked)
 			{
-				if (!in_bounds(sx, sy) || !cells_[cell_index(sx, sy)].transparent)
+				if (!in_bounds(sx, sy) || !transparent_.test(cell_index(sx, sy)))
 				{
 					new_start = r_slope;
 				}
@@ -153,7 +288,7 @@ void FovMap::scan_octant(
 					start = new_start;
 				}
 			}
-			else if (!in_bounds(sx, sy) || !cells_[cell_index(sx, sy)].transparent)
+			else if (!in_bounds(sx, sy) || !transparent_.test(cell_index(sx, sy)))
 			{
 				blocked = true;
 				if (i < radius)
@@ -170,3 +305,120 @@ void FovMap::scan_octant(
 		}
 	}
 }
+
+// ---------------------------------------------------------------------------
+// Iterative shadowcasting -- same scan as scan_octant, cell for cell.
+//
+// Slopes are kept as exact fractions: with dy = -i the float slopes
+// (dx - 0.5) / (dy + 0.5) and (dx + 0.5) / (dy - 0.5) equal
+// (1 - 2dx) / (2i - 1) and (-2dx - 1) / (2i + 1). Distinct fractions with
+// these small denominators never round to the same float, so comparisons
+// agree with the reference. Instead of recursing at a shadow edge the
+// pending sub-scan is pushed onto the scratch stack; the visible set is a
+// union, so processing order does not matter.
+// ---------------------------------------------------------------------------
+
+template <typename Mark>
+void FovMap::scan_octant_iterative(
+	int cx,
+	int cy,
+	int radius,
+	bool interior,
+	int xx,
+	int xy,
+	int yx,
+	int yy,
+	std::vector<FovScratch::Frame>& stack,
+	Mark&& mark) const
+{
+	using Slope = FovScratch::Slope;
+
+	// a < b for fractions with positive denominators. Numerators and
+	// denominators are at most 2 * radius + 1, so products fit an int.
+	auto less = [](Slope a, Slope b) noexcept
+	{
+		return a.num * b.den < b.num * a.den;
+	};
+
+	const int radiusSq = radius * radius;
+
+	stack.clear();
+	stack.push_back(FovScratch::Frame{ 1, Slope{ 1, 1 }, Slope{ 0, 1 } });
+
+	while (!stack.empty())
+	{
+		const FovScratch::Frame frame = stack.back();
+		stack.pop_back();
+
+		Slope start = frame.start;
+		const Slope end = frame.end;
+		if (less(start, end))
+		{
+			continue;
+		}
+
+		Slope newStart = start;
+
+		for (int i = frame.row; i <= radius; ++i)
+		{
+			bool blocked = false;
+
+			// Cell (dx, -i) in octant space; step the map position per column.
+			int sx = cx - i * xx - i * xy;
+			int sy = cy - i * yx - i * yy;
+
+			for (int dx = -i; dx <= 0; ++dx, sx += xx, sy += yx)
+			{
+				const Slope lSlope{ 1 - 2 * dx, 2 * i - 1 };
+				const Slope rSlope{ -2 * dx - 1, 2 * i + 1 };
+
+				if (less(start, rSlope))
+				{
+					continue;
+				}
+
+				if (less(lSlope, end))
+				{
+					break;
+				}
+
+				const bool onMap = interior || in_bounds(sx, sy);
+				const int index = onMap ? cell_index(sx, sy) : -1;
+
+				if (onMap && dx * dx + i * i <= radiusSq)
+				{
+					mark(index);
+				}
+
+				const bool opaque = !onMap || !transparent_.test(index);
+
+				if (blocked)
+				{
+					if (opaque)
+					{
+						newStart = rSlope;
+					}
+					else
+					{
+						blocked = false;
+						start = newStart;
+					}
+				}
+				else if (opaque)
+				{
+					blocked = true;
+					if (i < radius)
+					{
+						stack.push_back(FovScratch::Frame{ i + 1, start, lSlope });
+					}
+					newStart = rSlope;
+				}
+			}
+
+			if (blocked)
+			{
+				break;
+			}
+		}
+	}
+}
@@ -1,41 +1,121 @@
 #pragma once
 // FovMap.h -- standalone FOV grid replacing libtcod TCODMap.
 
+#include <cstdint>
 #include <vector>
 
+#include "BitPlane.h"
+
 // ---------------------------------------------------------------------------
-// FovCell -- per-cell flags used by FovMap.
+// FovAlgorithm -- shadowcasting engine used by FovMap::compute_fov.
+//
+// RECURSIVE is the original float-slope implementation and serves as the
+// reference. ITERATIVE produces the same cells using exact integer slopes,
+// an explicit scan stack and bounds checks hoisted out of the inner loop
+// when the whole radius fits on the map.
 // ---------------------------------------------------------------------------
-struct FovCell
+enum class FovAlgorithm
 {
-	bool walkable{ false };
-	bool transparent{ false };
-	bool visible{ false };
+	RECURSIVE,
+	ITERATIVE
+};
+
+// ---------------------------------------------------------------------------
+// FovScratch -- reusable buffers for the iterative engine.
+//
+// FovMap keeps one for compute_fov; callers of compute_fov_from own theirs,
+// so several viewers can be computed against one const FovMap.
+// ---------------------------------------------------------------------------
+struct FovScratch
+{
+	// Integer slope num / den with den > 0; row i, column dx of an octant
+	// has edges (1 - 2dx) / (2i - 1) and (-2dx - 1) / (2i + 1).
+	struct Slope
+	{
+		int num{};
+		int den{ 1 };
+	};
+	struct Frame
+	{
+		int row{};
+		Slope start{};
+		Slope end{};
+	};
+
+	std::vector<Frame> stack;
+	std::vector<int> cells; // output of compute_fov_from; edge cells may repeat
 };
 
 // ---------------------------------------------------------------------------
 // FovMap -- replaces TCODMap.
 //
 // Stores per-cell walkability/transparency and computes FOV using
-// recursive shadowcasting (Bjorn Pettersen's algorithm).
+// shadowcasting (Bjorn Pettersen's algorithm). Each flag is a BitPlane
+// indexed y * width + x, so whole-map consumers can read the visible set
+// word by word.
 // ---------------------------------------------------------------------------
 class FovMap
 {
 public:
 	FovMap(int width, int height);
 
+	int get_width() const noexcept { return width_; }
+	int get_height() const noexcept { return height_; }
+
+	void set_algorithm(FovAlgorithm algorithm) noexcept { algorithm_ = algorithm; }
+	FovAlgorithm get_algorithm() const noexcept { return algorithm_; }
+
 	void set_properties(int x, int y, bool walkable, bool transparent) noexcept;
 	bool is_walkable(int x, int y) const noexcept;
+	bool is_transparent(int x, int y) const noexcept;
 	bool is_in_fov(int x, int y) const noexcept;
 	void compute_fov(int panelX, int panelY, int radius);
 
+	// Visibility from (x, y) without touching this map's visible set: fills
+	// scratch.cells with visible indices (duplicates possible). Always uses
+	// the iterative engine.
+	void compute_fov_from(int x, int y, int radius, FovScratch& scratch) const;
+
+	// Changes whenever transparency changes. Versions come from one
+	// process-wide counter, so they never repeat across FovMap instances and
+	// a cached result can be validated by version alone.
+	uint64_t get_version() const noexcept { return version_; }
+
+	// Changes whenever walkability changes; same counter as get_version().
+	uint64_t get_walkable_version() const noexcept { return walkableVersion_; }
+
+	// Moves the indices whose walkability flipped since the last call into
+	// out (replacing its contents). Returns false when the log overflowed --
+	// a fresh map or a bulk rewrite such as generation or load -- in which
+	// case out is empty and the caller should rescan walkable_plane().
+	bool take_walkable_changes(std::vector<int>& out);
+
+	const BitPlane& walkable_plane() const noexcept { return walkable_; }
+	const BitPlane& transparent_plane() const noexcept { return transparent_; }
+	const BitPlane& visible_plane() const noexcept { return visible_; }
+
+	// Indices (y * width + x) marked visible by the last compute_fov, each
+	// listed once. Consumers such as explored-stamping read only these, so
+	// per-turn cost depends on FOV radius rather than map size.
+	const std::vector<int>& visible_cells() const noexcept { return visibleCells_; }
+
 private:
 	int width_;
 	int height_;
-	std::vector<FovCell> cells_;
+	BitPlane walkable_;
+	BitPlane transparent_;
+	BitPlane visible_;
+	std::vector<int> visibleCells_;
+	std::vector<int> walkableChanges_;
+	bool walkableChangesOverflowed_{ true }; // a new map counts as all-changed
+	FovAlgorithm algorithm_{ FovAlgorithm::ITERATIVE };
+	FovScratch scratch_; // reused across calls, never shrinks
+	uint64_t version_;
+	uint64_t walkableVersion_;
 
 	bool in_bounds(int x, int y) const noexcept;
 	int cell_index(int x, int y) const noexcept;
+	void mark_visible(int index);
 
 	void scan_octant(
 		int cx,
@@ -48,4 +128,20 @@ private:
 		int xy,
 		int yx,
 		int yy);
+
+	bool radius_fits(int cx, int cy, int radius) const noexcept;
+
+	// Calls mark(index) for each visible cell of one octant.
+	template <typename Mark>
+	void scan_octant_iterative(
+		int cx,
+		int cy,
+		int radius,
+		bool interior,
+		int xx,
+		int xy,
+		int yx,
+		int yy,
+		std::vector<FovScratch::Frame>& stack,
+		Mark&& mark) const;
 };
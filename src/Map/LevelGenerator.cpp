@@ -0,0 +1,190 @@
+// LevelGenerator.cpp -- generates dungeon levels apart from the live game.
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <utility>
+
+#include "../Actor/Actor.h"
+#include "../Actor/Creature.h"
+#include "../Actor/Object.h"
+#include "../Actor/Stairs.h"
+#include "../Colors/Colors.h"
+#include "../Core/GameContext.h"
+#include "../Random/RandomDice.h"
+#include "../Systems/CreatureManager.h"
+#include "../Systems/LevelManager.h"
+#include "../Systems/MessageSystem.h"
+#include "../Tools/DecorEditor.h"
+#include "Decoration.h"
+#include "LevelGenerator.h"
+#include "Map.h"
+
+namespace
+{
+	// Map::init seeds the layout RNG with the level seed; spawns draw from
+	// a second stream so the two never walk the same sequence.
+	unsigned int spawn_seed(long levelSeed) noexcept
+	{
+		return static_cast<unsigned int>(levelSeed) * 2654435761u + 0x6D2B79F5u;
+	}
+} // namespace
+
+GeneratedLevel::GeneratedLevel(int width, int height) : map(width, height) {}
+
+GeneratedLevel::~GeneratedLevel() = default;
+
+LevelGenerator::~LevelGenerator()
+{
+	discard();
+}
+
+LevelRequest LevelGenerator::make_request(const GameContext& ctx, int dungeonLevel, long seed)
+{
+	LevelRequest request;
+	request.dungeonLevel = dungeonLevel;
+	request.seed = seed;
+	request.width = get_map_width();
+	request.height = get_map_height();
+	if (ctx.map)
+	{
+		request.fovAlgorithm = ctx.map->get_fov_algorithm();
+	}
+	if (ctx.decorEditor)
+	{
+		request.decorOverrides = ctx.decorEditor->get_map_overrides(seed, dungeonLevel);
+	}
+	request.dataManager = ctx.dataManager;
+	request.contentRegistry = ctx.contentRegistry;
+	request.prefabLibrary = ctx.prefabLibrary;
+	request.tileConfig = ctx.tileConfig;
+	return request;
+}
+
+std::unique_ptr<GeneratedLevel> LevelGenerator::generate(const LevelRequest& request)
+{
+	auto level = std::make_unique<GeneratedLevel>(request.width, request.height);
+	level->dungeonLevel = request.dungeonLevel;
+	level->seed = request.seed;
+	level->map.set_fov_algorithm(request.fovAlgorithm);
+
+	RandomDice dice{ spawn_seed(request.seed) };
+	MessageSystem messages;
+	CreatureManager creatureManager;
+	LevelManager levelManager;
+	levelManager.set_dungeon_level(request.dungeonLevel);
+	DecorEditor decor;
+	decor.set_map_overrides(request.seed, request.dungeonLevel, request.decorOverrides);
+	Stairs stairs{ Vector2D{ 0, 0 } };
+	// Generation only places the player; the real one moves there on commit.
+	Creature player{ Vector2D{ 0, 0 }, ActorData{ TileRef{}, "player", WHITE_BLACK_PAIR } };
+
+	GameContext ctx{
+		.map = &level->map,
+		.player = &player,
+		.messageSystem = &messages,
+		.dice = &dice,
+		.creatureManager = &creatureManager,
+		.levelManager = &levelManager,
+		.dataManager = request.dataManager,
+		.contentRegistry = request.contentRegistry,
+		.decorEditor = &decor,
+		.prefabLibrary = request.prefabLibrary,
+		.tileConfig = request.tileConfig,
+		.stairs = &stairs,
+		.objects = &level->objects,
+		.decorations = &level->decorations,
+		.floorInventory = &level->floorItems,
+		.creatures = &level->creatures,
+		.rooms = &level->rooms,
+	};
+	level->map.init(ctx, request.seed);
+
+	level->playerPosition = player.position;
+	level->stairsPosition = stairs.position;
+	level->shopkeepers = levelManager.get_shopkeepers_count();
+	level->decorOverrides = decor.get_map_overrides(request.seed, request.dungeonLevel);
+	for (size_t i = 0; i < messages.get_stored_message_count(); ++i)
+	{
+		level->messages.push_back(messages.get_attack_message_at(i));
+	}
+	return level;
+}
+
+void LevelGenerator::commit(GeneratedLevel& level, GameContext& ctx)
+{
+	*ctx.map = std::move(level.map);
+	*ctx.rooms = std::move(level.rooms);
+	*ctx.creatures = std::move(level.creatures);
+	ctx.floorInventory->items = std::move(level.floorItems.items);
+	*ctx.objects = std::move(level.objects);
+	*ctx.decorations = std::move(level.decorations);
+	ctx.player->position = level.playerPosition;
+	ctx.stairs->position = level.stairsPosition;
+	ctx.levelManager->set_shopkeepers_count(level.shopkeepers);
+
+	if (ctx.creatureManager)
+	{
+		ctx.creatureManager->bind_occupancy(ctx.map->get_width(), ctx.map->get_height());
+	}
+	if (ctx.decorEditor)
+	{
+		ctx.decorEditor->set_map_overrides(level.seed, level.dungeonLevel, std::move(level.decorOverrides));
+		ctx.decorEditor->set_active_map(level.seed, level.dungeonLevel);
+	}
+	ctx.map->rebuild_decoration_index(ctx);
+
+	for (const std::vector<LogMessage>& message : level.messages)
+	{
+		for (const LogMessage& part : message)
+		{
+			ctx.messageSystem->append_message_part(part.logMessageColor, part.logMessageText);
+		}
+		ctx.messageSystem->finalize_message();
+	}
+}
+
+void LevelGenerator::prefetch(const GameContext& ctx, int dungeonLevel, long seed)
+{
+#ifndef EMSCRIPTEN
+	if (is_prefetched(dungeonLevel, seed))
+	{
+		return;
+	}
+	discard();
+	pendingLevel = dungeonLevel;
+	pendingSeed = seed;
+	pending = std::async(std::launch::async, [request = make_request(ctx, dungeonLevel, seed)]
+	{
+		return generate(request);
+	});
+#endif
+}
+
+void LevelGenerator::enter_level(GameContext& ctx, int dungeonLevel, long seed)
+{
+	std::unique_ptr<GeneratedLevel> level;
+	if (is_prefetched(dungeonLevel, seed))
+	{
+		level = pending.get(); // rethrows anything generate threw
+	}
+	else
+	{
+		discard();
+		level = generate(make_request(ctx, dungeonLevel, seed));
+	}
+	commit(*level, ctx);
+}
+
+void LevelGenerator::discard()
+{
+	if (pending.valid())
+	{
+		pending.wait();
+		pending = {};
+	}
+}
+
+bool LevelGenerator::is_prefetched(int dungeonLevel, long seed) const noexcept
+{
+	return pending.valid() && pendingLevel == dungeonLevel && pendingSeed == seed;
+}
@@ -0,0 +1,115 @@
+#pragma once
+// LevelGenerator.h -- generates dungeon levels apart from the live game.
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "../Actor/InventoryData.h"
+#include "../Gui/LogMessage.h"
+#include "../Renderer/Renderer.h"
+#include "../Utils/Vector2D.h"
+#include "DungeonRoom.h"
+#include "FovMap.h"
+#include "Map.h"
+
+class ContentRegistry;
+class Creature;
+class DataManager;
+class Object;
+class PrefabLibrary;
+class TileConfig;
+struct Decoration;
+struct GameContext;
+
+// Everything a level is generated from. Besides the seed and depth this is
+// the content generation reads: registries, tiles and prefabs are shared
+// with the game and must not change while a level generates.
+struct LevelRequest
+{
+	int dungeonLevel{ 1 };
+	long seed{ 0 };
+	int width{ DEFAULT_MAP_WIDTH };
+	int height{ DEFAULT_MAP_HEIGHT };
+	FovAlgorithm fovAlgorithm{ FovAlgorithm::ITERATIVE };
+	std::unordered_map<uint32_t, TileRef> decorOverrides; // DecorEditor bucket for (seed, level)
+
+	DataManager* dataManager{ nullptr };
+	ContentRegistry* contentRegistry{ nullptr };
+	PrefabLibrary* prefabLibrary{ nullptr };
+	const TileConfig* tileConfig{ nullptr };
+};
+
+// A generated level not yet in play: the map and everything Map::init
+// would have put into the game context.
+struct GeneratedLevel
+{
+	explicit GeneratedLevel(int width, int height);
+	~GeneratedLevel();
+	GeneratedLevel(const GeneratedLevel&) = delete;
+	GeneratedLevel& operator=(const GeneratedLevel&) = delete;
+
+	int dungeonLevel{};
+	long seed{};
+	Map map;
+	std::vector<DungeonRoom> rooms;
+	std::vector<std::unique_ptr<Creature>> creatures;
+	std::vector<std::unique_ptr<Object>> objects;
+	std::vector<std::unique_ptr<Decoration>> decorations;
+	FloorInventory floorItems{ 1000 };
+	std::unordered_map<uint32_t, TileRef> decorOverrides;
+	Vector2D playerPosition{};
+	Vector2D stairsPosition{};
+	int shopkeepers{ 0 };
+	std::vector<std::vector<LogMessage>> messages; // shown once the level is entered
+};
+
+// ---------------------------------------------------------------------------
+// LevelGenerator -- builds the next level while the current one is played.
+//
+// generate() runs Map::init against a private context: its own dice seeded
+// from the level seed, its own creature, item and decoration lists and a
+// stand-in for the player. The result depends on the request alone, so a
+// level built on the worker thread is bit-identical to one built on the
+// game thread from the same seed, and descending commits it by moving
+// containers. The descent path always goes through here; prefetch only
+// decides whether the work is already done when the player arrives.
+// Without threads (Emscripten) prefetch does nothing.
+// ---------------------------------------------------------------------------
+class LevelGenerator
+{
+public:
+	LevelGenerator() = default;
+	~LevelGenerator();
+	LevelGenerator(const LevelGenerator&) = delete;
+	LevelGenerator& operator=(const LevelGenerator&) = delete;
+
+	// Game thread: copies what generation reads out of ctx.
+	[[nodiscard]] static LevelRequest make_request(const GameContext& ctx, int dungeonLevel, long seed);
+
+	// Any thread.
+	[[nodiscard]] static std::unique_ptr<GeneratedLevel> generate(const LevelRequest& request);
+
+	// Game thread: replaces the current level in ctx with the generated one.
+	static void commit(GeneratedLevel& level, GameContext& ctx);
+
+	// Starts generating (dungeonLevel, seed) in the background, replacing
+	// any prefetch for a different level.
+	void prefetch(const GameContext& ctx, int dungeonLevel, long seed);
+
+	// Enters (dungeonLevel, seed): takes the prefetched level if it matches,
+	// otherwise generates it now, then commits it.
+	void enter_level(GameContext& ctx, int dungeonLevel, long seed);
+
+	// Drops a prefetched level; call before game content is edited.
+	void discard();
+
+	[[nodiscard]] bool is_prefetched(int dungeonLevel, long seed) const noexcept;
+
+private:
+	std::future<std::unique_ptr<GeneratedLevel>> pending;
+	int pendingLevel{ 0 };
+	long pendingSeed{ 0 };
+};
@@ -0,0 +1,59 @@
+#pragma once
+// LosCache.h -- small direct-mapped cache of line-of-sight results.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "../Utils/Vector2D.h"
+
+// ---------------------------------------------------------------------------
+// LosCache -- remembers recent has_los(from, to) answers.
+//
+// Targeting asks the same (player, cursor) question every frame and ranged
+// monsters repeat theirs every turn. Each slot stores the FovMap version it
+// was computed against, so any transparency change (set_tile, doors)
+// invalidates every entry without the cache being told. Collisions simply
+// overwrite.
+// ---------------------------------------------------------------------------
+class LosCache
+{
+public:
+	std::optional<bool> find(Vector2D from, Vector2D to, uint64_t version) const noexcept
+	{
+		const Entry& entry = entries[slot(from, to)];
+		if (entry.version == version && entry.from == from && entry.to == to)
+		{
+			return entry.visible;
+		}
+		return std::nullopt;
+	}
+
+	void store(Vector2D from, Vector2D to, uint64_t version, bool visible) noexcept
+	{
+		entries[slot(from, to)] = Entry{ from, to, version, visible };
+	}
+
+private:
+	static constexpr size_t SLOT_COUNT = 256;
+
+	struct Entry
+	{
+		Vector2D from{};
+		Vector2D to{};
+		uint64_t version{ 0 }; // FovMap versions start at 1, so 0 never matches
+		bool visible{ false };
+	};
+
+	std::array<Entry, SLOT_COUNT> entries{};
+
+	static size_t slot(Vector2D from, Vector2D to) noexcept
+	{
+		const uint32_t h = static_cast<uint32_t>(from.x) * 73856093u
+			^ static_cast<uint32_t>(from.y) * 19349663u
+			^ static_cast<uint32_t>(to.x) * 83492791u
+			^ static_cast<uint32_t>(to.y) * 2654435761u;
+		return (h ^ (h >> 16)) & (SLOT_COUNT - 1);
+	}
+};
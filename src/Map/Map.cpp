@@ -1,5 +1,6 @@
 // file: Map.cpp
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdint>
@@ -10,6 +11,8 @@
 #include <queue>
 #include <set>
 #include <ranges>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -24,15 +27,21 @@
 #include "../Factories/ItemFactory.h"
 #include "../Factories/MonsterCreator.h"
 #include "../Factories/MonsterFactory.h"
+#include "../Persistent/Base64.h"
+#include "../Persistent/BinaryStream.h"
 #include "../Persistent/Persistent.h"
+#include "../Persistent/RunLength.h"
 #include "../Random/RandomDice.h"
 #include "../Renderer/Renderer.h"
+#include "../Renderer/TerrainCache.h"
+#include "../Systems/CreatureManager.h"
 #include "../Systems/EncounterPlanner.h"
 #include "../Systems/LevelManager.h"
 #include "../Systems/MessageSystem.h"
 #include "../Systems/TileConfig.h"
 #include "../Tools/DecorEditor.h"
 #include "../Tools/PrefabLibrary.h"
+#include "../Utils/BresenhamLine.h"
 #include "../Utils/Vector2D.h"
 #include "Decoration.h"
 #include "DungeonGenerator.h"
@@ -44,6 +53,17 @@
 
 namespace
 {
+	// Shared by every Map so a version never repeats across levels.
+	std::atomic<uint64_t> nextViewVersion{ 1 };
+
+	void check_saved_size(int width, int height)
+	{
+		if (width <= 0 || height <= 0 || width > MAX_MAP_WIDTH || height > MAX_MAP_HEIGHT)
+		{
+			throw std::runtime_error(std::format("Saved map has invalid size {}x{}.", width, height));
+		}
+	}
+
 	// Returns true if `target` is reachable from `start` without crossing a
 	// locked door or a wall. Used to assert that the jailer spawn is on the
 	// correct (corridor) side of the locked treasure room door.
@@ -135,6 +155,45 @@ namespace
 		}
 		}
 	}
+
+	// Movement cost of each tile type, as set_tile's callers assign it.
+	// Saves store only the type; loading derives the cost from it.
+	double tile_cost_for(TileType type) noexcept
+	{
+		switch (type)
+		{
+		case TileType::FLOOR:
+		case TileType::CORRIDOR:
+		case TileType::OPEN_DOOR:
+		{
+			return 1;
+		}
+		case TileType::CLOSED_DOOR:
+		{
+			return 2;
+		}
+		case TileType::WATER:
+		{
+			return 10;
+		}
+		case TileType::WALL:
+		default:
+		{
+			return 0;
+		}
+		}
+	}
+
+	std::span<const uint8_t> json_plane(const json& planes, const char* key, std::vector<uint8_t>& storage)
+	{
+		std::optional<std::vector<uint8_t>> bytes = Base64::decode(planes.at(key).get<std::string>());
+		if (!bytes)
+		{
+			throw std::runtime_error(std::format("Saved map plane '{}' is not valid base64.", key));
+		}
+		storage = std::move(*bytes);
+		return storage;
+	}
 }
 
 //====
@@ -143,10 +202,12 @@ Map::Map(int mapWidth, int mapHeight)
 	  mapWidth(mapWidth),
 	  monsterFactory(std::make_unique<MonsterFactory>()),
 	  itemFactory(std::make_unique<ItemFactory>()),
-	  dijkstraCosts(static_cast<size_t>(mapWidth) * mapHeight, std::numeric_limits<int>::max()),
 	  fovMap(std::make_unique<FovMap>(mapWidth, mapHeight)),
 	  seed(0)
 {
+	playerFlow.resize(mapWidth, mapHeight);
+	reset_terrain_versions();
+	autotileMasks.rebuild(tileGrid);
 }
 
 bool Map::in_bounds(Vector2D pos) const noexcept
@@ -158,33 +219,82 @@ bool Map::in_bounds(Vector2D pos) const noexcept
 
 void Map::init_tiles()
 {
-	tiles.clear();
+	tileGrid.resize(mapWidth, mapHeight);
 
 	// FovMap must be reset alongside tiles so can_walk / is_wall see correct
 	// state even when init_tiles is called standalone (e.g. in tests).
-	// All FovCells default to walkable=false, transparent=false — matches WALL.
+	// All FovMap bits default to walkable=false, transparent=false — matches WALL.
 	fovMap = std::make_unique<FovMap>(mapWidth, mapHeight);
+	fovMap->set_algorithm(fovAlgorithm);
+	creatureFov.clear();
+
+	decorationSlots.assign(tileGrid.size(), nullptr);
+	playerFlow.resize(mapWidth, mapHeight);
+	touch_view();
+	reset_terrain_versions();
+	autotileMasks.rebuild(tileGrid);
+}
+
+void Map::touch_view() noexcept
+{
+	viewVersion = nextViewVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Map::reset_terrain_versions()
+{
+	terrainChunksX = (mapWidth + TERRAIN_CHUNK_SIZE - 1) / TERRAIN_CHUNK_SIZE;
+	terrainChunksY = (mapHeight + TERRAIN_CHUNK_SIZE - 1) / TERRAIN_CHUNK_SIZE;
+	terrainVersions.assign(
+		static_cast<size_t>(terrainChunksX) * terrainChunksY,
+		nextViewVersion.fetch_add(1, std::memory_order_relaxed));
+}
 
-	for (int y = 0; y < mapHeight; y++)
+void Map::touch_terrain(Vector2D pos, int radius)
+{
+	const int firstX = std::max(0, pos.x - radius) / TERRAIN_CHUNK_SIZE;
+	const int firstY = std::max(0, pos.y - radius) / TERRAIN_CHUNK_SIZE;
+	const int lastX = std::min(terrainChunksX - 1, (pos.x + radius) / TERRAIN_CHUNK_SIZE);
+	const int lastY = std::min(terrainChunksY - 1, (pos.y + radius) / TERRAIN_CHUNK_SIZE);
+	if (firstX > lastX || firstY > lastY)
+	{
+		return;
+	}
+	const uint64_t version = nextViewVersion.fetch_add(1, std::memory_order_relaxed);
+	for (int chunkY = firstY; chunkY <= lastY; ++chunkY)
 	{
-		for (int x = 0; x < mapWidth; x++)
+		for (int chunkX = firstX; chunkX <= lastX; ++chunkX)
 		{
-			tiles.emplace_back(Tile(Vector2D{ x, y }, TileType::WALL, 0));
+			terrainVersions[static_cast<size_t>(chunkY) * terrainChunksX + chunkX] = version;
 		}
 	}
 }
 
+void Map::set_door_state(size_t index, DoorState state)
+{
+	tileGrid.set_door_state(index, state);
+	touch_terrain(tileGrid.position_of(index), 1);
+}
+
 //====
 // We have to move the map initialization code out of the constructor
 // for enabling loading the map from the file.
 void Map::init(GameContext& ctx)
+{
+	init(ctx, ctx.dice ? ctx.dice->mapgen().roll(0, std::numeric_limits<int>::max()) : 0);
+}
+
+void Map::init(GameContext& ctx, long levelSeed)
 {
 	init_tiles();  // resets tiles + fovMap to all-walls
+	if (ctx.creatureManager)
+	{
+		ctx.creatureManager->bind_occupancy(mapWidth, mapHeight);
+	}
 	if (ctx.messageSystem)
 	{
-		ctx.messageSystem->log("Map::init: " + std::to_string(mapWidth) + "x" + std::to_string(mapHeight) + " tile grid reset");
+		ctx.messageSystem->debug("Map::init: {}x{} tile grid reset", mapWidth, mapHeight);
 	}
-	seed = ctx.dice ? ctx.dice->roll(0, std::numeric_limits<int>::max()) : 0;
+	seed = levelSeed;
 	mapRng = RandomDice{ static_cast<unsigned int>(seed) };
 
 	// Register the active map key before rooms are generated so decoration
@@ -194,6 +304,9 @@ void Map::init(GameContext& ctx)
 		ctx.decorEditor->set_active_map(seed, ctx.levelManager->get_dungeon_level());
 	}
 
+	// Generation rewrites most tiles; patching masks per edit would redo
+	// each tile ~25 times, so compute them once at the end instead.
+	autotileDeferred = true;
 	generate_rooms(ctx);
 
 	post_process_doors();
@@ -203,6 +316,8 @@ void Map::init(GameContext& ctx)
 		maybe_create_treasure_room(ctx.levelManager->get_dungeon_level(), ctx);
 	}
 	place_amulet(ctx);
+	autotileDeferred = false;
+	autotileMasks.rebuild(tileGrid);
 }
 
 void Map::generate_rooms(GameContext& ctx)
@@ -212,39 +327,100 @@ void Map::generate_rooms(GameContext& ctx)
 	place_stairs(ctx);
 }
 
-void Map::load(const json& j)
+void Map::begin_load(int width, int height, long newSeed)
 {
-	mapWidth = j.at("map_width").get<int>();
-	mapHeight = j.at("map_height").get<int>();
-	seed = j.at("seed").get<int>();
+	check_saved_size(width, height);
+	mapWidth = width;
+	mapHeight = height;
+	seed = newSeed;
 
-	tiles.clear();
-	for (const auto& tileJson : j.at("tiles"))
-	{
-		Vector2D position(
-			tileJson.at("position").at("y").get<int>(),
-			tileJson.at("position").at("x").get<int>());
+	tileGrid.resize(mapWidth, mapHeight);
+	fovMap = std::make_unique<FovMap>(mapWidth, mapHeight);
+	fovMap->set_algorithm(fovAlgorithm);
+	creatureFov.clear();
+	playerFlow.resize(mapWidth, mapHeight);
+	touch_view();
+	reset_terrain_versions();
+	mapRng = RandomDice{ static_cast<unsigned int>(seed) };
+}
 
-		TileType type = static_cast<TileType>(tileJson.at("type").get<int>());
-		bool explored = tileJson.at("explored").get<bool>();
-		double cost = tileJson.at("cost").get<double>();
+void Map::load_tile(size_t index, TileType type, double cost, DoorState door)
+{
+	tileGrid.set_type(index, type);
+	tileGrid.set_cost(index, cost);
+	tileGrid.set_door_state(index, door);
+	++tileEdits;
 
-		tiles.emplace_back(position, type, cost);
-		tiles.back().explored = explored;
+	// Rebuild FOV grid from loaded tile data.
+	const Vector2D position = tileGrid.position_of(index);
+	const auto [walkable, transparent] = fov_properties_for(type);
+	fovMap->set_properties(position.x, position.y, walkable, transparent);
+}
+
+// One pass over the decoded planes; doors come back exactly as saved, so
+// post_process_doors is not rerun.
+void Map::load_planes(std::span<const uint8_t> typeRuns, std::span<const uint8_t> doorRuns, std::span<const uint8_t> exploredRuns)
+{
+	const size_t count = tileGrid.size();
+	std::vector<uint8_t> types(count);
+	std::vector<uint8_t> doors(count);
+	if (!RunLength::decode_bytes(typeRuns, types)
+		|| !RunLength::decode_bytes(doorRuns, doors)
+		|| !RunLength::decode_bits(exploredRuns, tileGrid.explored()))
+	{
+		throw std::runtime_error("Saved map planes do not match the map size.");
 	}
 
-	fovMap = std::make_unique<FovMap>(mapWidth, mapHeight);
-	mapRng = RandomDice{ static_cast<unsigned int>(seed) };
+	for (size_t index = 0; index < count; ++index)
+	{
+		if (types[index] > static_cast<uint8_t>(LAST_TILE_TYPE) || doors[index] > static_cast<uint8_t>(LAST_DOOR_STATE))
+		{
+			throw std::runtime_error("Saved map planes hold an unknown tile type or door state.");
+		}
+		const TileType type = static_cast<TileType>(types[index]);
+		load_tile(index, type, tile_cost_for(type), static_cast<DoorState>(doors[index]));
+	}
+	autotileMasks.rebuild(tileGrid);
+}
 
-	// Rebuild FOV grid from loaded tile data.
-	for (const auto& tile : tiles)
+void Map::load_legacy_tiles(const json& tiles)
+{
+	for (const auto& tileJson : tiles)
 	{
-		const auto [walkable, transparent] = fov_properties_for(tile.type);
-		fovMap->set_properties(tile.position.x, tile.position.y, walkable, transparent);
+		const Vector2D position{
+			tileJson.at("position").at("x").get<int>(),
+			tileJson.at("position").at("y").get<int>()
+		};
+		if (!tileGrid.in_bounds(position))
+		{
+			continue;
+		}
+
+		const size_t index = tileGrid.index_of(position);
+		load_tile(index, static_cast<TileType>(tileJson.at("type").get<int>()), tileJson.at("cost").get<double>(), DoorState::OPEN);
+		tileGrid.explored().assign(index, tileJson.at("explored").get<bool>());
 	}
 
-	// Post-process to place doors after loading map
+	// These saves carry no door states; place doors as generation does.
 	post_process_doors();
+	autotileMasks.rebuild(tileGrid);
+}
+
+void Map::load(const json& j)
+{
+	begin_load(j.at("map_width").get<int>(), j.at("map_height").get<int>(), j.at("seed").get<long>());
+
+	if (j.contains("tiles"))
+	{
+		load_legacy_tiles(j.at("tiles"));
+		return;
+	}
+
+	const json& planes = j.at("planes");
+	std::vector<uint8_t> types;
+	std::vector<uint8_t> doors;
+	std::vector<uint8_t> explored;
+	load_planes(json_plane(planes, "types", types), json_plane(planes, "doors", doors), json_plane(planes, "explored", explored));
 
 	// Note: Logging requires GameContext access - moved to caller
 }
@@ -254,18 +430,78 @@ void Map::save(json& j)
 	j["map_width"] = mapWidth;
 	j["map_height"] = mapHeight;
 	j["seed"] = seed;
+	j["planes"] = {
+		{ "types", Base64::encode(RunLength::encode_bytes(tileGrid.type_plane())) },
+		{ "doors", Base64::encode(RunLength::encode_bytes(tileGrid.door_plane())) },
+		{ "explored", Base64::encode(RunLength::encode_bits(tileGrid.explored())) }
+	};
+}
 
-	j["tiles"] = json::array();
-	for (const auto& tile : tiles)
+void Map::save(BinaryWriter& out) const
+{
+	out.write_i32(mapWidth);
+	out.write_i32(mapHeight);
+	out.write_u64(static_cast<uint64_t>(seed));
+
+	for (const std::vector<uint8_t>& runs : {
+		RunLength::encode_bytes(tileGrid.type_plane()),
+		RunLength::encode_bytes(tileGrid.door_plane()),
+		RunLength::encode_bits(tileGrid.explored()) })
 	{
-		j["tiles"].push_back(
-			{ { "position", { { "y", tile.position.y }, { "x", tile.position.x } } },
-				{ "type", static_cast<int>(tile.type) }, // TileType is an enum
-				{ "explored", tile.explored },
-				{ "cost", tile.cost } });
+		out.write_u32(static_cast<uint32_t>(runs.size()));
+		out.write_bytes(runs);
 	}
 }
 
+void Map::load(BinaryReader& in, uint32_t formatVersion)
+{
+	const int width = in.read_i32();
+	const int height = in.read_i32();
+	const long savedSeed = static_cast<long>(in.read_u64());
+	check_saved_size(width, height);
+
+	// Format 1 stores every tile raw (type, cost, then explored words); format
+	// 2 at least the three run lengths. A section shorter than that is cut.
+	const size_t count = static_cast<size_t>(width) * static_cast<size_t>(height);
+	const size_t minimum = formatVersion >= 2 ? 3 * sizeof(uint32_t) : 2 * count + (count + 63) / 64 * sizeof(uint64_t);
+	if (in.remaining() < minimum)
+	{
+		throw std::runtime_error(std::format("Saved map of {}x{} needs {} bytes, the section holds {}.", width, height, minimum, in.remaining()));
+	}
+	begin_load(width, height, savedSeed);
+
+	if (formatVersion >= 2)
+	{
+		const std::span<const uint8_t> typeRuns = in.read_bytes(in.read_u32());
+		const std::span<const uint8_t> doorRuns = in.read_bytes(in.read_u32());
+		const std::span<const uint8_t> exploredRuns = in.read_bytes(in.read_u32());
+		load_planes(typeRuns, doorRuns, exploredRuns);
+		return;
+	}
+
+	// Format 1: raw type and cost planes, then the explored words.
+	const std::span<const uint8_t> types = in.read_bytes(count);
+	const std::span<const uint8_t> costs = in.read_bytes(count);
+	for (size_t index = 0; index < count; ++index)
+	{
+		if (types[index] > static_cast<uint8_t>(LAST_TILE_TYPE))
+		{
+			throw std::runtime_error("Saved map planes hold an unknown tile type.");
+		}
+		load_tile(index, static_cast<TileType>(types[index]), costs[index], DoorState::OPEN);
+	}
+	for (size_t index = 0; index < count; index += 64)
+	{
+		const uint64_t word = in.read_u64();
+		for (size_t bit = 0; bit < 64 && index + bit < count; ++bit)
+		{
+			tileGrid.explored().assign(index + bit, (word >> bit) & 1u);
+		}
+	}
+	post_process_doors();
+	autotileMasks.rebuild(tileGrid);
+}
+
 bool Map::is_wall(Vector2D pos) const noexcept
 {
 	return !fovMap->is_walkable(pos.x, pos.y);
@@ -279,12 +515,12 @@ bool Map::is_explored(Vector2D pos) const noexcept
 		return false;
 	}
 	size_t index = get_index(pos);
-	if (index >= tiles.size())
+	if (index >= tileGrid.size())
 	{
 		// Logging moved to callers with GameContext access
 		return false;
 	}
-	return tiles.at(index).explored;
+	return tileGrid.explored().test(index);
 }
 
 void Map::set_explored(Vector2D pos)
@@ -293,7 +529,13 @@ void Map::set_explored(Vector2D pos)
 	{
 		return; // Can't set explored for out of bounds positions
 	}
-	tiles.at(get_index(pos)).explored = true;
+	const size_t index = get_index(pos);
+	if (!tileGrid.explored().test(index))
+	{
+		tileGrid.explored().set(index);
+		touch_view();
+		touch_terrain(pos, 1);
+	}
 }
 
 bool Map::is_in_fov(Vector2D pos) const noexcept
@@ -307,7 +549,7 @@ bool Map::is_water(Vector2D pos) const noexcept
 	{
 		return false; // Out of bounds positions are not water
 	}
-	return tiles.at(get_index(pos)).type == TileType::WATER;
+	return tileGrid.type(get_index(pos)) == TileType::WATER;
 }
 
 TileType Map::get_tile_type(Vector2D pos) const noexcept
@@ -316,7 +558,7 @@ TileType Map::get_tile_type(Vector2D pos) const noexcept
 	{
 		return TileType::WALL; // Out of bounds positions are treated as walls
 	}
-	return tiles.at(get_index(pos)).type;
+	return tileGrid.type(get_index(pos));
 }
 
 // returns true if the player after a successful move
@@ -383,20 +625,127 @@ void Map::tile_action(Creature& owner, TileType tileType, GameContext& ctx)
 
 Decoration* Map::find_decoration_at(Vector2D pos, const GameContext& ctx) const noexcept
 {
-	if (!ctx.decorations)
+	if (!ctx.decorations || !in_bounds(pos))
 	{
 		return nullptr;
 	}
 
-	for (auto& d : *ctx.decorations)
+	if (decorationSlots.size() != tileGrid.size())
 	{
-		if (d && !d->isBroken && d->position == pos)
+		// Index not built for this grid (blank test maps) -- scan instead.
+		for (auto& d : *ctx.decorations)
 		{
-			return d.get();
+			if (d && !d->isBroken && d->position == pos)
+			{
+				return d.get();
+			}
 		}
+		return nullptr;
 	}
 
-	return nullptr;
+	return decorationSlots[pos.y * mapWidth + pos.x];
+}
+
+void Map::add_decoration(std::unique_ptr<Decoration> decor, GameContext& ctx)
+{
+	if (!ctx.decorations || !decor)
+	{
+		return;
+	}
+
+	const Vector2D pos = decor->position;
+	if (!decor->isBroken && in_bounds(pos) && decorationSlots.size() == tileGrid.size())
+	{
+		Decoration*& slot = decorationSlots[pos.y * mapWidth + pos.x];
+		if (!slot)
+		{
+			slot = decor.get();
+			playerFlow.set_passable(pos.y * mapWidth + pos.x, false);
+		}
+	}
+	ctx.decorations->push_back(std::move(decor));
+}
+
+// Blocking decoration for a sprite stamped by a prefab or the decor editor.
+void Map::stamp_decoration(Vector2D pos, TileRef tile, GameContext& ctx)
+{
+	if (auto* existing = find_decoration_at(pos, ctx))
+	{
+		existing->tile = tile;
+		return;
+	}
+
+	auto d = std::make_unique<Decoration>();
+	d->position = pos;
+	d->tile = tile;
+	d->name = "decoration";
+	d->hp = 3;
+	d->blocks_movement = true;
+	d->lootTableKey = "";
+	d->isBroken = false;
+	add_decoration(std::move(d), ctx);
+}
+
+void Map::break_decoration(Decoration& decor, GameContext& ctx)
+{
+	decor.isBroken = true;
+
+	const Vector2D pos = decor.position;
+	if (in_bounds(pos) && decorationSlots.size() == tileGrid.size())
+	{
+		Decoration*& slot = decorationSlots[pos.y * mapWidth + pos.x];
+		if (slot == &decor)
+		{
+			slot = nullptr;
+			const size_t index = pos.y * mapWidth + pos.x;
+			playerFlow.set_passable(index, is_flow_passable(index));
+		}
+	}
+
+	if (ctx.decorEditor)
+	{
+		ctx.decorEditor->erase(pos.x, pos.y);
+	}
+}
+
+void Map::prune_decorations(GameContext& ctx)
+{
+	if (!ctx.decorations)
+	{
+		return;
+	}
+
+	const auto removed = std::erase_if(*ctx.decorations,
+		[](const auto& d)
+		{ return !d || d->isBroken; });
+
+	if (removed > 0)
+	{
+		rebuild_decoration_index(ctx);
+	}
+}
+
+void Map::rebuild_decoration_index(const GameContext& ctx)
+{
+	decorationSlots.assign(tileGrid.size(), nullptr);
+	if (!ctx.decorations)
+	{
+		resync_flow_passability();
+		return;
+	}
+
+	for (const auto& d : *ctx.decorations)
+	{
+		if (d && !d->isBroken && in_bounds(d->position))
+		{
+			Decoration*& slot = decorationSlots[d->position.y * mapWidth + d->position.x];
+			if (!slot)
+			{
+				slot = d.get();
+			}
+		}
+	}
+	resync_flow_passability();
 }
 
 bool Map::is_collision(Creature& owner, TileType tileType, Vector2D pos, GameContext& ctx)
@@ -471,76 +820,167 @@ void Map::compute_fov(GameContext& ctx)
 		ctx.player->position.y >= 0 && ctx.player->position.y < mapHeight &&
 		"Map::compute_fov: player position out of map bounds");
 
+	// Tiles leaving and entering the FOV change tint, so both sets dirty their chunks.
+	const uint64_t terrainVersion = nextViewVersion.fetch_add(1, std::memory_order_relaxed);
+	const auto touch_visible_chunks = [&]()
+	{
+		for (int index : fovMap->visible_cells())
+		{
+			// A chunk also draws the first column of its right neighbour.
+			const int x = index % mapWidth;
+			const int chunkY = (index / mapWidth) / TERRAIN_CHUNK_SIZE;
+			const size_t rowStart = static_cast<size_t>(chunkY) * terrainChunksX;
+			terrainVersions[rowStart + x / TERRAIN_CHUNK_SIZE] = terrainVersion;
+			if (x > 0 && x % TERRAIN_CHUNK_SIZE == 0)
+			{
+				terrainVersions[rowStart + x / TERRAIN_CHUNK_SIZE - 1] = terrainVersion;
+			}
+		}
+	};
+	touch_visible_chunks();
 	fovMap->compute_fov(ctx.player->position.x, ctx.player->position.y, FOV_RADIUS);
-	rebuild_dijkstra_map({ ctx.player->position }, ctx);
+	touch_visible_chunks();
+	touch_view();
+	const Vector2D goals[]{ ctx.player->position };
+	update_dijkstra_map(goals);
+}
+
+void Map::set_fov_algorithm(FovAlgorithm algorithm) noexcept
+{
+	fovAlgorithm = algorithm;
+	fovMap->set_algorithm(algorithm);
+}
+
+void Map::refresh_creature_fov(std::span<const std::unique_ptr<Creature>> creatures)
+{
+	creatureFov.refresh(*fovMap, creatures);
+}
+
+bool Map::creature_can_see(const Creature& viewer, Vector2D target)
+{
+	return creatureFov.can_see(*fovMap, viewer, target);
 }
 
 void Map::update()
 {
-	for (auto& tile : tiles)
+	BitPlane& explored = tileGrid.explored();
+	bool grew = false;
+	for (int index : fovMap->visible_cells())
 	{
-		if (is_in_fov(tile.position))
+		if (!explored.test(static_cast<size_t>(index)))
 		{
-			set_explored(tile.position);
+			explored.set(static_cast<size_t>(index));
+			if (!grew)
+			{
+				grew = true;
+				touch_view();
+			}
+			// The terrain looks the same (the tile is lit), but the minimap draws explored tiles.
+			touch_terrain(tileGrid.position_of(static_cast<size_t>(index)), 0);
 		}
 	}
 }
 
+// Terrain is drawn once per chunk into a render texture and blitted from
+// there; a chunk is redrawn only when its terrain version or the zoom
+// changed, or the animation frame did and the chunk holds animated tiles
+// such as wall torches. Chunks more than one chunk outside the view are
+// released so the cache follows the camera.
 void Map::render(const GameContext& ctx) const
 {
-	if (tiles.empty() || !ctx.renderer)
+	if (tileGrid.empty() || !ctx.renderer)
 	{
 		return;
 	}
 
-	int tileSize = ctx.renderer->get_tile_size();
-	int cameraX = ctx.renderer->get_camera_x();
-	int cameraY = ctx.renderer->get_camera_y();
-	int visibleCols = ctx.renderer->get_viewport_cols();
-	int visibleRows = ctx.renderer->get_viewport_rows() - GUI_RESERVE_ROWS;
+	Renderer& renderer = *ctx.renderer;
+	int tileSize = renderer.get_tile_size();
+	int cameraX = renderer.get_camera_x();
+	int cameraY = renderer.get_camera_y();
+	int visibleCols = renderer.get_viewport_cols();
+	int visibleRows = renderer.get_viewport_rows() - GUI_RESERVE_ROWS;
 
 	int startCol = std::max(0, cameraX / tileSize);
 	int startRow = std::max(0, cameraY / tileSize);
 	int endCol = std::min(mapWidth, startCol + visibleCols + 2);
 	int endRow = std::min(mapHeight, startRow + visibleRows + 2);
+	if (startCol >= endCol || startRow >= endRow)
+	{
+		return;
+	}
 
-	// Cardinal neighbor definitions: offset + bitmask bit
-	struct NeighborDef
+	TerrainCache& cache = renderer.get_terrain_cache();
+#ifndef EMSCRIPTEN
+	// The decor editor changes overrides under the cursor; draw directly
+	// while it is open and rebuild every chunk once it closes.
+	if (ctx.decorEditor && ctx.decorEditor->is_active())
 	{
-		Vector2D offset;
-		uint8_t bit;
-	};
-	constexpr uint8_t northBit = 8;
-	constexpr uint8_t eastBit = 4;
-	constexpr uint8_t southBit = 2;
-	constexpr uint8_t westBit = 1;
-	const std::array<NeighborDef, 4> cardinals = { { { DIR_N, northBit },
-		{ DIR_E, eastBit },
-		{ DIR_S, southBit },
-		{ DIR_W, westBit } } };
+		cache.invalidate();
+		render_tiles(ctx, startCol, startRow, endCol, endRow);
+		return;
+	}
+#endif
+
+	cache.resize(terrainVersions.size());
+	const int animFrame = renderer.get_anim_frame();
+	const int firstChunkX = startCol / TERRAIN_CHUNK_SIZE;
+	const int firstChunkY = startRow / TERRAIN_CHUNK_SIZE;
+	const int lastChunkX = (endCol - 1) / TERRAIN_CHUNK_SIZE;
+	const int lastChunkY = (endRow - 1) / TERRAIN_CHUNK_SIZE;
 
-	auto build_mask = [&](Vector2D center, auto predicate) -> uint8_t
+	for (int chunkY = 0; chunkY < terrainChunksY; ++chunkY)
 	{
-		uint8_t mask = 0;
-		for (const auto& dir : cardinals)
+		for (int chunkX = 0; chunkX < terrainChunksX; ++chunkX)
 		{
-			if (predicate(center + dir.offset))
+			const size_t index = static_cast<size_t>(chunkY) * terrainChunksX + chunkX;
+			if (chunkX < firstChunkX - 1 || chunkX > lastChunkX + 1 ||
+				chunkY < firstChunkY - 1 || chunkY > lastChunkY + 1)
 			{
-				mask |= dir.bit;
+				cache.release(index);
+				continue;
+			}
+			if (chunkX < firstChunkX || chunkX > lastChunkX || chunkY < firstChunkY || chunkY > lastChunkY)
+			{
+				continue;
 			}
-		}
-		return mask;
-	};
 
-	auto is_wall_or_door = [&](Vector2D pos) -> bool
-	{
-		if (!in_bounds(pos))
-		{
-			return false;
+			const int chunkCol = chunkX * TERRAIN_CHUNK_SIZE;
+			const int chunkRow = chunkY * TERRAIN_CHUNK_SIZE;
+			const Vector2D origin{ chunkCol * tileSize, chunkRow * tileSize };
+			const TerrainChunkKey key{
+				terrainVersions[index],
+				tileSize,
+				cache.is_animated(index) ? animFrame : TerrainChunkKey::STATIC_FRAME
+			};
+
+			const RenderTexture2D* target = cache.find(index, key);
+			if (!target)
+			{
+				const int chunkEndCol = std::min(mapWidth, chunkCol + TERRAIN_CHUNK_SIZE);
+				const int chunkEndRow = std::min(mapHeight, chunkRow + TERRAIN_CHUNK_SIZE);
+				target = &cache.prepare(
+					index,
+					key,
+					(chunkEndCol - chunkCol) * tileSize,
+					(chunkEndRow - chunkRow) * tileSize);
+				// One extra column: an open door there is drawn half a tile to
+				// the left, into this chunk; the rest of the column is culled.
+				const int animatedBefore = renderer.get_frame_stats().animatedDraws;
+				renderer.begin_world_target(*target, origin);
+				render_tiles(ctx, chunkCol, chunkRow, std::min(mapWidth, chunkEndCol + 1), chunkEndRow);
+				renderer.end_world_target();
+				cache.mark_animated(index, renderer.get_frame_stats().animatedDraws != animatedBefore, animFrame);
+			}
+			renderer.draw_world_texture(target->texture, origin);
 		}
-		TileType tileType = get_tile_type(pos);
-		return tileType == TileType::WALL || tileType == TileType::CLOSED_DOOR;
-	};
+	}
+}
+
+void Map::render_tiles(const GameContext& ctx, int startCol, int startRow, int endCol, int endRow) const
+{
+	// Neighbour masks come precomputed from autotileMasks; only the sets are looked up here.
+	const auto floorAutotile = ctx.tileConfig->get_autotile("AUTOTILE_FLOOR_STONE");
+	const auto wallAutotile = ctx.tileConfig->get_wall_autotile("WALL_AUTOTILE_STONE");
 
 	auto is_walkable = [&](Vector2D pos) -> bool
 	{
@@ -552,26 +992,6 @@ void Map::render(const GameContext& ctx) const
 		return tileType == TileType::FLOOR || tileType == TileType::CORRIDOR || tileType == TileType::OPEN_DOOR || tileType == TileType::WATER;
 	};
 
-	const std::array<Vector2D, 8> allDirs = { { DIR_NW, DIR_N, DIR_NE, DIR_W, DIR_E, DIR_SW, DIR_S, DIR_SE } };
-
-	// A border wall is a wall/door with at least one walkable tile
-	// in its 8 neighbors. Only border walls form the visible room outline.
-	auto is_border_wall = [&](Vector2D pos) -> bool
-	{
-		if (!is_wall_or_door(pos))
-		{
-			return false;
-		}
-		for (const auto& direction : allDirs)
-		{
-			if (is_walkable(pos + direction))
-			{
-				return true;
-			}
-		}
-		return false;
-	};
-
 	auto is_visible = [&](Vector2D pos) -> bool
 	{
 		return is_in_fov(pos) || is_explored(pos);
@@ -646,47 +1066,18 @@ void Map::render(const GameContext& ctx) const
 
 			case TileType::WALL:
 			{
-				if (!is_border_wall(pos))
+				const size_t index = get_index(pos);
+				if (!autotileMasks.is_border_wall(index))
 				{
 					continue; // Interior wall -- no walkable neighbor, render as void
 				}
-				// Two border walls connect only if they share a common walkable 8-neighbor.
-				// A void wall sitting between a room wall and a corridor shares no walkable
-				// neighbor with the room wall, so it cannot bleed into the room wall mask.
-				// Corner walls (only diagonally adjacent to floor) still connect because
-				// their shared floor tile IS a common 8-neighbor of both wall tiles.
-				auto connected_wall = [&](Vector2D neighbor) -> bool
-				{
-					if (!is_border_wall(neighbor))
-					{
-						return false;
-					}
-					for (const auto& direction : allDirs)
-					{
-						Vector2D shared = pos + direction;
-						if (!is_walkable(shared))
-						{
-							continue;
-						}
-						Vector2D diff = shared - neighbor;
-						if (std::abs(diff.x) <= 1 && std::abs(diff.y) <= 1)
-						{
-							return true;
-						}
-					}
-					return false;
-				};
-				tileRef = Autotile::wall_resolve_mask(
-					ctx.tileConfig->get_wall_autotile("WALL_AUTOTILE_STONE"),
-					build_mask(pos, connected_wall));
+				tileRef = Autotile::wall_resolve_mask(wallAutotile, autotileMasks.cardinal_mask(index));
 				break;
 			}
 
 			case TileType::FLOOR:
 			{
-				tileRef = Autotile::resolve_mask(
-					ctx.tileConfig->get_autotile("AUTOTILE_FLOOR_STONE"),
-					build_mask(pos, is_walkable));
+				tileRef = Autotile::resolve_mask(floorAutotile, autotileMasks.cardinal_mask(get_index(pos)));
 				break;
 			}
 
@@ -704,9 +1095,7 @@ void Map::render(const GameContext& ctx) const
 
 			case TileType::CLOSED_DOOR:
 			{
-				TileRef floorRef = Autotile::resolve_mask(
-					ctx.tileConfig->get_autotile("AUTOTILE_FLOOR_STONE"),
-					build_mask(pos, is_walkable));
+				TileRef floorRef = Autotile::resolve_mask(floorAutotile, autotileMasks.cardinal_mask(get_index(pos)));
 				ctx.renderer->draw_tile(Vector2D{ col, row }, floorRef, tint);
 
 				// Check if door is locked and render differently
@@ -723,9 +1112,7 @@ void Map::render(const GameContext& ctx) const
 
 			case TileType::OPEN_DOOR:
 			{
-				TileRef floorRef = Autotile::resolve_mask(
-					ctx.tileConfig->get_autotile("AUTOTILE_FLOOR_STONE"),
-					build_mask(pos, is_walkable));
+				TileRef floorRef = Autotile::resolve_mask(floorAutotile, autotileMasks.cardinal_mask(get_index(pos)));
 				ctx.renderer->draw_tile(Vector2D{ col, row }, floorRef, tint);
 				int offset = ctx.renderer->get_tile_size() / 2;
 				ctx.renderer->draw_tile_offset(
@@ -868,14 +1255,22 @@ void Map::set_door(Vector2D thisTile, int tileX, int tileY, bool locked)
 	fovMap->set_properties(tileX, tileY, false, false);
 
 	size_t tileIndex = get_index(thisTile);
-	if (tileIndex < tiles.size())
+	if (tileIndex < tileGrid.size())
 	{
-		tiles[tileIndex].doorState = locked
+		set_door_state(tileIndex, locked
 			? DoorState::CLOSED_LOCKED
-			: DoorState::CLOSED_UNLOCKED;
+			: DoorState::CLOSED_UNLOCKED);
 	}
 }
 
+std::vector<uint8_t>& Map::take_path_cells(bool& stale) noexcept
+{
+	const std::pair<uint64_t, uint64_t> current{ fovMap->get_walkable_version(), tileEdits };
+	stale = current != pathCellsBuiltFor || pathCells.size() != tileGrid.size();
+	pathCellsBuiltFor = current;
+	return pathCells;
+}
+
 void Map::set_tile(Vector2D pos, TileType newType, double cost)
 {
 	if (!in_bounds(pos))
@@ -883,12 +1278,20 @@ void Map::set_tile(Vector2D pos, TileType newType, double cost)
 		return;
 	}
 	const size_t idx = get_index(pos);
-	tiles.at(idx).type = newType;
-	tiles.at(idx).cost = cost;
+	tileGrid.set_type(idx, newType);
+	tileGrid.set_cost(idx, cost);
+	++tileEdits;
 
 	// Keep fovMap in sync so is_wall / can_walk / A* see the change immediately.
 	const auto [walkable, transparent] = fov_properties_for(newType);
 	fovMap->set_properties(pos.x, pos.y, walkable, transparent);
+
+	// Wall masks depend on which neighbours border a walkable tile, two steps out.
+	if (!autotileDeferred)
+	{
+		autotileMasks.patch(tileGrid, pos);
+	}
+	touch_terrain(pos, AutotileMasks::REACH);
 }
 
 void Map::create_room(const DungeonRoom& room, bool first, GameContext& ctx)
@@ -917,15 +1320,7 @@ void Map::create_room(const DungeonRoom& room, bool first, GameContext& ctx)
 					{
 						continue;
 					}
-					auto d = std::make_unique<Decoration>();
-					d->position = Vector2D{ dx, dy };
-					d->tile = t;
-					d->name = "decoration";
-					d->hp = 3;
-					d->blocks_movement = true;
-					d->lootTableKey = "";
-					d->isBroken = false;
-					ctx.decorations->push_back(std::move(d));
+					stamp_decoration(Vector2D{ dx, dy }, t, ctx);
 				}
 			}
 		}
@@ -951,13 +1346,13 @@ void Map::spawn_traps(const DungeonRoom& room, GameContext& ctx)
 	assert(ctx.objects && "Map::spawn_traps called without objects");
 
 	// ~30% of rooms get 0-2 random traps (was 10%)
-	if (ctx.dice->d10() > 3)
+	if (ctx.dice->mapgen().d10() > 3)
 	{
 		return;  // Room has no traps
 	}
 
 	// Room gets 1-2 random traps
-	int trapCount = ctx.dice->roll(1, 2);
+	int trapCount = ctx.dice->mapgen().roll(1, 2);
 
 	for (int i = 0; i < trapCount; ++i)
 	{
@@ -967,8 +1362,8 @@ void Map::spawn_traps(const DungeonRoom& room, GameContext& ctx)
 
 		for (int attempt = 0; attempt < 20; ++attempt)
 		{
-			trapPos.x = room.col + ctx.dice->roll(0, room.width - 1);
-			trapPos.y = room.row + ctx.dice->roll(0, room.height - 1);
+			trapPos.x = room.col + ctx.dice->mapgen().roll(0, room.width - 1);
+			trapPos.y = room.row + ctx.dice->mapgen().roll(0, room.height - 1);
 
 			if (!in_bounds(trapPos))
 			{
@@ -992,7 +1387,7 @@ void Map::spawn_traps(const DungeonRoom& room, GameContext& ctx)
 
 		// Create trap (randomly choose type)
 		TrapType trapType;
-		int trapChoice = ctx.dice->roll(1, 3);
+		int trapChoice = ctx.dice->mapgen().roll(1, 3);
 		switch (trapChoice)
 		{
 		case 1:
@@ -1182,17 +1577,17 @@ bool Map::would_water_block_entrance(Vector2D waterPos, GameContext& ctx) const
 
 void Map::spawn_items(const DungeonRoom& room, GameContext& ctx)
 {
-	const int numItems = ctx.dice ? ctx.dice->roll(0, MAX_ROOM_ITEMS) : 0;
+	const int numItems = ctx.dice ? ctx.dice->mapgen().roll(0, MAX_ROOM_ITEMS) : 0;
 	for (int i = 0; i < numItems; i++)
 	{
-		Vector2D itemPos{ ctx.dice->roll(room.col, room.col_end()), ctx.dice->roll(room.row, room.row_end()) };
+		Vector2D itemPos{ ctx.dice->mapgen().roll(room.col, room.col_end()), ctx.dice->mapgen().roll(room.row, room.row_end()) };
 		constexpr int MAX_ITEM_TRIES = 20;
 		int itemTries = 0;
 		while (itemTries < MAX_ITEM_TRIES &&
 			(!can_walk(itemPos, ctx) || is_stairs(itemPos, ctx) || find_decoration_at(itemPos, ctx) != nullptr))
 		{
-			itemPos.x = ctx.dice->roll(room.col, room.col_end());
-			itemPos.y = ctx.dice->roll(room.row, room.row_end());
+			itemPos.x = ctx.dice->mapgen().roll(room.col, room.col_end());
+			itemPos.y = ctx.dice->mapgen().roll(room.row, room.row_end());
 			++itemTries;
 		}
 		if (itemTries >= MAX_ITEM_TRIES)
@@ -1237,7 +1632,7 @@ void Map::spawn_barrels(const DungeonRoom& room, GameContext& ctx)
 		barrel->hp = 2;
 		barrel->blocks_movement = true;
 		barrel->lootTableKey = "gold";
-		ctx.decorations->push_back(std::move(barrel));
+		add_decoration(std::move(barrel), ctx);
 	}
 }
 
@@ -1246,14 +1641,14 @@ void Map::spawn_player(const DungeonRoom& room, GameContext& ctx)
 	assert(ctx.player && "Map::spawn_player called without player");
 	assert(ctx.dice && "Map::spawn_player called without dice");
 
-	Vector2D pos{ ctx.dice->roll(room.col, room.col_end()), ctx.dice->roll(room.row, room.row_end()) };
+	Vector2D pos{ ctx.dice->mapgen().roll(room.col, room.col_end()), ctx.dice->mapgen().roll(room.row, room.row_end()) };
 	constexpr int MAX_PLAYER_TRIES = 50;
 	int playerTries = 0;
 	while (playerTries < MAX_PLAYER_TRIES &&
 		(!can_walk(pos, ctx) || find_decoration_at(pos, ctx) != nullptr))
 	{
-		pos.x = ctx.dice->roll(room.col, room.col_end());
-		pos.y = ctx.dice->roll(room.row, room.row_end());
+		pos.x = ctx.dice->mapgen().roll(room.col, room.col_end());
+		pos.y = ctx.dice->mapgen().roll(room.row, room.row_end());
 		++playerTries;
 	}
 	ctx.player->position = pos;
@@ -1292,7 +1687,7 @@ void Map::place_stairs(GameContext& ctx)
 		std::ranges::max_element(depth) - depth.begin());
 
 	const DungeonRoom& room = rooms[deepestIndex];
-	Vector2D stairsPos{ ctx.dice->roll(room.col, room.col_end()), ctx.dice->roll(room.row, room.row_end()) };
+	Vector2D stairsPos{ ctx.dice->mapgen().roll(room.col, room.col_end()), ctx.dice->mapgen().roll(room.row, room.row_end()) };
 	constexpr int MAX_STAIR_TRIES = 200;
 	for (int attempt = 0; attempt < MAX_STAIR_TRIES; ++attempt)
 	{
@@ -1300,8 +1695,8 @@ void Map::place_stairs(GameContext& ctx)
 		{
 			break;
 		}
-		stairsPos.x = ctx.dice->roll(room.col, room.col_end());
-		stairsPos.y = ctx.dice->roll(room.row, room.row_end());
+		stairsPos.x = ctx.dice->mapgen().roll(room.col, room.col_end());
+		stairsPos.y = ctx.dice->mapgen().roll(room.row, room.row_end());
 	}
 	ctx.stairs->position = stairsPos;
 }
@@ -1347,7 +1742,7 @@ void Map::add_monster(Vector2D pos, GameContext& ctx) const
 		Creature* monster = get_actor(pos, ctx);
 		if (monster && ctx.messageSystem)
 		{
-			ctx.messageSystem->log("Spawned " + monster->actorData.name + " at level " + std::to_string(ctx.levelManager->get_dungeon_level()));
+			ctx.messageSystem->debug("Spawned {} at level {}", monster->actorData.name, ctx.levelManager->get_dungeon_level());
 		}
 	}
 }
@@ -1361,6 +1756,12 @@ Creature* Map::get_actor(Vector2D pos, const GameContext& ctx) const noexcept
 		return ctx.player;
 	}
 
+	// Occupancy index answers in O(1); dead creatures never block.
+	if (ctx.creatureManager)
+	{
+		return ctx.creatureManager->get_actor_at_position(*ctx.creatures, pos);
+	}
+
 	// Check all creatures (excluding dead ones - they shouldn't block)
 	for (const auto& actor : *ctx.creatures)
 	{
@@ -1381,8 +1782,11 @@ Creature* Map::get_actor(Vector2D pos, const GameContext& ctx) const noexcept
 std::vector<std::vector<Tile>> Map::get_map() const noexcept
 {
 	std::vector<std::vector<Tile>> map;
-	for (const auto& tile : tiles)
+	for (size_t index = 0; index < tileGrid.size(); ++index)
 	{
+		Tile tile(tileGrid.position_of(index), tileGrid.type(index), tileGrid.cost(index));
+		tile.explored = tileGrid.explored().test(index);
+		tile.doorState = tileGrid.door_state(index);
 		map.push_back({ tile });
 	}
 	return map;
@@ -1391,10 +1795,9 @@ std::vector<std::vector<Tile>> Map::get_map() const noexcept
 // reveal map
 void Map::reveal()
 {
-	for (auto& tile : tiles)
-	{
-		tile.explored = true;
-	}
+	tileGrid.explored().set_all();
+	touch_view();
+	reset_terrain_versions();
 }
 
 // regenerate map
@@ -1422,6 +1825,7 @@ void Map::regenerate(GameContext& ctx)
 	{
 		ctx.decorations->clear();
 	}
+	decorationSlots.clear();
 
 	// generate a new map at current window dimensions (keep old size if curses not active)
 	const int newH = get_map_height();
@@ -1499,62 +1903,49 @@ double Map::get_cost(Vector2D pos) const noexcept
 		return 1000.0; // High cost for out of bounds
 	}
 	size_t index = get_index(pos);
-	if (index >= tiles.size())
+	if (index >= tileGrid.size())
 	{
 		// Logging moved to callers with GameContext access
 		return 1000.0;
 	}
-	return tiles.at(index).cost;
+	return tileGrid.cost(index);
 }
 
 std::vector<Vector2D> Map::bresenham_line(Vector2D from, Vector2D to)
 {
 	std::vector<Vector2D> path;
-
-	int x0 = from.x;
-	int y0 = from.y;
-	const int x1 = to.x;
-	const int y1 = to.y;
-
-	const int dx = std::abs(x1 - x0);
-	const int dy = std::abs(y1 - y0);
-	const int sx = (x0 < x1) ? 1 : -1;
-	const int sy = (y0 < y1) ? 1 : -1;
-	int err = dx - dy;
-
-	while (x0 != x1 || y0 != y1)
+	for (Vector2D pos : BresenhamLine{ from, to })
 	{
-		int e2 = 2 * err;
-		if (e2 > -dy)
-		{
-			err -= dy;
-			x0 += sx;
-		}
-		if (e2 < dx)
-		{
-			err += dx;
-			y0 += sy;
-		}
-		path.push_back(Vector2D{ x0, y0 });
+		path.push_back(pos);
 	}
-
 	return path;
 }
 
 bool Map::has_los(Vector2D from, Vector2D to) const noexcept
 {
-	for (const auto& pos : bresenham_line(from, to))
+	const uint64_t version = fovMap->get_version();
+	if (const auto cached = losCache.find(from, to, version))
+	{
+		return *cached;
+	}
+
+	// Walk the transparency plane directly; endpoints never block.
+	bool visible = true;
+	for (Vector2D pos : BresenhamLine{ from, to })
 	{
-		// Skip endpoints
-		if ((pos.x != from.x || pos.y != from.y) && (pos.x != to.x || pos.y != to.y))
+		if (pos == to)
 		{
-			if (is_wall(pos))
-			{
-				return false;
-			}
+			break;
+		}
+		if (!fovMap->is_transparent(pos.x, pos.y))
+		{
+			visible = false;
+			break;
 		}
 	}
-	return true;
+
+	losCache.store(from, to, version, visible);
+	return visible;
 }
 
 bool Map::is_door(Vector2D pos) const noexcept
@@ -1596,9 +1987,9 @@ bool Map::open_door(Vector2D pos, GameContext& ctx)
 
 	// Clear door state when opening
 	size_t tileIndex = get_index(pos);
-	if (tileIndex < tiles.size())
+	if (tileIndex < tileGrid.size())
 	{
-		tiles[tileIndex].doorState = DoorState::OPEN;
+		set_door_state(tileIndex, DoorState::OPEN);
 	}
 
 	fovMap->set_properties(pos.x, pos.y, true, true);
@@ -1649,9 +2040,9 @@ bool Map::close_door(Vector2D pos, GameContext& ctx)
 
 	// New doors are unlocked by default
 	size_t tileIndex = get_index(pos);
-	if (tileIndex < tiles.size())
+	if (tileIndex < tileGrid.size())
 	{
-		tiles[tileIndex].doorState = DoorState::CLOSED_UNLOCKED;
+		set_door_state(tileIndex, DoorState::CLOSED_UNLOCKED);
 	}
 
 	// Make the tile non-walkable and non-transparent
@@ -1673,17 +2064,17 @@ bool Map::unlock_door(Vector2D pos, GameContext& ctx)
 	}
 
 	size_t tileIndex = get_index(pos);
-	if (tileIndex >= tiles.size())
+	if (tileIndex >= tileGrid.size())
 	{
 		return false;
 	}
 
-	if (tiles[tileIndex].doorState != DoorState::CLOSED_LOCKED)
+	if (tileGrid.door_state(tileIndex) != DoorState::CLOSED_LOCKED)
 	{
 		return false; // Door is not locked
 	}
 
-	tiles[tileIndex].doorState = DoorState::CLOSED_UNLOCKED;
+	set_door_state(tileIndex, DoorState::CLOSED_UNLOCKED);
 	return true;
 }
 
@@ -1765,12 +2156,12 @@ bool Map::is_door_locked(Vector2D pos) const noexcept
 	}
 
 	size_t tileIndex = get_index(pos);
-	if (tileIndex >= tiles.size())
+	if (tileIndex >= tileGrid.size())
 	{
 		return false;
 	}
 
-	return tiles[tileIndex].doorState == DoorState::CLOSED_LOCKED;
+	return tileGrid.door_state(tileIndex) == DoorState::CLOSED_LOCKED;
 }
 
 void Map::place_amulet(GameContext& ctx)
@@ -1784,15 +2175,15 @@ void Map::place_amulet(GameContext& ctx)
 	if (ctx.levelManager->get_dungeon_level() == FINAL_DUNGEON_LEVEL)
 	{
 		// Choose a random room for the amulet
-		const int index = ctx.dice->roll(0, static_cast<int>(ctx.rooms->size()) - 1);
+		const int index = ctx.dice->mapgen().roll(0, static_cast<int>(ctx.rooms->size()) - 1);
 		const DungeonRoom& room = ctx.rooms->at(index);
 
 		// Find a walkable position in the room
-		Vector2D amuletPos{ ctx.dice->roll(room.col, room.col_end()), ctx.dice->roll(room.row, room.row_end()) };
+		Vector2D amuletPos{ ctx.dice->mapgen().roll(room.col, room.col_end()), ctx.dice->mapgen().roll(room.row, room.row_end()) };
 		while (!can_walk(amuletPos, ctx) || is_stairs(amuletPos, ctx))
 		{
-			amuletPos.x = ctx.dice->roll(room.col, room.col_end());
-			amuletPos.y = ctx.dice->roll(room.row, room.row_end());
+			amuletPos.x = ctx.dice->mapgen().roll(room.col, room.col_end());
+			amuletPos.y = ctx.dice->mapgen().roll(room.row, room.row_end());
 		}
 
 		// Create and place the amulet
@@ -1801,7 +2192,7 @@ void Map::place_amulet(GameContext& ctx)
 		// Log the placement (debug info)
 		if (ctx.messageSystem)
 		{
-			ctx.messageSystem->log("Placed Amulet of Yendor at " + std::to_string(amuletPos.x) + "," + std::to_string(amuletPos.y));
+			ctx.messageSystem->debug("Placed Amulet of Yendor at {},{}", amuletPos.x, amuletPos.y);
 
 			// Add a hint message
 			ctx.messageSystem->message(RED_YELLOW_PAIR, "You sense a powerful artifact somewhere on this level...", true);
@@ -1848,8 +2239,8 @@ void Map::create_treasure_room(const DungeonRoom& room, int quality, GameContext
 		for (int t = 0; t < MAX_WARDEN_TRIES && wardenPos.x < 0; ++t)
 		{
 			Vector2D candidate{
-				ctx.dice->roll(room.col, room.col_end()),
-				ctx.dice->roll(room.row, room.row_end())
+				ctx.dice->mapgen().roll(room.col, room.col_end()),
+				ctx.dice->mapgen().roll(room.row, room.row_end())
 			};
 			if (can_walk(candidate, ctx) && get_actor(candidate, ctx) == nullptr)
 			{
@@ -1872,19 +2263,19 @@ void Map::create_treasure_room(const DungeonRoom& room, int quality, GameContext
 
 	case 1:
 	{
-		guardianCount = ctx.dice->roll(0, 1);
+		guardianCount = ctx.dice->mapgen().roll(0, 1);
 		break;
 	}
 
 	case 2:
 	{
-		guardianCount = ctx.dice->roll(1, 2);
+		guardianCount = ctx.dice->mapgen().roll(1, 2);
 		break;
 	}
 
 	case 3:
 	{
-		guardianCount = ctx.dice->roll(2, 3);
+		guardianCount = ctx.dice->mapgen().roll(2, 3);
 		break;
 	}
 
@@ -1897,8 +2288,8 @@ void Map::create_treasure_room(const DungeonRoom& room, int quality, GameContext
 		for (int t = 0; t < MAX_GUARD_TRIES; ++t)
 		{
 			Vector2D candidate{
-				ctx.dice->roll(room.col, room.col_end()),
-				ctx.dice->roll(room.row, room.row_end())
+				ctx.dice->mapgen().roll(room.col, room.col_end()),
+				ctx.dice->mapgen().roll(room.row, room.row_end())
 			};
 			if (candidate != center &&
 				can_walk(candidate, ctx) &&
@@ -1921,13 +2312,13 @@ void Map::create_treasure_room(const DungeonRoom& room, int quality, GameContext
 
 	if (ctx.messageSystem)
 	{
-		ctx.messageSystem->log(std::format(
+		ctx.messageSystem->debug(
 			"Created treasure room at ({},{}) size {}x{} quality {}",
 			room.col,
 			room.row,
 			room.width,
 			room.height,
-			quality));
+			quality);
 	}
 }
 
@@ -2009,7 +2400,7 @@ void Map::setup_treasure_room_guard(const DungeonRoom& room, GameContext& ctx)
 			{
 				continue;
 			}
-			tiles[get_index(doorPos)].doorState = DoorState::CLOSED_LOCKED;
+			set_door_state(get_index(doorPos), DoorState::CLOSED_LOCKED);
 		}
 	}
 
@@ -2100,7 +2491,7 @@ void Map::setup_treasure_room_guard(const DungeonRoom& room, GameContext& ctx)
 				}
 				if (is_door_locked(pos))
 				{
-					tiles[get_index(pos)].doorState = DoorState::CLOSED_UNLOCKED;
+					set_door_state(get_index(pos), DoorState::CLOSED_UNLOCKED);
 				}
 			}
 		}
@@ -2172,7 +2563,7 @@ bool Map::maybe_create_treasure_room(int dungeonLevel, GameContext& ctx)
 	assert(ctx.rooms && "Map::maybe_create_treasure_room called without rooms");
 
 	const int treasureRoomChance = std::min(30 + (dungeonLevel * 5), 60);
-	if (ctx.dice->d100() > treasureRoomChance)
+	if (ctx.dice->mapgen().d100() > treasureRoomChance)
 	{
 		return false;
 	}
@@ -2207,12 +2598,12 @@ bool Map::maybe_create_treasure_room(int dungeonLevel, GameContext& ctx)
 		return false;
 	}
 
-	const int pick = ctx.dice->roll(0, static_cast<int>(singleEntranceIndices.size()) - 1);
+	const int pick = ctx.dice->mapgen().roll(0, static_cast<int>(singleEntranceIndices.size()) - 1);
 	const DungeonRoom& room = ctx.rooms->at(singleEntranceIndices[pick]);
 
 	// Determine the quality of the treasure room based on dungeon level and luck
 	int quality = 1;
-	const int qualityRoll = ctx.dice->d100();
+	const int qualityRoll = ctx.dice->mapgen().d100();
 	if (qualityRoll <= 5 + dungeonLevel)
 	{
 		quality = 3;
@@ -2389,7 +2780,7 @@ void Map::place_from_graph(
 {
 	if (ctx.messageSystem)
 	{
-		ctx.messageSystem->log("place_from_graph: Starting with " + std::to_string(rooms.size()) + " rooms");
+		ctx.messageSystem->debug("place_from_graph: Starting with {} rooms", rooms.size());
 	}
 
 	// Step 1: Create all rooms (dig them, spawn water/items/player)
@@ -2472,7 +2863,7 @@ void Map::place_from_graph(
 
 	if (ctx.messageSystem)
 	{
-		ctx.messageSystem->log("place_from_graph: Finished. Dug " + std::to_string(dug_edges.size()) + " edges");
+		ctx.messageSystem->debug("place_from_graph: Finished. Dug {} edges", dug_edges.size());
 	}
 }
 
@@ -2480,79 +2871,56 @@ int Map::get_dijkstra_cost(Vector2D pos) const noexcept
 {
 	if (!in_bounds(pos))
 	{
-		return std::numeric_limits<int>::max();
+		return FlowField::UNREACHABLE;
 	}
 
-	return dijkstraCosts[static_cast<size_t>(pos.y) * mapWidth + pos.x];
+	return playerFlow.cost(static_cast<size_t>(pos.y) * mapWidth + pos.x);
 }
 
-void Map::rebuild_dijkstra_map(const std::vector<Vector2D>& goals, const GameContext& ctx)
+bool Map::is_flow_passable(size_t index) const noexcept
 {
-	std::fill(dijkstraCosts.begin(), dijkstraCosts.end(), std::numeric_limits<int>::max());
-
-	struct FrontierEntry
-	{
-		int cost{ 0 };
-		Vector2D position;
-		bool operator>(const FrontierEntry& rhs) const noexcept { return cost > rhs.cost; }
-	};
-	std::priority_queue<FrontierEntry, std::vector<FrontierEntry>, std::greater<FrontierEntry>> frontier;
+	return fovMap->walkable_plane().test(index) && (index >= decorationSlots.size() || !decorationSlots[index]);
+}
 
-	for (const Vector2D& goal : goals)
+// Feeds walkability flips logged by FovMap (doors, digging, set_tile) into
+// the flow field; after a bulk rewrite the log has overflowed and the whole
+// plane is copied instead.
+void Map::sync_flow_passability()
+{
+	if (!fovMap->take_walkable_changes(walkableChanges))
 	{
-		if (!in_bounds(goal))
-		{
-			continue;
-		}
-		const size_t goalIndex = static_cast<size_t>(goal.y) * mapWidth + goal.x;
-		dijkstraCosts[goalIndex] = 0;
-		frontier.push(FrontierEntry{ 0, goal });
+		resync_flow_passability();
+		return;
 	}
-
-	if (frontier.empty())
+	for (int index : walkableChanges)
 	{
-		return;
+		playerFlow.set_passable(static_cast<size_t>(index), is_flow_passable(static_cast<size_t>(index)));
 	}
+}
 
-	static const std::vector<Vector2D> cardinalAndDiagonal = {
-		DIR_N, DIR_S, DIR_W, DIR_E, DIR_NW, DIR_NE, DIR_SW, DIR_SE
-	};
-
-	while (!frontier.empty())
+void Map::resync_flow_passability()
+{
+	BitPlane passable = fovMap->walkable_plane();
+	for (size_t index = 0; index < decorationSlots.size(); ++index)
 	{
-		const FrontierEntry top = frontier.top();
-		frontier.pop();
-
-		const size_t currentIndex = static_cast<size_t>(top.position.y) * mapWidth + top.position.x;
-		if (top.cost > dijkstraCosts[currentIndex])
-		{
-			continue;
-		}
-
-		for (const Vector2D& delta : cardinalAndDiagonal)
+		if (decorationSlots[index])
 		{
-			Vector2D next{ top.position.x + delta.x, top.position.y + delta.y };
-			if (!in_bounds(next))
-			{
-				continue;
-			}
-			if (!fovMap->is_walkable(next.x, next.y))
-			{
-				continue;
-			}
-			if (find_decoration_at(next, ctx) != nullptr)
-			{
-				continue;
-			}
-			const size_t nextIndex = static_cast<size_t>(next.y) * mapWidth + next.x;
-			const int newCost = top.cost + 1;
-			if (newCost < dijkstraCosts[nextIndex])
-			{
-				dijkstraCosts[nextIndex] = newCost;
-				frontier.push(FrontierEntry{ newCost, next });
-			}
+			passable.reset(index);
 		}
 	}
+	playerFlow.assign_passable(passable);
+}
+
+void Map::update_dijkstra_map(std::span<const Vector2D> goals)
+{
+	sync_flow_passability();
+	playerFlow.update(goals);
+}
+
+void Map::rebuild_dijkstra_map(std::span<const Vector2D> goals)
+{
+	sync_flow_passability();
+	playerFlow.rebuild(goals);
 }
 
 // end of file: Map.cpp
@@ -1,24 +1,39 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "../Factories/ItemFactory.h"
 #include "../Factories/MonsterFactory.h"
 #include "../Persistent/Persistent.h"
 #include "../Random/RandomDice.h"
+#include "AutotileMasks.h"
+#include "CreatureFovCache.h"
 #include "Decoration.h"
 #include "DungeonRoom.h"
+#include "FlowField.h"
 #include "FovMap.h"
+#include "LosCache.h"
+#include "TileGrid.h"
 
 // Forward declaration
 struct GameContext;
 class Creature;
+class BinaryReader;
+class BinaryWriter;
 
 inline constexpr int DEFAULT_MAP_WIDTH = 120;
 inline constexpr int DEFAULT_MAP_HEIGHT = 80;
 
+// Generation never builds a map past these; a saved size beyond them is a
+// corrupt save, rejected before any plane is allocated.
+inline constexpr int MAX_MAP_WIDTH = DEFAULT_MAP_WIDTH;
+inline constexpr int MAX_MAP_HEIGHT = DEFAULT_MAP_HEIGHT;
+
 inline int get_map_width()
 {
 	return DEFAULT_MAP_WIDTH;
@@ -29,6 +44,7 @@ inline int get_map_height()
 }
 
 inline constexpr int FOV_RADIUS = 4;
+inline constexpr int TERRAIN_CHUNK_SIZE = 16; // tiles per side of a cached terrain chunk
 
 inline constexpr int ROOM_HORIZONTAL_MAX_SIZE = 14;
 inline constexpr int ROOM_VERTICAL_MAX_SIZE = 9;
@@ -38,27 +54,8 @@ inline constexpr int MAX_MONSTERS = 6;
 inline constexpr int FINAL_DUNGEON_LEVEL = 10;
 
 //==Tile==
-// A tile of the map
-// checks if the player has seen this tile
-// it is used for field of view algorithm (a 2D array) (see Map.h) (see Map.cpp) (see Map::computeFov())
-
-enum class TileType
-{
-	FLOOR,
-	WALL,
-	WATER,
-	CLOSED_DOOR,
-	OPEN_DOOR,
-	CORRIDOR,
-	// Add more as needed...
-};
-
-enum class DoorState
-{
-	OPEN,
-	CLOSED_UNLOCKED,
-	CLOSED_LOCKED
-};
+// A tile of the map, as a value snapshot. The map itself stores tiles in a
+// TileGrid (see TileGrid.h); Tile is only built on demand by Map::get_map().
 
 struct Tile
 {
@@ -85,7 +82,18 @@ private:
 	std::vector<Vector2D> DIRS = { DIR_N, DIR_NE, DIR_E, DIR_SE, DIR_S, DIR_SW, DIR_W, DIR_NW };
 	std::unique_ptr<MonsterFactory> monsterFactory;
 	std::unique_ptr<ItemFactory> itemFactory;
-	std::vector<int> dijkstraCosts;
+	std::vector<Decoration*> decorationSlots; // one intact decoration per tile, or nullptr
+	FlowField playerFlow; // step distance to the player over walkable, decoration-free tiles
+	std::vector<int> walkableChanges; // scratch for FovMap::take_walkable_changes
+	AutotileMasks autotileMasks; // wall/floor neighbour masks, patched by set_tile
+	std::vector<uint8_t> pathCells; // Dijkstra's jump snapshot, see take_path_cells
+	uint64_t tileEdits{ 0 }; // bumped by every tile type or cost change
+	std::pair<uint64_t, uint64_t> pathCellsBuiltFor{}; // walkable version, tileEdits
+	bool autotileDeferred{ false }; // set while init() generates; one rebuild follows
+
+	bool is_flow_passable(size_t index) const noexcept;
+	void sync_flow_passability();
+	void resync_flow_passability();
 
 	Vector2D get_map_size() const noexcept
 	{
@@ -109,18 +117,33 @@ private:
 	void set_explored(Vector2D pos); // set the tile as explored
 	void post_process_doors();
 
+	// Draws the visible terrain in columns [startCol, endCol) and rows
+	// [startRow, endRow) through the renderer's world-space tile calls.
+	void render_tiles(const GameContext& ctx, int startCol, int startRow, int endCol, int endRow) const;
+
 public:
 	Map(int mapWidth, int mapHeight);
 
 	void load(const json& j) override;
 	void save(json& j) override;
 
+	// The map is persisted as run-length coded planes (see RunLength.h):
+	// tile types, door states and the explored bits. Costs and FOV cells are
+	// rebuilt from the types. JSON holds the planes as base64 strings; the
+	// binary MAP section holds them raw. Loading still accepts the older
+	// per-tile JSON and binary format 1 (pass SaveReader::get_version()).
+	// Both throw std::runtime_error on malformed input.
+	void save(BinaryWriter& out) const;
+	void load(BinaryReader& in, uint32_t formatVersion);
+
 	// Initialize the tile grid to all-walls. No dungeon generation.
 	// Useful as a test seam when unit tests need a blank map.
 	void init_tiles();
 
 	// Full dungeon initialization: tile grid + room generation + actor placement.
+	// The seed drives the layout; without one it is rolled from ctx.dice.
 	void init(GameContext& ctx);
+	void init(GameContext& ctx, long levelSeed);
 	bool is_in_fov(Vector2D pos) const noexcept;
 	TileType get_tile_type(Vector2D pos) const noexcept;
 	void tile_action(Creature& owner, TileType tileType, GameContext& ctx);
@@ -129,6 +152,14 @@ public:
 	bool can_walk(Vector2D pos, const GameContext& ctx) const noexcept;
 	void add_monster(Vector2D pos, GameContext& ctx) const;
 	void compute_fov(GameContext& ctx);
+	// Monster perception: each creature's own FOV (radius FOV_RADIUS),
+	// batch-refreshed once per turn and cached until it or the map changes.
+	void refresh_creature_fov(std::span<const std::unique_ptr<Creature>> creatures);
+	bool creature_can_see(const Creature& viewer, Vector2D target);
+
+	// Engine used by compute_fov; kept across init/load/regenerate.
+	void set_fov_algorithm(FovAlgorithm algorithm) noexcept;
+	FovAlgorithm get_fov_algorithm() const noexcept { return fovAlgorithm; }
 	void update();
 	void render(const GameContext& ctx) const;
 	void add_item(Vector2D pos, GameContext& ctx);
@@ -143,6 +174,8 @@ public:
 	int get_height() const noexcept { return mapHeight; }
 	long get_seed() const noexcept { return seed; }
 	bool is_in_bounds(Vector2D pos) const noexcept { return pos.x >= 0 && pos.x < mapWidth && pos.y >= 0 && pos.y < mapHeight; }
+	// Materialised line for callers that keep the path (animations); prefer
+	// iterating BresenhamLine directly when the cells are only visited.
 	static std::vector<Vector2D> bresenham_line(Vector2D from, Vector2D to);
 	size_t get_index(Vector2D pos) const
 	{
@@ -168,11 +201,29 @@ public:
 	void create_treasure_room(const DungeonRoom& room, int quality, GameContext& ctx);
 	bool maybe_create_treasure_room(int dungeonLevel, GameContext& ctx);
 	Decoration* find_decoration_at(Vector2D pos, const GameContext& ctx) const noexcept;
+
+	// Decorations are owned by ctx.decorations but indexed per tile here so
+	// find_decoration_at is O(1). Add and break them through these calls to
+	// keep the index in sync; prune_decorations replaces erasing directly.
+	void add_decoration(std::unique_ptr<Decoration> decor, GameContext& ctx);
+	void stamp_decoration(Vector2D pos, TileRef tile, GameContext& ctx);
+	void break_decoration(Decoration& decor, GameContext& ctx);
+	void prune_decorations(GameContext& ctx);
+	void rebuild_decoration_index(const GameContext& ctx);
 	bool is_door(Vector2D pos) const noexcept;
 	bool is_open_door(Vector2D pos) const noexcept;
 	bool is_wall(Vector2D pos) const noexcept;
+	// Player flow field (compute_fov keeps it on the player). update repairs
+	// only what changed since the last call -- a step, a door, a decoration --
+	// and does nothing when nothing did; rebuild recomputes the whole map.
 	int get_dijkstra_cost(Vector2D pos) const noexcept;
-	void rebuild_dijkstra_map(const std::vector<Vector2D>& goals, const GameContext& ctx);
+	void update_dijkstra_map(std::span<const Vector2D> goals);
+	void rebuild_dijkstra_map(std::span<const Vector2D> goals);
+	const FlowField& get_flow_field() const noexcept { return playerFlow; }
+	// Cells written since the last reset; the game loop publishes and resets
+	// it once per turn.
+	size_t get_dijkstra_touched_count() const noexcept { return playerFlow.get_touched_count(); }
+	void reset_dijkstra_touched_count() noexcept { playerFlow.reset_touched_count(); }
 	void set_tile(Vector2D pos, TileType newType, double cost);
 	void place_from_graph(
 		const std::vector<DungeonRoom>& rooms,
@@ -182,12 +233,54 @@ public:
 	// cardinal neighbour. Used to select single-entrance treasure rooms.
 	int count_room_entrances(const DungeonRoom& room) const;
 
-	std::vector<Tile> tiles;
+	// Read-only views of the tile planes for whole-map scans (minimap, lighting).
+	const TileGrid& get_tile_grid() const noexcept { return tileGrid; }
+	const BitPlane& get_fov_plane() const noexcept { return fovMap->visible_plane(); }
+	const BitPlane& get_walkable_plane() const noexcept { return fovMap->walkable_plane(); }
+	const AutotileMasks& get_autotile_masks() const noexcept { return autotileMasks; }
+
+	// Storage for Dijkstra's Jump Point Search snapshot of walls, closed
+	// doors and tile costs, kept with the map so it outlives one search.
+	// stale is set when any of those changed since the previous call, and
+	// the caller must then rebuild the cells.
+	std::vector<uint8_t>& take_path_cells(bool& stale) noexcept;
+
+	// Changes whenever the visible or explored plane may have changed (FOV
+	// recomputed, tiles newly explored, reveal, load). Unique across maps, so
+	// a cached view of the planes can be validated by this number alone.
+	uint64_t get_view_version() const noexcept { return viewVersion; }
+
+	// Terrain chunks are TERRAIN_CHUNK_SIZE tiles square. A chunk's version
+	// changes whenever anything render() draws for it may have changed: a
+	// tile or door state within two tiles (autotile masks read that far),
+	// exploration, or a tile entering or leaving the FOV. Unique across maps.
+	int get_terrain_chunks_x() const noexcept { return terrainChunksX; }
+	int get_terrain_chunks_y() const noexcept { return terrainChunksY; }
+	uint64_t get_terrain_version(int chunkX, int chunkY) const noexcept
+	{
+		return terrainVersions[static_cast<size_t>(chunkY) * terrainChunksX + chunkX];
+	}
 
 protected:
+	TileGrid tileGrid;
 	std::unique_ptr<FovMap> fovMap;
+	FovAlgorithm fovAlgorithm{ FovAlgorithm::ITERATIVE };
+	CreatureFovCache creatureFov{ FOV_RADIUS };
+	mutable LosCache losCache;
 	RandomDice mapRng;
 	long seed;
+	uint64_t viewVersion{ 0 };
+	int terrainChunksX{ 0 };
+	int terrainChunksY{ 0 };
+	std::vector<uint64_t> terrainVersions; // one per terrain chunk, row-major
+	void touch_view() noexcept;
+	void reset_terrain_versions();
+	void touch_terrain(Vector2D pos, int radius);
+	void set_door_state(size_t index, DoorState state);
+	void begin_load(int width, int height, long newSeed); // fresh planes for a loaded map
+	void load_tile(size_t index, TileType type, double cost, DoorState door);
+	void load_planes(std::span<const uint8_t> typeRuns, std::span<const uint8_t> doorRuns, std::span<const uint8_t> exploredRuns);
+	void load_legacy_tiles(const json& tiles); // per-tile objects, pre-plane saves
 	friend class DungeonGenerator;
 	void dig(Vector2D begin, Vector2D end);
 	void dig_corridor(Vector2D begin, Vector2D end);
@@ -1,4 +1,8 @@
 // file: Map/Minimap.cpp
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include <raylib.h>
 
 #include "../Actor/Stairs.h"
@@ -8,6 +12,28 @@
 #include "Map.h"
 #include "Minimap.h"
 
+namespace
+{
+    // Which tile of a reduced block gets its colour: the most telling one.
+    int tile_rank(TileType type) noexcept
+    {
+        switch (type)
+        {
+        case TileType::CLOSED_DOOR:
+            return 5;
+        case TileType::WATER:
+            return 4;
+        case TileType::FLOOR:
+        case TileType::OPEN_DOOR:
+            return 3;
+        case TileType::CORRIDOR:
+            return 2;
+        default:
+            return 1;
+        }
+    }
+}
+
 void Minimap::toggle() noexcept
 {
     visible = !visible;
@@ -18,66 +44,162 @@ bool Minimap::is_visible() const noexcept
     return visible;
 }
 
-void Minimap::render(const GameContext& ctx) const
+void Minimap::toggle_reduced() noexcept
 {
-    if (!visible || !ctx.map || !ctx.renderer || !ctx.player)
+    reduced = !reduced;
+}
+
+Color Minimap::tile_color(TileType type, bool explored, bool inFov) noexcept
+{
+    if (!explored)
     {
-        return;
+        return Color{ 0, 0, 0, 0 };
     }
 
-    const Map& map = *ctx.map;
-    const Renderer& renderer = *ctx.renderer;
-
-    int mapW = map.get_width();
-    int mapH = map.get_height();
-    int screenW = renderer.get_screen_width();
+    switch (type)
+    {
+    case TileType::FLOOR:
+    case TileType::OPEN_DOOR:
+        return inFov ? Color{ 180, 180, 160, 230 } : Color{ 100, 100, 90, 200 };
+    case TileType::CORRIDOR:
+        return inFov ? Color{ 150, 150, 130, 230 } : Color{ 80, 80, 70, 200 };
+    case TileType::WALL:
+        return inFov ? Color{ 90, 90, 80, 210 } : Color{ 50, 50, 45, 180 };
+    case TileType::WATER:
+        return inFov ? Color{ 80, 160, 230, 230 } : Color{ 30, 100, 180, 200 };
+    case TileType::CLOSED_DOOR:
+        return inFov ? Color{ 210, 140, 70, 230 } : Color{ 150, 95, 45, 200 };
+    default:
+        return inFov ? Color{ 100, 100, 90, 200 } : Color{ 55, 55, 50, 180 };
+    }
+}
 
-    int panelW = mapW * TILE_PX;
-    int panelH = mapH * TILE_PX;
-    int originX = screenW - panelW - PADDING;
-    int originY = PADDING;
+// Recreates the texture when the map size or the mode changed (every chunk
+// is then repainted), repaints stale chunks and uploads once if any were.
+void Minimap::sync_texture(const Map& map) const
+{
+    const int wantScale = reduced ? REDUCED_SCALE : 1;
+    const int texWidth = (map.get_width() + wantScale - 1) / wantScale;
+    const int texHeight = (map.get_height() + wantScale - 1) / wantScale;
+    const size_t chunkCount = static_cast<size_t>(map.get_terrain_chunks_x()) * map.get_terrain_chunks_y();
 
-    DrawRectangle(originX - 2, originY - 2, panelW + 4, panelH + 4, Color{ 0, 0, 0, 200 });
+    if (!textureLoaded || scale != wantScale || texture.width != texWidth || texture.height != texHeight)
+    {
+        if (textureLoaded)
+        {
+            UnloadTexture(texture);
+        }
+        scale = wantScale;
+        texels.assign(static_cast<size_t>(texWidth) * texHeight, Color{ 0, 0, 0, 0 });
+        Image image{ texels.data(), texWidth, texHeight, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        texture = LoadTextureFromImage(image);
+        SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+        textureLoaded = true;
+        chunkVersions.assign(chunkCount, 0);
+    }
+    if (chunkVersions.size() != chunkCount)
+    {
+        chunkVersions.assign(chunkCount, 0);
+    }
 
-    for (int y = 0; y < mapH; ++y)
+    bool dirty = false;
+    for (int chunkY = 0; chunkY < map.get_terrain_chunks_y(); ++chunkY)
     {
-        for (int x = 0; x < mapW; ++x)
+        for (int chunkX = 0; chunkX < map.get_terrain_chunks_x(); ++chunkX)
         {
-            Vector2D pos{ x, y };
-            if (!map.is_explored(pos))
+            uint64_t& painted = chunkVersions[static_cast<size_t>(chunkY) * map.get_terrain_chunks_x() + chunkX];
+            const uint64_t current = map.get_terrain_version(chunkX, chunkY);
+            if (painted != current)
             {
-                continue;
+                paint_chunk(map, chunkX, chunkY);
+                painted = current;
+                dirty = true;
             }
+        }
+    }
+    if (dirty)
+    {
+        UpdateTexture(texture, texels.data());
+    }
+}
 
-            bool inFov = map.is_in_fov(pos);
-            Color c{};
+// TERRAIN_CHUNK_SIZE is a multiple of REDUCED_SCALE, so a chunk always
+// covers whole texels.
+void Minimap::paint_chunk(const Map& map, int chunkX, int chunkY) const
+{
+    static_assert(TERRAIN_CHUNK_SIZE % REDUCED_SCALE == 0);
 
-            switch (map.get_tile_type(pos))
+    const TileGrid& grid = map.get_tile_grid();
+    const BitPlane& fov = map.get_fov_plane();
+    const int mapW = map.get_width();
+    const int mapH = map.get_height();
+    const int firstX = chunkX * TERRAIN_CHUNK_SIZE;
+    const int firstY = chunkY * TERRAIN_CHUNK_SIZE;
+    const int endX = std::min(mapW, firstX + TERRAIN_CHUNK_SIZE);
+    const int endY = std::min(mapH, firstY + TERRAIN_CHUNK_SIZE);
+
+    for (int y = firstY; y < endY; y += scale)
+    {
+        for (int x = firstX; x < endX; x += scale)
+        {
+            Color c{ 0, 0, 0, 0 };
+            int bestRank = 0;
+            for (int dy = 0; dy < scale && y + dy < mapH; ++dy)
             {
-            case TileType::FLOOR:
-            case TileType::OPEN_DOOR:
-                c = inFov ? Color{ 180, 180, 160, 230 } : Color{ 100, 100, 90, 200 };
-                break;
-            case TileType::CORRIDOR:
-                c = inFov ? Color{ 150, 150, 130, 230 } : Color{ 80, 80, 70, 200 };
-                break;
-            case TileType::WALL:
-                c = inFov ? Color{ 90, 90, 80, 210 } : Color{ 50, 50, 45, 180 };
-                break;
-            case TileType::WATER:
-                c = inFov ? Color{ 80, 160, 230, 230 } : Color{ 30, 100, 180, 200 };
-                break;
-            case TileType::CLOSED_DOOR:
-                c = inFov ? Color{ 210, 140, 70, 230 } : Color{ 150, 95, 45, 200 };
-                break;
-            default:
-                c = inFov ? Color{ 100, 100, 90, 200 } : Color{ 55, 55, 50, 180 };
-                break;
+                for (int dx = 0; dx < scale && x + dx < mapW; ++dx)
+                {
+                    const size_t index = static_cast<size_t>(y + dy) * mapW + (x + dx);
+                    if (!grid.explored().test(index))
+                    {
+                        continue;
+                    }
+                    const TileType type = grid.type(index);
+                    if (tile_rank(type) > bestRank)
+                    {
+                        bestRank = tile_rank(type);
+                        c = tile_color(type, true, fov.test(index));
+                    }
+                }
             }
-
-            DrawRectangle(originX + x * TILE_PX, originY + y * TILE_PX, TILE_PX, TILE_PX, c);
+            texels[static_cast<size_t>(y / scale) * texture.width + x / scale] = c;
         }
     }
+}
+
+void Minimap::render(const GameContext& ctx) const
+{
+    if (!visible || !ctx.map || !ctx.renderer || !ctx.player)
+    {
+        return;
+    }
+
+    const Map& map = *ctx.map;
+    const Renderer& renderer = *ctx.renderer;
+    if (map.get_width() <= 0 || map.get_height() <= 0)
+    {
+        return;
+    }
+
+    sync_texture(map);
+
+    // One screen block of tilePx per tile, whatever the texel density.
+    const int tilePx = reduced ? TILE_PX / REDUCED_SCALE : TILE_PX;
+    const int texelPx = tilePx * scale;
+    int screenW = renderer.get_screen_width();
+
+    int panelW = texture.width * texelPx;
+    int panelH = texture.height * texelPx;
+    int originX = screenW - panelW - PADDING;
+    int originY = PADDING;
+
+    DrawRectangle(originX - 2, originY - 2, panelW + 4, panelH + 4, Color{ 0, 0, 0, 200 });
+    DrawTexturePro(
+        texture,
+        Rectangle{ 0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height) },
+        Rectangle{ static_cast<float>(originX), static_cast<float>(originY), static_cast<float>(panelW), static_cast<float>(panelH) },
+        Vector2{ 0.0f, 0.0f },
+        0.0f,
+        Color{ 255, 255, 255, 255 });
 
     if (ctx.stairs)
     {
@@ -85,19 +207,30 @@ void Minimap::render(const GameContext& ctx) const
         if (map.is_explored(sp))
         {
             DrawRectangle(
-                originX + sp.x * TILE_PX - 1,
-                originY + sp.y * TILE_PX - 1,
-                TILE_PX + 2,
-                TILE_PX + 2,
+                originX + sp.x * tilePx - 1,
+                originY + sp.y * tilePx - 1,
+                tilePx + 2,
+                tilePx + 2,
                 Color{ 255, 210, 50, 255 });
         }
     }
 
     Vector2D pp = ctx.player->position;
     DrawRectangle(
-        originX + pp.x * TILE_PX - 1,
-        originY + pp.y * TILE_PX - 1,
-        TILE_PX + 2,
-        TILE_PX + 2,
+        originX + pp.x * tilePx - 1,
+        originY + pp.y * tilePx - 1,
+        tilePx + 2,
+        tilePx + 2,
         Color{ 255, 255, 0, 255 });
 }
+
+void Minimap::unload()
+{
+    if (textureLoaded)
+    {
+        UnloadTexture(texture);
+        textureLoaded = false;
+    }
+    texels.clear();
+    chunkVersions.clear();
+}
@@ -1,16 +1,55 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
+#include <raylib.h>
+
+#include "TileGrid.h"
+
 struct GameContext;
+class Map;
 
+// Whole-map overview in the top-right corner. The map is kept in a texture
+// with one texel per tile (or per REDUCED_SCALE x REDUCED_SCALE block in
+// reduced mode). Only terrain chunks whose version changed since the last
+// render are repainted (Map::get_terrain_version covers tile, explored and
+// FOV changes), and the texture is drawn as a single scaled quad.
 class Minimap
 {
     static constexpr int TILE_PX = 2;
     static constexpr int PADDING = 8;
+    static constexpr int REDUCED_SCALE = 2; // tiles per texel side in reduced mode
 
     bool visible{ false };
+    bool reduced{ false };
+
+    mutable Texture2D texture{};
+    mutable bool textureLoaded{ false };
+    mutable int scale{ 1 };
+    mutable std::vector<Color> texels;
+    mutable std::vector<uint64_t> chunkVersions; // terrain version each chunk was painted for
+
+    void sync_texture(const Map& map) const;
+    void paint_chunk(const Map& map, int chunkX, int chunkY) const;
 
 public:
+    Minimap() = default;
+    ~Minimap() = default;
+
+    Minimap(const Minimap&) = delete;
+    Minimap& operator=(const Minimap&) = delete;
+
     void toggle() noexcept;
     [[nodiscard]] bool is_visible() const noexcept;
+
+    // Reduced mode halves the texture and the panel, for very large maps.
+    void toggle_reduced() noexcept;
+    [[nodiscard]] bool is_reduced() const noexcept { return reduced; }
+
     void render(const GameContext& ctx) const;
+    void unload();
+
+    // Colour of one tile on the minimap; unexplored tiles are transparent.
+    [[nodiscard]] static Color tile_color(TileType type, bool explored, bool inFov) noexcept;
 };
@@ -0,0 +1,63 @@
+// OccupancyGrid.cpp -- per-level creature index keyed by tile index.
+#include <algorithm>
+#include <cstddef>
+
+#include "OccupancyGrid.h"
+
+void OccupancyGrid::resize(int width, int height)
+{
+	width_ = std::max(0, width);
+	height_ = std::max(0, height);
+	slots_.assign(static_cast<size_t>(width_) * height_, nullptr);
+}
+
+void OccupancyGrid::clear() noexcept
+{
+	std::fill(slots_.begin(), slots_.end(), nullptr);
+}
+
+bool OccupancyGrid::in_bounds(Vector2D pos) const noexcept
+{
+	return pos.x >= 0 && pos.x < width_ && pos.y >= 0 && pos.y < height_;
+}
+
+int OccupancyGrid::slot_index(Vector2D pos) const noexcept
+{
+	return pos.y * width_ + pos.x;
+}
+
+Creature* OccupancyGrid::at(Vector2D pos) const noexcept
+{
+	if (!in_bounds(pos))
+	{
+		return nullptr;
+	}
+
+	return slots_[slot_index(pos)];
+}
+
+void OccupancyGrid::place(Creature& creature, Vector2D pos) noexcept
+{
+	if (!in_bounds(pos))
+	{
+		return;
+	}
+
+	slots_[slot_index(pos)] = &creature;
+}
+
+void OccupancyGrid::remove(const Creature& creature, Vector2D pos) noexcept
+{
+	if (!in_bounds(pos))
+	{
+		return;
+	}
+
+	// Only clear the slot if it still belongs to this creature; another
+	// creature may already have stepped onto the tile.
+	Creature*& slot = slots_[slot_index(pos)];
+	if (slot == &creature)
+	{
+		slot = nullptr;
+	}
+}
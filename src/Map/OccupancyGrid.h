@@ -0,0 +1,52 @@
+#pragma once
+// OccupancyGrid.h -- per-level creature index keyed by tile index.
+
+#include <vector>
+
+#include "../Utils/Vector2D.h"
+
+class Creature;
+
+// ---------------------------------------------------------------------------
+// OccupancyGrid -- one creature slot per map tile.
+//
+// Answers "who stands here?" in O(1) instead of scanning the creature list.
+// The grid does not own creatures; CreatureManager keeps it in sync on
+// spawn, move and cleanup. A slot may briefly hold a creature that has died
+// or moved away -- callers validate the slot against the creature itself.
+// ---------------------------------------------------------------------------
+class OccupancyGrid
+{
+public:
+	void resize(int width, int height);
+	void clear() noexcept;
+
+	bool in_bounds(Vector2D pos) const noexcept;
+	bool is_bound() const noexcept { return width_ > 0 && height_ > 0; }
+	int get_width() const noexcept { return width_; }
+	int get_height() const noexcept { return height_; }
+
+	Creature* at(Vector2D pos) const noexcept;
+	void place(Creature& creature, Vector2D pos) noexcept;
+	void remove(const Creature& creature, Vector2D pos) noexcept;
+
+	// Visits every non-empty slot as fn(Vector2D pos, Creature* creature).
+	template <typename Fn>
+	void for_each_occupied(Fn&& fn) const
+	{
+		for (int i = 0; i < static_cast<int>(slots_.size()); ++i)
+		{
+			if (slots_[i] != nullptr)
+			{
+				fn(Vector2D{ i % width_, i / width_ }, slots_[i]);
+			}
+		}
+	}
+
+private:
+	int width_{ 0 };
+	int height_{ 0 };
+	std::vector<Creature*> slots_;
+
+	int slot_index(Vector2D pos) const noexcept;
+};
@@ -0,0 +1,35 @@
+// TileGrid.cpp -- struct-of-arrays storage for the map's per-tile data.
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "TileGrid.h"
+
+void TileGrid::resize(int width, int height)
+{
+	width_ = std::max(0, width);
+	height_ = std::max(0, height);
+	const size_t count = static_cast<size_t>(width_) * height_;
+
+	types_.assign(count, static_cast<uint8_t>(TileType::WALL));
+	doorStates_.assign(count, static_cast<uint8_t>(DoorState::OPEN));
+	costs_.assign(count, 0);
+	explored_.resize(count);
+}
+
+Vector2D TileGrid::position_of(size_t index) const noexcept
+{
+	const int i = static_cast<int>(index);
+	return Vector2D{ i % width_, i / width_ };
+}
+
+void TileGrid::set_cost(size_t index, double cost) noexcept
+{
+	costs_[index] = static_cast<uint8_t>(std::clamp(std::lround(cost), 0L, 255L));
+}
+
+size_t TileGrid::memory_bytes() const noexcept
+{
+	return types_.size() + doorStates_.size() + costs_.size() + explored_.memory_bytes();
+}
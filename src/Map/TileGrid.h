@@ -0,0 +1,79 @@
+#pragma once
+// TileGrid.h -- struct-of-arrays storage for the map's per-tile data.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../Utils/Vector2D.h"
+#include "BitPlane.h"
+
+enum class TileType : uint8_t
+{
+	FLOOR,
+	WALL,
+	WATER,
+	CLOSED_DOOR,
+	OPEN_DOOR,
+	CORRIDOR,
+	// Add more as needed...
+};
+inline constexpr TileType LAST_TILE_TYPE = TileType::CORRIDOR; // keep in step with TileType
+
+enum class DoorState : uint8_t
+{
+	OPEN,
+	CLOSED_UNLOCKED,
+	CLOSED_LOCKED
+};
+inline constexpr DoorState LAST_DOOR_STATE = DoorState::CLOSED_LOCKED; // keep in step with DoorState
+
+// ---------------------------------------------------------------------------
+// TileGrid -- one byte plane per tile attribute plus an explored bit plane.
+//
+// Replaces the old std::vector<Tile> (position + double cost + enum + bool +
+// DoorState, ~32 bytes per tile). Position is implied by the index, movement
+// costs are small integers (0, 1, 2, 10) and fit a byte. Walkable,
+// transparent and visible bits live in FovMap so they are not duplicated.
+// Indices are row-major: y * width + x, matching Map::get_index.
+// ---------------------------------------------------------------------------
+class TileGrid
+{
+public:
+	// Resets every tile to an unexplored WALL with cost 0 and an open door state.
+	void resize(int width, int height);
+
+	bool empty() const noexcept { return types_.empty(); }
+	size_t size() const noexcept { return types_.size(); }
+	int get_width() const noexcept { return width_; }
+	int get_height() const noexcept { return height_; }
+	bool in_bounds(Vector2D pos) const noexcept { return pos.x >= 0 && pos.x < width_ && pos.y >= 0 && pos.y < height_; }
+	size_t index_of(Vector2D pos) const noexcept { return static_cast<size_t>(pos.y) * width_ + pos.x; }
+	Vector2D position_of(size_t index) const noexcept;
+
+	TileType type(size_t index) const noexcept { return static_cast<TileType>(types_[index]); }
+	void set_type(size_t index, TileType type) noexcept { types_[index] = static_cast<uint8_t>(type); }
+
+	DoorState door_state(size_t index) const noexcept { return static_cast<DoorState>(doorStates_[index]); }
+	void set_door_state(size_t index, DoorState state) noexcept { doorStates_[index] = static_cast<uint8_t>(state); }
+
+	double cost(size_t index) const noexcept { return static_cast<double>(costs_[index]); }
+	void set_cost(size_t index, double cost) noexcept;
+
+	BitPlane& explored() noexcept { return explored_; }
+	const BitPlane& explored() const noexcept { return explored_; }
+
+	const std::vector<uint8_t>& type_plane() const noexcept { return types_; }
+	const std::vector<uint8_t>& cost_plane() const noexcept { return costs_; }
+	const std::vector<uint8_t>& door_plane() const noexcept { return doorStates_; }
+
+	size_t memory_bytes() const noexcept;
+
+private:
+	int width_{ 0 };
+	int height_{ 0 };
+	std::vector<uint8_t> types_;
+	std::vector<uint8_t> doorStates_;
+	std::vector<uint8_t> costs_;
+	BitPlane explored_;
+};
@@ -39,6 +39,10 @@ void BaseMenu::menu_clear()
 void BaseMenu::menu_print(int x, int y, const std::string& text)
 {
 	assert(renderer && "BaseMenu::menu_print called without a renderer");
+	if (!renderer->is_initialized())
+	{
+		return;
+	}
 
 	int tileSize = renderer->get_tile_size();
 	int px = (static_cast<int>(menuStartX) + x) * tileSize;
@@ -2,8 +2,6 @@
 #include <algorithm>
 #include <cctype>
 
-#include <raylib.h>
-
 #include "../Colors/Colors.h"
 #include "../Core/GameContext.h"
 #include "../Renderer/InputSystem.h"
@@ -139,13 +137,10 @@ void ListMenu::menu(GameContext& ctx)
     // Hover -- update cursor only when the mouse actually moves.
     // Without the delta guard, a stationary mouse inside the menu area
     // resets cursorIndex every frame, making keyboard UP/DOWN invisible.
-    ::Vector2 mouseDelta = GetMouseDelta();
-    bool mouseMoved = (mouseDelta.x != 0.0f || mouseDelta.y != 0.0f);
-    if (mouseMoved && inputSystem && renderer)
+    if (inputSystem && inputSystem->mouse_moved() && renderer)
     {
         int tileSize = renderer->get_tile_size();
-        ::Vector2 rawMouse = GetMousePosition();
-        int relRow = static_cast<int>(rawMouse.y) / tileSize - static_cast<int>(menuStartY) - 1;
+        int relRow = inputSystem->get_mouse_position().y / tileSize - static_cast<int>(menuStartY) - 1;
         if (relRow >= 0 && relRow < static_cast<int>(entries.size()))
         {
             cursorIndex = static_cast<size_t>(relRow);
@@ -163,8 +158,7 @@ void ListMenu::menu(GameContext& ctx)
         if (renderer)
         {
             int tileSize = renderer->get_tile_size();
-            ::Vector2 rawMouse = GetMousePosition();
-            int relRow = static_cast<int>(rawMouse.y) / tileSize
+            int relRow = inputSystem->get_mouse_position().y / tileSize
                 - static_cast<int>(menuStartY) - 1;
             if (relRow >= 0 && relRow < static_cast<int>(entries.size()))
             {
@@ -59,7 +59,7 @@ bool Trap::attempt_detect(Creature& creature, GameContext& ctx)
 	}
 
 	// Roll 1d20 + DEX modifier vs detection DC
-	int roll = ctx.dice->roll(1, 20);
+	int roll = ctx.dice->combat().roll(1, 20);
 	int dexMod = (creature.get_dexterity() - 10) / 2;
 	int checkResult = roll + dexMod;
 
@@ -98,7 +98,7 @@ bool Trap::attempt_disarm(Creature& creature, GameContext& ctx)
 	}
 
 	// Roll 1d20 + DEX modifier vs disarm DC
-	int roll = ctx.dice->roll(1, 20);
+	int roll = ctx.dice->combat().roll(1, 20);
 	int dexMod = (creature.get_dexterity() - 10) / 2;
 	int checkResult = roll + dexMod;
 
@@ -161,7 +161,7 @@ bool Trap::apply_movement_effect(Creature& creature, GameContext& ctx)
 		creature.take_damage_and_check_death(damage, ctx);
 
 		// 50% chance trap is destroyed after triggering
-		if (ctx.dice->d2() == 1)
+		if (ctx.dice->combat().d2() == 1)
 		{
 			destroy(ctx);
 			if (ctx.messageSystem)
@@ -187,7 +187,7 @@ void Trap::attempt_passive_detection(Creature& creature, GameContext& ctx)
 	if (state_ == TrapState::HIDDEN)
 	{
 		// Passive detection: roll vs detection DC
-		int roll = ctx.dice->roll(1, 20);
+		int roll = ctx.dice->combat().roll(1, 20);
 		int dexMod = (creature.get_dexterity() - 10) / 2;
 		int checkResult = roll + dexMod;
 
@@ -204,7 +204,7 @@ void Trap::attempt_passive_detection(Creature& creature, GameContext& ctx)
 
 int Trap::roll_damage(RandomDice& dice) const
 {
-	return dice.roll(damageDiceCount_, damageDiceSize_);
+	return dice.combat().roll(damageDiceCount_, damageDiceSize_);
 }
 
 
@@ -0,0 +1,104 @@
+// Base64.cpp -- padded base64 encode/decode.
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Base64.h"
+
+namespace
+{
+	constexpr std::string_view ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	constexpr uint8_t INVALID = 0xFF;
+
+	constexpr std::array<uint8_t, 256> make_lookup()
+	{
+		std::array<uint8_t, 256> lookup{};
+		lookup.fill(INVALID);
+		for (size_t i = 0; i < ALPHABET.size(); ++i)
+		{
+			lookup[static_cast<uint8_t>(ALPHABET[i])] = static_cast<uint8_t>(i);
+		}
+		return lookup;
+	}
+
+	constexpr std::array<uint8_t, 256> LOOKUP = make_lookup();
+} // namespace
+
+std::string Base64::encode(std::span<const uint8_t> bytes)
+{
+	std::string out;
+	out.reserve((bytes.size() + 2) / 3 * 4);
+	size_t i = 0;
+	for (; i + 3 <= bytes.size(); i += 3)
+	{
+		const uint32_t group = (uint32_t{ bytes[i] } << 16) | (uint32_t{ bytes[i + 1] } << 8) | bytes[i + 2];
+		out.push_back(ALPHABET[(group >> 18) & 63]);
+		out.push_back(ALPHABET[(group >> 12) & 63]);
+		out.push_back(ALPHABET[(group >> 6) & 63]);
+		out.push_back(ALPHABET[group & 63]);
+	}
+	const size_t rest = bytes.size() - i;
+	if (rest > 0)
+	{
+		const uint32_t group = (uint32_t{ bytes[i] } << 16) | (rest == 2 ? uint32_t{ bytes[i + 1] } << 8 : 0);
+		out.push_back(ALPHABET[(group >> 18) & 63]);
+		out.push_back(ALPHABET[(group >> 12) & 63]);
+		out.push_back(rest == 2 ? ALPHABET[(group >> 6) & 63] : '=');
+		out.push_back('=');
+	}
+	return out;
+}
+
+std::optional<std::vector<uint8_t>> Base64::decode(std::string_view text)
+{
+	if (text.size() % 4 != 0)
+	{
+		return std::nullopt;
+	}
+	size_t padding = 0;
+	if (!text.empty() && text.back() == '=')
+	{
+		padding = (text[text.size() - 2] == '=') ? 2 : 1;
+	}
+
+	std::vector<uint8_t> out;
+	out.reserve(text.size() / 4 * 3);
+	for (size_t i = 0; i < text.size(); i += 4)
+	{
+		const bool last = i + 4 == text.size();
+		uint32_t group = 0;
+		for (size_t k = 0; k < 4; ++k)
+		{
+			const char c = text[i + k];
+			uint8_t value = 0;
+			if (c == '=' && last && k >= 4 - padding)
+			{
+				value = 0;
+			}
+			else
+			{
+				value = LOOKUP[static_cast<uint8_t>(c)];
+				if (value == INVALID)
+				{
+					return std::nullopt;
+				}
+			}
+			group = (group << 6) | value;
+		}
+		out.push_back(static_cast<uint8_t>(group >> 16));
+		if (!last || padding < 2)
+		{
+			out.push_back(static_cast<uint8_t>(group >> 8));
+		}
+		if (!last || padding < 1)
+		{
+			out.push_back(static_cast<uint8_t>(group));
+		}
+	}
+	return out;
+}
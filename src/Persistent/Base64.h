@@ -0,0 +1,17 @@
+#pragma once
+// Base64.h -- RFC 4648 base64, for binary planes stored inside JSON.
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Base64
+{
+	std::string encode(std::span<const uint8_t> bytes);
+
+	// nullopt on a character outside the alphabet or a bad length.
+	std::optional<std::vector<uint8_t>> decode(std::string_view text);
+} // namespace Base64
@@ -0,0 +1,39 @@
+// BinaryStream.cpp -- string and bounds handling for BinaryWriter/BinaryReader.
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "BinaryStream.h"
+
+void BinaryWriter::write_string(std::string_view text)
+{
+	write_u32(static_cast<uint32_t>(text.size()));
+	const auto* first = reinterpret_cast<const uint8_t*>(text.data());
+	buffer.insert(buffer.end(), first, first + text.size());
+}
+
+std::string BinaryReader::read_string()
+{
+	const uint32_t length = read_u32();
+	const std::span<const uint8_t> chars = read_bytes(length);
+	return std::string(reinterpret_cast<const char*>(chars.data()), chars.size());
+}
+
+std::span<const uint8_t> BinaryReader::read_bytes(size_t count)
+{
+	need(count);
+	const std::span<const uint8_t> result = bytes.subspan(pos, count);
+	pos += count;
+	return result;
+}
+
+void BinaryReader::need(size_t count) const
+{
+	if (count > bytes.size() - pos)
+	{
+		throw std::runtime_error("Save data is truncated.");
+	}
+}
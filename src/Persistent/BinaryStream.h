@@ -0,0 +1,89 @@
+#pragma once
+// BinaryStream.h -- little-endian byte writer and bounds-checked reader.
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// BinaryWriter -- appends fixed-width little-endian values to a byte buffer.
+// One writer is reused for every save section, so after the first save it
+// stops allocating.
+// ---------------------------------------------------------------------------
+class BinaryWriter
+{
+public:
+	void write_u8(uint8_t value) { buffer.push_back(value); }
+	void write_u16(uint16_t value) { write_le(value, 2); }
+	void write_u32(uint32_t value) { write_le(value, 4); }
+	void write_u64(uint64_t value) { write_le(value, 8); }
+	void write_i32(int32_t value) { write_u32(static_cast<uint32_t>(value)); }
+	void write_f64(double value) { write_u64(std::bit_cast<uint64_t>(value)); }
+	void write_bool(bool value) { write_u8(value ? 1 : 0); }
+	void write_bytes(std::span<const uint8_t> bytes) { buffer.insert(buffer.end(), bytes.begin(), bytes.end()); }
+
+	// u32 length, then the bytes.
+	void write_string(std::string_view text);
+
+	[[nodiscard]] std::span<const uint8_t> data() const noexcept { return buffer; }
+	[[nodiscard]] size_t size() const noexcept { return buffer.size(); }
+	void clear() noexcept { buffer.clear(); }
+
+private:
+	void write_le(uint64_t value, int bytes)
+	{
+		for (int i = 0; i < bytes; ++i)
+		{
+			buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+		}
+	}
+
+	std::vector<uint8_t> buffer;
+};
+
+// ---------------------------------------------------------------------------
+// BinaryReader -- reads what BinaryWriter wrote from a borrowed byte span.
+// Reading past the end throws std::runtime_error, so a truncated or corrupt
+// save fails the load instead of reading garbage.
+// ---------------------------------------------------------------------------
+class BinaryReader
+{
+public:
+	explicit BinaryReader(std::span<const uint8_t> data) noexcept : bytes(data) {}
+
+	uint8_t read_u8() { need(1); return bytes[pos++]; }
+	uint16_t read_u16() { return static_cast<uint16_t>(read_le(2)); }
+	uint32_t read_u32() { return static_cast<uint32_t>(read_le(4)); }
+	uint64_t read_u64() { return read_le(8); }
+	int32_t read_i32() { return static_cast<int32_t>(read_u32()); }
+	double read_f64() { return std::bit_cast<double>(read_u64()); }
+	bool read_bool() { return read_u8() != 0; }
+	std::string read_string();
+
+	// The next count bytes, borrowed from the underlying span.
+	std::span<const uint8_t> read_bytes(size_t count);
+
+	[[nodiscard]] size_t remaining() const noexcept { return bytes.size() - pos; }
+	[[nodiscard]] bool at_end() const noexcept { return pos == bytes.size(); }
+
+private:
+	void need(size_t count) const;
+
+	uint64_t read_le(int count)
+	{
+		need(static_cast<size_t>(count));
+		uint64_t value = 0;
+		for (int i = 0; i < count; ++i)
+		{
+			value |= static_cast<uint64_t>(bytes[pos++]) << (8 * i);
+		}
+		return value;
+	}
+
+	std::span<const uint8_t> bytes;
+	size_t pos{ 0 };
+};
@@ -0,0 +1,173 @@
+// LzCodec.cpp -- greedy LZ77 compressor and decoder (LZ4 block layout).
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "LzCodec.h"
+
+namespace
+{
+	constexpr size_t MIN_MATCH = 4;
+	constexpr size_t MAX_OFFSET = 65535;
+	constexpr int HASH_BITS = 12;
+
+	uint32_t load32(const uint8_t* p) noexcept
+	{
+		uint32_t value;
+		std::memcpy(&value, p, sizeof(value));
+		return value;
+	}
+
+	size_t hash32(uint32_t value) noexcept
+	{
+		return (value * 2654435761u) >> (32 - HASH_BITS);
+	}
+
+	// 15 in a nibble means the length continues in 255-saturated bytes.
+	void put_length(std::vector<uint8_t>& out, size_t length)
+	{
+		while (length >= 255)
+		{
+			out.push_back(255);
+			length -= 255;
+		}
+		out.push_back(static_cast<uint8_t>(length));
+	}
+
+	void put_sequence(std::vector<uint8_t>& out, std::span<const uint8_t> literals, size_t offset, size_t matchLength)
+	{
+		const size_t literalCount = literals.size();
+		const size_t matchCode = matchLength == 0 ? 0 : matchLength - MIN_MATCH;
+		const uint8_t token = static_cast<uint8_t>(
+			((literalCount < 15 ? literalCount : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+		out.push_back(token);
+		if (literalCount >= 15)
+		{
+			put_length(out, literalCount - 15);
+		}
+		out.insert(out.end(), literals.begin(), literals.end());
+		if (matchLength == 0)
+		{
+			return;
+		}
+		out.push_back(static_cast<uint8_t>(offset & 0xFF));
+		out.push_back(static_cast<uint8_t>(offset >> 8));
+		if (matchCode >= 15)
+		{
+			put_length(out, matchCode - 15);
+		}
+	}
+
+	// Reads a continued length; false if the input ends first.
+	bool get_length(std::span<const uint8_t> input, size_t& pos, size_t& length)
+	{
+		uint8_t byte = 255;
+		while (byte == 255)
+		{
+			if (pos >= input.size())
+			{
+				return false;
+			}
+			byte = input[pos++];
+			length += byte;
+		}
+		return true;
+	}
+} // namespace
+
+std::vector<uint8_t> LzCodec::compress(std::span<const uint8_t> input)
+{
+	std::vector<uint8_t> out;
+	out.reserve(input.size() / 4 + 16);
+
+	std::array<int64_t, size_t{ 1 } << HASH_BITS> table;
+	table.fill(-1);
+
+	const size_t size = input.size();
+	size_t anchor = 0;
+	size_t pos = 0;
+	while (pos + MIN_MATCH <= size)
+	{
+		const uint32_t sequence = load32(input.data() + pos);
+		int64_t& slot = table[hash32(sequence)];
+		const int64_t candidate = slot;
+		slot = static_cast<int64_t>(pos);
+
+		if (candidate < 0
+			|| pos - static_cast<size_t>(candidate) > MAX_OFFSET
+			|| load32(input.data() + candidate) != sequence)
+		{
+			++pos;
+			continue;
+		}
+
+		const size_t from = static_cast<size_t>(candidate);
+		size_t length = MIN_MATCH;
+		while (pos + length < size && input[from + length] == input[pos + length])
+		{
+			++length;
+		}
+		put_sequence(out, input.subspan(anchor, pos - anchor), pos - from, length);
+		pos += length;
+		anchor = pos;
+	}
+	put_sequence(out, input.subspan(anchor), 0, 0);
+	return out;
+}
+
+bool LzCodec::decompress(std::span<const uint8_t> input, std::span<uint8_t> out)
+{
+	size_t in = 0;
+	size_t written = 0;
+	while (in < input.size())
+	{
+		const uint8_t token = input[in++];
+
+		size_t literalCount = token >> 4;
+		if (literalCount == 15 && !get_length(input, in, literalCount))
+		{
+			return false;
+		}
+		if (literalCount > input.size() - in || literalCount > out.size() - written)
+		{
+			return false;
+		}
+		std::memcpy(out.data() + written, input.data() + in, literalCount);
+		in += literalCount;
+		written += literalCount;
+
+		if (in == input.size())
+		{
+			break; // the final, literal-only sequence
+		}
+
+		if (input.size() - in < 2)
+		{
+			return false;
+		}
+		const size_t offset = static_cast<size_t>(input[in]) | (static_cast<size_t>(input[in + 1]) << 8);
+		in += 2;
+		size_t matchLength = token & 0x0F;
+		if (matchLength == 15 && !get_length(input, in, matchLength))
+		{
+			return false;
+		}
+		matchLength += MIN_MATCH;
+		if (offset == 0 || offset > written || matchLength > out.size() - written)
+		{
+			return false;
+		}
+
+		// Byte by byte: a match may overlap the bytes it is producing.
+		const size_t from = written - offset;
+		for (size_t i = 0; i < matchLength; ++i)
+		{
+			out[written + i] = out[from + i];
+		}
+		written += matchLength;
+	}
+	return written == out.size();
+}
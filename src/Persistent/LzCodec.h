@@ -0,0 +1,33 @@
+#pragma once
+// LzCodec.h -- small LZ77 block compressor for save-file tile planes.
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// LzCodec -- byte-oriented LZ77 in the LZ4 block layout.
+//
+// A block is a run of sequences: a token byte (literal count in the high
+// nibble, match length - 4 in the low nibble, 15 meaning "more length bytes
+// follow"), the literals, then a 16-bit little-endian back offset and the
+// extra match length bytes. The last sequence carries literals only.
+// Compression is a greedy single-hash-table pass; decompression is a plain
+// copy loop. Map planes are long runs of wall and floor bytes, so even this
+// simple scheme takes them to a few percent of their raw size.
+//
+// The block does not record its decoded size; the caller stores it.
+// ---------------------------------------------------------------------------
+namespace LzCodec
+{
+	// No block decodes to more than this many bytes per stored byte: past
+	// the token, each extra length byte adds at most 255.
+	inline constexpr size_t MAX_RATIO = 255;
+
+	std::vector<uint8_t> compress(std::span<const uint8_t> input);
+
+	// Decodes a block into out, which must be exactly the decoded size.
+	// Returns false on malformed or mis-sized input; out is then unspecified.
+	[[nodiscard]] bool decompress(std::span<const uint8_t> input, std::span<uint8_t> out);
+} // namespace LzCodec
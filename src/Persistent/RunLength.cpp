@@ -0,0 +1,123 @@
+// RunLength.cpp -- varint run-length encoding of byte and bit planes.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../Map/BitPlane.h"
+#include "RunLength.h"
+
+namespace
+{
+	void put_varint(std::vector<uint8_t>& out, size_t value)
+	{
+		while (value >= 0x80)
+		{
+			out.push_back(static_cast<uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		out.push_back(static_cast<uint8_t>(value));
+	}
+
+	bool get_varint(std::span<const uint8_t> in, size_t& pos, size_t& value)
+	{
+		value = 0;
+		for (int shift = 0; shift < 64; shift += 7)
+		{
+			if (pos >= in.size())
+			{
+				return false;
+			}
+			const uint8_t byte = in[pos++];
+			value |= static_cast<size_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+} // namespace
+
+std::vector<uint8_t> RunLength::encode_bytes(std::span<const uint8_t> plane)
+{
+	std::vector<uint8_t> out;
+	size_t start = 0;
+	while (start < plane.size())
+	{
+		const uint8_t value = plane[start];
+		size_t end = start + 1;
+		while (end < plane.size() && plane[end] == value)
+		{
+			++end;
+		}
+		out.push_back(value);
+		put_varint(out, end - start);
+		start = end;
+	}
+	return out;
+}
+
+bool RunLength::decode_bytes(std::span<const uint8_t> runs, std::span<uint8_t> plane)
+{
+	size_t pos = 0;
+	size_t filled = 0;
+	while (pos < runs.size())
+	{
+		const uint8_t value = runs[pos++];
+		size_t length = 0;
+		if (!get_varint(runs, pos, length) || length == 0 || length > plane.size() - filled)
+		{
+			return false;
+		}
+		std::fill_n(plane.begin() + static_cast<std::ptrdiff_t>(filled), length, value);
+		filled += length;
+	}
+	return filled == plane.size();
+}
+
+std::vector<uint8_t> RunLength::encode_bits(const BitPlane& plane)
+{
+	std::vector<uint8_t> out;
+	bool value = false;
+	size_t start = 0;
+	while (start < plane.size())
+	{
+		size_t end = start;
+		while (end < plane.size() && plane.test(end) == value)
+		{
+			++end;
+		}
+		put_varint(out, end - start);
+		start = end;
+		value = !value;
+	}
+	return out;
+}
+
+bool RunLength::decode_bits(std::span<const uint8_t> runs, BitPlane& plane)
+{
+	plane.clear_all();
+	size_t pos = 0;
+	size_t filled = 0;
+	bool value = false;
+	while (pos < runs.size())
+	{
+		size_t length = 0;
+		if (!get_varint(runs, pos, length) || length > plane.size() - filled)
+		{
+			return false;
+		}
+		if (value)
+		{
+			for (size_t i = filled; i < filled + length; ++i)
+			{
+				plane.set(i);
+			}
+		}
+		filled += length;
+		value = !value;
+	}
+	return filled == plane.size();
+}
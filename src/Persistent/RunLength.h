@@ -0,0 +1,26 @@
+#pragma once
+// RunLength.h -- run-length codes for the map's byte and bit planes.
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class BitPlane;
+
+// ---------------------------------------------------------------------------
+// RunLength -- the encodings Map::save uses for its tile planes.
+//
+// A byte plane becomes (value, run length) pairs; a bit plane becomes the
+// lengths of its alternating runs, starting with a run of clear bits (which
+// may be empty). Lengths are LEB128 varints, so a 120x80 map of a few dozen
+// rooms encodes to a few hundred bytes instead of one object per tile.
+// Decoders return false unless the runs cover the plane exactly.
+// ---------------------------------------------------------------------------
+namespace RunLength
+{
+	std::vector<uint8_t> encode_bytes(std::span<const uint8_t> plane);
+	[[nodiscard]] bool decode_bytes(std::span<const uint8_t> runs, std::span<uint8_t> plane);
+
+	std::vector<uint8_t> encode_bits(const BitPlane& plane);
+	[[nodiscard]] bool decode_bits(std::span<const uint8_t> runs, BitPlane& plane); // plane is pre-sized
+} // namespace RunLength
@@ -0,0 +1,224 @@
+// SaveFile.cpp -- section framing, compression and lookup for binary saves.
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "BinaryStream.h"
+#include "LzCodec.h"
+#include "SaveFile.h"
+
+namespace
+{
+	constexpr std::array<uint8_t, 4> MAGIC{ 'C', 'R', 'L', 'S' };
+
+	// Far above any real section (a map plane is a few KB); a raw size past
+	// it is a corrupt header, not something to allocate.
+	constexpr size_t MAX_SECTION_SIZE = 64u * 1024u * 1024u;
+} // namespace
+
+SaveWriter::SaveWriter(std::ostream& stream) : out(stream)
+{
+	BinaryWriter header;
+	header.write_bytes(MAGIC);
+	header.write_u32(VERSION);
+	write_raw(header.data());
+}
+
+void SaveWriter::write_section(SaveSection id, std::span<const uint8_t> payload, bool compress)
+{
+	SaveCodec codec = SaveCodec::RAW;
+	std::span<const uint8_t> stored = payload;
+	std::vector<uint8_t> packed;
+	if (compress)
+	{
+		packed = LzCodec::compress(payload);
+		if (packed.size() < payload.size())
+		{
+			codec = SaveCodec::LZ;
+			stored = packed;
+		}
+	}
+
+	BinaryWriter header;
+	header.write_u32(static_cast<uint32_t>(id));
+	header.write_u8(static_cast<uint8_t>(codec));
+	header.write_u32(static_cast<uint32_t>(stored.size()));
+	header.write_u32(static_cast<uint32_t>(payload.size()));
+	write_raw(header.data());
+	write_raw(stored);
+}
+
+void SaveWriter::write_json_section(SaveSection id, const nlohmann::json& value)
+{
+	scratch.clear();
+	nlohmann::json::to_msgpack(value, scratch);
+	write_section(id, scratch);
+}
+
+void SaveWriter::finish()
+{
+	BinaryWriter end;
+	end.write_u32(static_cast<uint32_t>(SaveSection::END));
+	write_raw(end.data());
+	out.flush();
+	if (!out)
+	{
+		throw std::runtime_error("Error occurred while saving the game.");
+	}
+}
+
+void SaveWriter::write_raw(std::span<const uint8_t> bytes)
+{
+	out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+	written += bytes.size();
+}
+
+void SaveSnapshot::add(SaveSection id, std::span<const uint8_t> payload, bool compress)
+{
+	sections.push_back(Section{ id, std::vector<uint8_t>(payload.begin(), payload.end()), compress });
+}
+
+void SaveSnapshot::add_json(SaveSection id, const nlohmann::json& value)
+{
+	Section section{ id, {}, false };
+	nlohmann::json::to_msgpack(value, section.payload);
+	sections.push_back(std::move(section));
+}
+
+void SaveSnapshot::write(std::ostream& out) const
+{
+	SaveWriter writer(out);
+	for (const Section& section : sections)
+	{
+		writer.write_section(section.id, section.payload, section.compress);
+	}
+	writer.finish();
+}
+
+void SaveSnapshot::write_file(const std::filesystem::path& path) const
+{
+	std::filesystem::create_directories(path.parent_path());
+
+	std::filesystem::path tempPath = path;
+	tempPath += ".tmp";
+	{
+		std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			throw std::runtime_error(std::format("Could not open {} for writing.", tempPath.string()));
+		}
+		write(file);
+	}
+	std::filesystem::rename(tempPath, path);
+}
+
+bool SaveReader::is_binary(std::span<const uint8_t> bytes) noexcept
+{
+	return bytes.size() >= MAGIC.size() && std::equal(MAGIC.begin(), MAGIC.end(), bytes.begin());
+}
+
+SaveReader::SaveReader(std::vector<uint8_t> bytes) : file(std::move(bytes))
+{
+	if (!is_binary(file))
+	{
+		throw std::runtime_error("Not a binary save file.");
+	}
+
+	BinaryReader reader(file);
+	reader.read_bytes(MAGIC.size());
+	version = reader.read_u32();
+	if (version == 0 || version > SaveWriter::VERSION)
+	{
+		throw std::runtime_error(std::format("Unsupported save version {}.", version));
+	}
+
+	for (;;)
+	{
+		const auto id = static_cast<SaveSection>(reader.read_u32());
+		if (id == SaveSection::END)
+		{
+			break;
+		}
+		Entry entry;
+		entry.id = id;
+		entry.codec = static_cast<SaveCodec>(reader.read_u8());
+		entry.storedSize = reader.read_u32();
+		entry.rawSize = reader.read_u32();
+		entry.offset = file.size() - reader.remaining();
+		reader.read_bytes(entry.storedSize);
+		const bool sizeFits = entry.codec == SaveCodec::RAW
+			? entry.rawSize == entry.storedSize
+			: entry.codec != SaveCodec::LZ
+				|| (entry.rawSize <= MAX_SECTION_SIZE && entry.rawSize <= entry.storedSize * LzCodec::MAX_RATIO);
+		if (!sizeFits)
+		{
+			throw std::runtime_error(std::format(
+				"Save section {} claims {} bytes from {} stored.", static_cast<uint32_t>(id), entry.rawSize, entry.storedSize));
+		}
+		entries.push_back(entry);
+	}
+}
+
+bool SaveReader::has(SaveSection id) const noexcept
+{
+	return find(id) != nullptr;
+}
+
+std::vector<uint8_t> SaveReader::payload(SaveSection id) const
+{
+	const Entry* entry = find(id);
+	if (!entry)
+	{
+		return {};
+	}
+
+	const std::span<const uint8_t> stored = std::span<const uint8_t>(file).subspan(entry->offset, entry->storedSize);
+	switch (entry->codec)
+	{
+	case SaveCodec::RAW:
+		return std::vector<uint8_t>(stored.begin(), stored.end());
+
+	case SaveCodec::LZ:
+	{
+		std::vector<uint8_t> decoded(entry->rawSize);
+		if (!LzCodec::decompress(stored, decoded))
+		{
+			throw std::runtime_error(std::format("Save section {} is corrupt.", static_cast<uint32_t>(id)));
+		}
+		return decoded;
+	}
+	}
+	throw std::runtime_error(std::format("Save section {} uses an unknown codec.", static_cast<uint32_t>(id)));
+}
+
+nlohmann::json SaveReader::json_section(SaveSection id) const
+{
+	if (!has(id))
+	{
+		return nullptr;
+	}
+	return nlohmann::json::from_msgpack(payload(id));
+}
+
+const SaveReader::Entry* SaveReader::find(SaveSection id) const noexcept
+{
+	for (const Entry& entry : entries)
+	{
+		if (entry.id == id)
+		{
+			return &entry;
+		}
+	}
+	return nullptr;
+}
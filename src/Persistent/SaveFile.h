@@ -0,0 +1,140 @@
+#pragma once
+// SaveFile.h -- versioned, sectioned binary container for saved games.
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <span>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+// File layout, all integers little-endian:
+//
+//   "CRLS"  u32 version
+//   section*: u32 id, u8 codec, u32 stored size, u32 raw size, payload
+//   u32 id = END
+//
+// Sections are length-prefixed, so a reader skips ids it does not know and
+// a later version can add sections without breaking older files. A section
+// the reader needs but cannot find is simply absent, as with a missing key
+// in the old JSON save.
+enum class SaveSection : uint32_t
+{
+	END = 0,
+	MAP = 1,
+	ROOMS = 2,
+	PLAYER = 3,
+	STAIRS = 4,
+	CREATURES = 5,
+	FLOOR_ITEMS = 6,
+	GUI = 7,
+	HUNGER = 8,
+	LEVEL = 9,
+	TIME = 10,
+	DICE = 11, // master seed and RNG stream states; absent in older saves
+};
+
+enum class SaveCodec : uint8_t
+{
+	RAW = 0,
+	LZ = 1, // LzCodec block
+};
+
+// ---------------------------------------------------------------------------
+// SaveWriter -- streams sections to an ostream as they are produced, so a
+// save never holds more than one section in memory.
+// ---------------------------------------------------------------------------
+class SaveWriter
+{
+public:
+	// 1: raw map planes. 2: run-length coded map planes with door states.
+	static constexpr uint32_t VERSION = 2;
+
+	// Writes the header.
+	explicit SaveWriter(std::ostream& stream);
+
+	// LZ-compresses the payload when asked and when that makes it smaller.
+	void write_section(SaveSection id, std::span<const uint8_t> payload, bool compress = false);
+
+	// Entity sections reuse the objects' JSON save() and store it as
+	// MessagePack: binary and compact, no text formatting or parsing.
+	void write_json_section(SaveSection id, const nlohmann::json& value);
+
+	// Writes the END marker and flushes.
+	void finish();
+
+	[[nodiscard]] size_t bytes_written() const noexcept { return written; }
+
+private:
+	void write_raw(std::span<const uint8_t> bytes);
+
+	std::ostream& out;
+	std::vector<uint8_t> scratch;
+	size_t written{ 0 };
+};
+
+// ---------------------------------------------------------------------------
+// SaveSnapshot -- a save serialised to memory but not yet framed,
+// compressed or written. Capturing one is the only part of a save that
+// must run on the game thread; write()/write_file() can run anywhere.
+// ---------------------------------------------------------------------------
+struct SaveSnapshot
+{
+	struct Section
+	{
+		SaveSection id{ SaveSection::END };
+		std::vector<uint8_t> payload;
+		bool compress{ false };
+	};
+
+	std::vector<Section> sections;
+
+	void add(SaveSection id, std::span<const uint8_t> payload, bool compress = false);
+	void add_json(SaveSection id, const nlohmann::json& value); // as MessagePack
+
+	void write(std::ostream& out) const;
+
+	// Writes next to path and renames over it, so path always holds either
+	// the previous file or the complete new one. Throws std::runtime_error.
+	void write_file(const std::filesystem::path& path) const;
+};
+
+// ---------------------------------------------------------------------------
+// SaveReader -- indexes the sections of a whole save held in memory and
+// hands back decoded payloads. Malformed files throw std::runtime_error.
+// ---------------------------------------------------------------------------
+class SaveReader
+{
+public:
+	// True if bytes start with the binary save magic (otherwise: legacy JSON).
+	[[nodiscard]] static bool is_binary(std::span<const uint8_t> bytes) noexcept;
+
+	explicit SaveReader(std::vector<uint8_t> bytes);
+
+	[[nodiscard]] uint32_t get_version() const noexcept { return version; }
+	[[nodiscard]] bool has(SaveSection id) const noexcept;
+
+	// Decoded payload; empty if the section is absent.
+	[[nodiscard]] std::vector<uint8_t> payload(SaveSection id) const;
+
+	// A write_json_section payload; null if the section is absent.
+	[[nodiscard]] nlohmann::json json_section(SaveSection id) const;
+
+private:
+	struct Entry
+	{
+		SaveSection id{ SaveSection::END };
+		SaveCodec codec{ SaveCodec::RAW };
+		size_t offset{ 0 };
+		size_t storedSize{ 0 };
+		size_t rawSize{ 0 };
+	};
+
+	const Entry* find(SaveSection id) const noexcept;
+
+	std::vector<uint8_t> file;
+	std::vector<Entry> entries;
+	uint32_t version{ 0 };
+};
@@ -0,0 +1,78 @@
+#pragma once
+// Pcg32.h -- PCG32 generator (O'Neill, XSH RR 64/32) with selectable streams.
+
+#include <cstdint>
+#include <limits>
+
+// ---------------------------------------------------------------------------
+// Pcg32 -- 64-bit LCG state, 32-bit permuted output, 16 bytes in all.
+//
+// The increment selects one of 2^63 independent sequences, so generators
+// seeded alike but on different streams never share a run of output. It is
+// a UniformRandomBitGenerator and works with <algorithm> and <random>.
+// ---------------------------------------------------------------------------
+class Pcg32
+{
+public:
+	using result_type = uint32_t;
+
+	constexpr Pcg32() noexcept { seed(DEFAULT_SEED, 0); }
+	constexpr Pcg32(uint64_t initState, uint64_t streamId) noexcept { seed(initState, streamId); }
+
+	constexpr void seed(uint64_t initState, uint64_t streamId) noexcept
+	{
+		state = 0;
+		increment = (streamId << 1) | 1;
+		(*this)();
+		state += initState;
+		(*this)();
+	}
+
+	static constexpr result_type min() noexcept { return 0; }
+	static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+	constexpr result_type operator()() noexcept
+	{
+		const uint64_t old = state;
+		state = old * MULTIPLIER + increment;
+		const auto xorShifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+		const auto rotation = static_cast<uint32_t>(old >> 59);
+		return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+	}
+
+	// Uniform in [0, range), range > 0, without modulo bias (Lemire 2019):
+	// one multiply per draw, and a division only on the rare rejection path.
+	constexpr uint32_t bounded(uint32_t range) noexcept
+	{
+		uint64_t product = static_cast<uint64_t>((*this)()) * range;
+		auto low = static_cast<uint32_t>(product);
+		if (low < range)
+		{
+			const uint32_t threshold = (0u - range) % range;
+			while (low < threshold)
+			{
+				product = static_cast<uint64_t>((*this)()) * range;
+				low = static_cast<uint32_t>(product);
+			}
+		}
+		return static_cast<uint32_t>(product >> 32);
+	}
+
+	// Raw state, for saving and restoring a generator mid-sequence.
+	[[nodiscard]] constexpr uint64_t get_state() const noexcept { return state; }
+	[[nodiscard]] constexpr uint64_t get_increment() const noexcept { return increment; }
+	constexpr void set_state(uint64_t newState, uint64_t newIncrement) noexcept
+	{
+		state = newState;
+		increment = newIncrement | 1;
+	}
+
+	friend constexpr bool operator==(const Pcg32&, const Pcg32&) noexcept = default;
+
+private:
+	static constexpr uint64_t MULTIPLIER = 6364136223846793005ULL;
+	static constexpr uint64_t DEFAULT_SEED = 0x853c49e6748fea9bULL;
+
+	uint64_t state{ 0 };
+	uint64_t increment{ 1 };
+};
@@ -0,0 +1,178 @@
+// RandomDice.cpp -- seeding, bulk rolls, dice expressions and persistence.
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "../Persistent/BinaryStream.h"
+#include "RandomDice.h"
+
+namespace
+{
+	// SplitMix64 step: spreads a master seed into well-mixed stream seeds,
+	// so seeds 1, 2, 3... do not start their streams in similar states.
+	constexpr uint64_t split_mix(uint64_t value) noexcept
+	{
+		value += 0x9e3779b97f4a7c15ULL;
+		value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+		return value ^ (value >> 31);
+	}
+
+	// Parses a non-negative decimal at the front of text and drops it.
+	std::optional<int> take_number(std::string_view& text)
+	{
+		int value = 0;
+		const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+		if (ec != std::errc{} || value < 0)
+		{
+			return std::nullopt;
+		}
+		text.remove_prefix(static_cast<size_t>(end - text.data()));
+		return value;
+	}
+} // namespace
+
+std::optional<DiceExpr> DiceExpr::parse(std::string_view text)
+{
+	DiceExpr expr{ 1, 0, 0 };
+	if (!text.empty() && text.front() != 'd')
+	{
+		const std::optional<int> num = take_number(text);
+		if (!num)
+		{
+			return std::nullopt;
+		}
+		expr.num = *num;
+	}
+	if (text.empty() || text.front() != 'd')
+	{
+		return std::nullopt;
+	}
+	text.remove_prefix(1);
+
+	const std::optional<int> sides = take_number(text);
+	if (!sides || *sides == 0)
+	{
+		return std::nullopt;
+	}
+	expr.sides = *sides;
+
+	if (!text.empty())
+	{
+		const bool negative = text.front() == '-';
+		if (!negative && text.front() != '+')
+		{
+			return std::nullopt;
+		}
+		text.remove_prefix(1);
+		const std::optional<int> bonus = take_number(text);
+		if (!bonus || !text.empty())
+		{
+			return std::nullopt;
+		}
+		expr.bonus = negative ? -*bonus : *bonus;
+	}
+	return expr;
+}
+
+std::string DiceExpr::to_string() const
+{
+	if (bonus == 0)
+	{
+		return std::format("{}d{}", num, sides);
+	}
+	return std::format("{}d{}{:+}", num, sides, bonus);
+}
+
+void RandomDice::reseed(uint64_t seed) noexcept
+{
+	masterSeed = seed;
+	for (size_t i = 0; i < streams.size(); ++i)
+	{
+		streams[i].seed(split_mix(seed + i), i);
+	}
+}
+
+int RandomDice::roll(RngStream stream, const DiceExpr& expr)
+{
+	if (expr.num == 0)
+	{
+		return 0;
+	}
+
+	int total = 0;
+	for (int i = 0; i < expr.num; ++i)
+	{
+		total += roll(stream, 1, expr.sides);
+	}
+
+	return total + expr.bonus;
+}
+
+void RandomDice::roll_many(RngStream stream, std::span<int> out, int min, int max)
+{
+#ifdef TESTING_MODE
+	if (m_test_mode && !m_fixed_rolls.empty())
+	{
+		for (int& value : out)
+		{
+			value = roll(stream, min, max);
+		}
+		return;
+	}
+#endif
+	if (max <= min)
+	{
+		std::ranges::fill(out, min);
+		return;
+	}
+	// The range is worked out once; each element is one bounded draw.
+	const auto range = static_cast<uint32_t>(static_cast<int64_t>(max) - min + 1);
+	Pcg32& gen = get_rng(stream);
+	for (int& value : out)
+	{
+		const uint32_t offset = range == 0 ? gen() : gen.bounded(range);
+		value = static_cast<int>(static_cast<int64_t>(min) + offset);
+	}
+}
+
+void RandomDice::roll_many(RngStream stream, std::span<int> out, const DiceExpr& expr)
+{
+	for (int& value : out)
+	{
+		value = roll(stream, expr);
+	}
+}
+
+void RandomDice::save(BinaryWriter& out) const
+{
+	out.write_u64(masterSeed);
+	out.write_u32(static_cast<uint32_t>(streams.size()));
+	for (const Pcg32& gen : streams)
+	{
+		out.write_u64(gen.get_state());
+		out.write_u64(gen.get_increment());
+	}
+}
+
+void RandomDice::load(BinaryReader& in)
+{
+	reseed(in.read_u64());
+	// Streams added since the save was written keep their fresh seeding.
+	const uint32_t saved = in.read_u32();
+	for (uint32_t i = 0; i < saved; ++i)
+	{
+		const uint64_t state = in.read_u64();
+		const uint64_t increment = in.read_u64();
+		if (i < streams.size())
+		{
+			streams[i].set_state(state, increment);
+		}
+	}
+}
@@ -1,20 +1,68 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <random>
+#include <span>
+#include <string>
+#include <string_view>
 #include <vector>
 
+#include "Pcg32.h"
+
+class BinaryReader;
+class BinaryWriter;
+
+// Dice expression: roll num dice of sides sides, add bonus. num=0 means skip.
+struct DiceExpr
+{
+	int num{ 0 };
+	int sides{ 0 };
+	int bonus{ 0 };
+
+	// "NdS", "NdS+B", "NdS-B" or "dS"; nullopt when text is anything else.
+	[[nodiscard]] static std::optional<DiceExpr> parse(std::string_view text);
+	[[nodiscard]] std::string to_string() const;
+};
+
+// Independent sequences drawn from one master seed. A subsystem rolling
+// more or less often does not shift what the others roll.
+enum class RngStream : uint8_t
+{
+	GENERAL, // everything not listed below
+	MAPGEN, // level seeds, room picks, spawns
+	AI, // monster decisions
+	COMBAT, // attack and damage rolls
+	LOOT, // item generation and enhancements
+	COUNT // sentinel -- keep last
+};
+
+class DiceStream;
+
 // This class is used to generate random numbers for our game->
 // We want this class to be the only random number generator for the game right now.
+//
+// One Pcg32 per RngStream, all derived from a master seed; the seed and the
+// generators' states go into the save, so a loaded game rolls what the
+// saved one would have.
 class RandomDice
 {
 public:
-	RandomDice() = default;
+	static constexpr size_t STREAM_COUNT = static_cast<size_t>(RngStream::COUNT);
 
-	explicit RandomDice(unsigned int seed) noexcept
-		: m_gen(seed)
+	RandomDice() : RandomDice(std::random_device{}()) {}
+
+	explicit RandomDice(uint64_t seed) noexcept
 	{
+		reseed(seed);
 	}
 
+	// Restarts every stream from seed.
+	void reseed(uint64_t seed) noexcept;
+	[[nodiscard]] uint64_t get_seed() const noexcept { return masterSeed; }
+
 	// public functions to emulate a set of dice from d2 to d100
 	int d2() { return roll(1, 2); }
 	int d4() { return roll(1, 4); }
@@ -27,7 +75,10 @@ public:
 
 	// Deprecated roll_from_string method removed - use DamageInfo::roll_damage() instead
 
-	int roll(int min, int max)
+	// Uniform in [min, max]; min when max <= min.
+	int roll(int min, int max) { return roll(RngStream::GENERAL, min, max); }
+
+	int roll(RngStream stream, int min, int max)
 	{
 #ifdef TESTING_MODE
 		// In test mode, use fixed values if set
@@ -38,12 +89,35 @@ public:
 			return value;
 		}
 #endif
-		std::uniform_int_distribution<int> dist(min, max);
-		return dist(m_gen);
+		if (max <= min)
+		{
+			return min;
+		}
+		const auto range = static_cast<uint32_t>(static_cast<int64_t>(max) - min + 1);
+		Pcg32& gen = get_rng(stream);
+		const uint32_t offset = range == 0 ? gen() : gen.bounded(range); // range wraps to 0 only for the full int span
+		return static_cast<int>(static_cast<int64_t>(min) + offset);
 	}
 
+	// Sum of expr's dice plus its bonus; 0 when expr.num is 0.
+	int roll(const DiceExpr& expr) { return roll(RngStream::GENERAL, expr); }
+	int roll(RngStream stream, const DiceExpr& expr);
+
+	// Fills out with independent rolls in one call.
+	void roll_many(std::span<int> out, int min, int max) { roll_many(RngStream::GENERAL, out, min, max); }
+	void roll_many(RngStream stream, std::span<int> out, int min, int max);
+	void roll_many(std::span<int> out, const DiceExpr& expr) { roll_many(RngStream::GENERAL, out, expr); }
+	void roll_many(RngStream stream, std::span<int> out, const DiceExpr& expr);
+
+	// The named stream as a dice object: ctx.dice->combat().d20().
+	[[nodiscard]] DiceStream stream(RngStream stream) noexcept;
+	[[nodiscard]] DiceStream mapgen() noexcept;
+	[[nodiscard]] DiceStream ai() noexcept;
+	[[nodiscard]] DiceStream combat() noexcept;
+	[[nodiscard]] DiceStream loot() noexcept;
+
 #ifdef TESTING_MODE
-	// Test-only methods for deterministic dice rolls
+	// Test-only methods for deterministic dice rolls; they override every stream.
 	void set_test_mode(bool enabled) { m_test_mode = enabled; }
 	void set_next_d20(int value)
 	{
@@ -58,15 +132,56 @@ public:
 	void clear_fixed_rolls() { m_fixed_rolls.clear(); }
 #endif
 
-	[[nodiscard]] std::mt19937& get_rng() noexcept { return m_gen; }
+	// A UniformRandomBitGenerator for <algorithm> (shuffle, sample).
+	[[nodiscard]] Pcg32& get_rng(RngStream stream = RngStream::GENERAL) noexcept
+	{
+		return streams[static_cast<size_t>(stream)];
+	}
+
+	// Master seed and every stream's position.
+	void save(BinaryWriter& out) const;
+	void load(BinaryReader& in);
 
 private:
-	// we use the mersenne twister engine for our random number generator
-	// we seed it with a random device
-	std::mt19937 m_gen{ std::random_device{}() };
+	uint64_t masterSeed{ 0 };
+	std::array<Pcg32, STREAM_COUNT> streams{};
 
 #ifdef TESTING_MODE
 	bool m_test_mode{ false };
 	std::vector<int> m_fixed_rolls;
 #endif
 };
+
+// One RngStream of a RandomDice, with the same dice interface. Cheap to
+// copy; valid as long as the RandomDice it came from.
+class DiceStream
+{
+public:
+	DiceStream(RandomDice& dice, RngStream stream) noexcept : dice(&dice), id(stream) {}
+
+	int d2() { return roll(1, 2); }
+	int d4() { return roll(1, 4); }
+	int d6() { return roll(1, 6); }
+	int d8() { return roll(1, 8); }
+	int d10() { return roll(1, 10); }
+	int d12() { return roll(1, 12); }
+	int d20() { return roll(1, 20); }
+	int d100() { return roll(1, 100); }
+
+	int roll(int min, int max) { return dice->roll(id, min, max); }
+	int roll(const DiceExpr& expr) { return dice->roll(id, expr); }
+	void roll_many(std::span<int> out, int min, int max) { dice->roll_many(id, out, min, max); }
+	void roll_many(std::span<int> out, const DiceExpr& expr) { dice->roll_many(id, out, expr); }
+
+	[[nodiscard]] Pcg32& get_rng() noexcept { return dice->get_rng(id); }
+
+private:
+	RandomDice* dice;
+	RngStream id;
+};
+
+inline DiceStream RandomDice::stream(RngStream stream) noexcept { return DiceStream{ *this, stream }; }
+inline DiceStream RandomDice::mapgen() noexcept { return stream(RngStream::MAPGEN); }
+inline DiceStream RandomDice::ai() noexcept { return stream(RngStream::AI); }
+inline DiceStream RandomDice::combat() noexcept { return stream(RngStream::COMBAT); }
+inline DiceStream RandomDice::loot() noexcept { return stream(RngStream::LOOT); }
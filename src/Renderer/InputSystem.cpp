@@ -12,6 +12,28 @@ void InputSystem::poll()
 	currentKey = GameKey::NONE;
 	charInput = 0;
 	resized = false;
+	++pollCount;
+
+	if (scripted)
+	{
+		InputEvent event{ .mouse = mouse };
+		if (!script.empty())
+		{
+			event = script.front();
+			script.pop_front();
+		}
+		currentKey = event.key;
+		charInput = event.charInput;
+		mouse = event.mouse;
+		mouseMoved = event.mouseMoved;
+		resized = currentKey == GameKey::WINDOW_RESIZE;
+		return;
+	}
+
+	const ::Vector2 mousePos = GetMousePosition();
+	const ::Vector2 mouseDelta = GetMouseDelta();
+	mouse = Vector2D{ static_cast<int>(mousePos.x), static_cast<int>(mousePos.y) };
+	mouseMoved = mouseDelta.x != 0.0f || mouseDelta.y != 0.0f;
 
 	if (IsWindowResized())
 	{
@@ -102,7 +124,7 @@ void InputSystem::poll()
 		KEY_R, KEY_U, KEY_X, KEY_M, KEY_N,
 		KEY_ONE, KEY_TWO, KEY_THREE, KEY_FOUR, KEY_FIVE,
 		KEY_SIX, KEY_SEVEN, KEY_EIGHT, KEY_NINE, KEY_ZERO,
-		KEY_F2, KEY_F3, KEY_EQUAL, KEY_MINUS, KEY_COMMA, KEY_PERIOD,
+		KEY_F2, KEY_F3, KEY_F9, KEY_F10, KEY_EQUAL, KEY_MINUS, KEY_COMMA, KEY_PERIOD,
 		KEY_SLASH, KEY_SEMICOLON, KEY_APOSTROPHE, KEY_GRAVE })
 	{
 		if (isPressed(k))
@@ -134,7 +156,7 @@ void InputSystem::poll()
 
 	case KEY_TAB:
 	{
-		register_key(KEY_TAB, GameKey::MINIMAP_TOGGLE, 0, false);
+		register_key(KEY_TAB, shift ? GameKey::MINIMAP_RESOLUTION_TOGGLE : GameKey::MINIMAP_TOGGLE, 0, false);
 		return;
 	}
 
@@ -429,6 +451,18 @@ void InputSystem::poll()
 	}
 #endif
 
+	case KEY_F9:
+	{
+		register_key(KEY_F9, GameKey::PROFILER_TOGGLE, 0, false);
+		return;
+	}
+
+	case KEY_F10:
+	{
+		register_key(KEY_F10, GameKey::PROFILER_EXPORT, 0, false);
+		return;
+	}
+
 	case KEY_COMMA:
 	{
 		if (!shift)
@@ -526,6 +560,16 @@ void InputSystem::poll()
 	}
 }
 
+Vector2D InputSystem::pointer() const
+{
+	if (scripted)
+	{
+		return mouse;
+	}
+	const ::Vector2 mousePos = GetMousePosition();
+	return Vector2D{ static_cast<int>(mousePos.x), static_cast<int>(mousePos.y) };
+}
+
 Vector2D InputSystem::get_mouse_tile(int tileSize) const
 {
 	if (tileSize <= 0)
@@ -533,10 +577,10 @@ Vector2D InputSystem::get_mouse_tile(int tileSize) const
 		return Vector2D{ 0, 0 };
 	}
 
-	::Vector2 mousePos = GetMousePosition();
+	const Vector2D mousePos = pointer();
 	return Vector2D{
-		static_cast<int>(mousePos.x) / tileSize,
-		static_cast<int>(mousePos.y) / tileSize
+		mousePos.x / tileSize,
+		mousePos.y / tileSize
 	};
 }
 
@@ -547,10 +591,10 @@ Vector2D InputSystem::get_mouse_world_tile(int camX, int camY, int tileSize) con
 		return Vector2D{ 0, 0 };
 	}
 
-	::Vector2 mouse_pos = GetMousePosition();
+	const Vector2D mouse_pos = pointer();
 	return Vector2D{
-		(static_cast<int>(mouse_pos.x) + camX) / tileSize,
-		(static_cast<int>(mouse_pos.y) + camY) / tileSize
+		(mouse_pos.x + camX) / tileSize,
+		(mouse_pos.y + camY) / tileSize
 	};
 }
 
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <deque>
+
 #include "../Utils/Vector2D.h"
 
 enum class GameKey
@@ -84,7 +87,27 @@ enum class GameKey
 	CONTENT_EDIT_TOGGLE,
 
 	// Minimap overlay
-	MINIMAP_TOGGLE
+	MINIMAP_TOGGLE,
+	MINIMAP_RESOLUTION_TOGGLE,
+
+	// Frame profiler (F9 overlay, F10 export)
+	PROFILER_TOGGLE,
+	PROFILER_EXPORT
+};
+
+// Keep in step with the last GameKey; recordings store keys as bytes.
+inline constexpr GameKey LAST_GAME_KEY = GameKey::PROFILER_EXPORT;
+
+// What one poll() read: the key, the typed character and the mouse in
+// screen pixels, with whether it moved since the frame before.
+struct InputEvent
+{
+	GameKey key{ GameKey::NONE };
+	int charInput{ 0 };
+	Vector2D mouse{};
+	bool mouseMoved{ false };
+
+	friend bool operator==(const InputEvent&, const InputEvent&) = default;
 };
 
 class InputSystem
@@ -93,6 +116,14 @@ private:
 	GameKey currentKey{ GameKey::NONE };
 	int charInput{ 0 };
 	bool resized{ false };
+	Vector2D mouse{};
+	bool mouseMoved{ false };
+	uint64_t pollCount{ 0 };
+
+	// Scripted input (replays, tests): poll() takes the next queued event
+	// instead of reading raylib, and an idle frame when none is queued.
+	bool scripted{ false };
+	std::deque<InputEvent> script;
 
 	// Controlled key-repeat state
 	// Repeatable keys (movement + wait) fire once on press, then again after
@@ -103,6 +134,10 @@ private:
 	double holdStart{ 0.0 };
 	double lastRepeat{ 0.0 };
 
+	// The tile queries also run on frames that did not poll, so they read
+	// the live mouse -- or the scripted one.
+	[[nodiscard]] Vector2D pointer() const;
+
 public:
 	InputSystem() = default;
 	~InputSystem() = default;
@@ -114,8 +149,17 @@ public:
 
 	void poll();
 
+	void set_scripted(bool on) { scripted = on; }
+	void push_event(const InputEvent& event) { script.push_back(event); }
+
 	[[nodiscard]] GameKey get_key() const { return currentKey; }
 	[[nodiscard]] int get_char_input() const { return charInput; }
+	// The mouse as the last poll() saw it -- menus read it here so a replay
+	// can hand them the recorded position.
+	[[nodiscard]] Vector2D get_mouse_position() const { return mouse; }
+	[[nodiscard]] bool mouse_moved() const { return mouseMoved; }
+	[[nodiscard]] InputEvent last_event() const { return InputEvent{ currentKey, charInput, mouse, mouseMoved }; }
+	[[nodiscard]] uint64_t get_poll_count() const { return pollCount; }
 	[[nodiscard]] Vector2D get_mouse_tile(int tileSize) const;
 	[[nodiscard]] Vector2D get_mouse_world_tile(int camX, int camY, int tileSize) const;
 	[[nodiscard]] bool has_player_action() const { return currentKey != GameKey::NONE; }
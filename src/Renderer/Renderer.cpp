@@ -3,7 +3,9 @@
 #include <cassert>
 #include <cmath>
 #include <format>
+#include <span>
 #include <string>
+#include <vector>
 
 #include <raylib.h>
 
@@ -12,6 +14,7 @@
 #include <rlgl.h>
 #endif
 
+#include "../Systems/Profiler.h"
 #include "../Systems/TileConfig.h"
 #include "Renderer.h"
 
@@ -32,20 +35,17 @@ constexpr std::size_t sheet_idx(TileSheet s) noexcept
 }
 
 // DawnLike uses magenta (255,0,255) as the transparency key.
-// Load a PNG, replace magenta pixels with alpha=0, return as Texture2D.
-Texture2D load_dawnlike_texture(std::string_view path)
+// Load a PNG and replace magenta pixels with alpha=0; data is null on failure.
+Image load_dawnlike_image(std::string_view path)
 {
 	std::string path_str(path);
 	Image image = LoadImage(path_str.c_str());
 	if (image.data == nullptr)
 	{
-		return Texture2D{};
+		return Image{};
 	}
 	ImageColorReplace(&image, RL_MAGENTA, Color{ 0, 0, 0, 0 });
-	Texture2D texture = LoadTextureFromImage(image);
-	SetTextureFilter(texture, TEXTURE_FILTER_POINT);
-	UnloadImage(image);
-	return texture;
+	return image;
 }
 
 void Renderer::init()
@@ -95,25 +95,33 @@ void Renderer::init()
 
 void Renderer::update_viewport()
 {
+	if (!initialized)
+	{
+		return;
+	}
+
 	screenWidth = GetScreenWidth();
 	screenHeight = GetScreenHeight();
 	viewportCols = screenWidth / tileSize;
 	viewportRows = screenHeight / tileSize;
 }
 
+void Renderer::set_view_size(int tile, int width, int height)
+{
+	tileSize = tile;
+	fontSize = tileSize * 3 / 4;
+	screenWidth = width;
+	screenHeight = height;
+	viewportCols = tileSize > 0 ? screenWidth / tileSize : 0;
+	viewportRows = tileSize > 0 ? screenHeight / tileSize : 0;
+}
+
 void Renderer::shutdown()
 {
+	atlas.unload();
 	for (SpriteSheet& sheet : sheets)
 	{
-		if (sheet.loaded)
-		{
-			UnloadTexture(sheet.frame0);
-			if (sheet.animated)
-			{
-				UnloadTexture(sheet.frame1);
-			}
-			sheet.loaded = false;
-		}
+		sheet.loaded = false;
 	}
 	sheetsLoaded = false;
 
@@ -129,6 +137,14 @@ void Renderer::shutdown()
 		lightMaskLoaded = false;
 	}
 
+	if (lightTilesLoaded)
+	{
+		UnloadTexture(lightTiles);
+		lightTilesLoaded = false;
+	}
+
+	terrainCache.unload();
+
 	if (initialized)
 	{
 		CloseWindow();
@@ -140,24 +156,59 @@ void Renderer::load_sheet(TileSheet id, std::string_view name, std::string_view
 {
 	auto& s = sheets[sheet_idx(id)];
 	s.name = name;
-	s.frame0 = load_dawnlike_texture(path0);
-	s.frame1 = load_dawnlike_texture(path1);
-	s.tilesPerRow = s.frame0.width / SPRITE_SIZE;
-	s.tilesPerCol = s.frame0.height / SPRITE_SIZE;
-	s.animated = (s.frame1.id > 0);
-	s.loaded = (s.frame0.id > 0);
+	const Image frame0 = load_dawnlike_image(path0);
+	const Image frame1 = load_dawnlike_image(path1);
+	s.tilesPerRow = frame0.width / SPRITE_SIZE;
+	s.tilesPerCol = frame0.height / SPRITE_SIZE;
+	s.animated = (frame1.data != nullptr);
+	s.loaded = (frame0.data != nullptr);
+	stagedFrames.push_back(StagedFrame{ frame0, id, 0 });
+	stagedFrames.push_back(StagedFrame{ frame1, id, 1 });
 }
 
 void Renderer::load_sheet_static(TileSheet id, std::string_view name, std::string_view path)
 {
 	auto& s = sheets[sheet_idx(id)];
 	s.name = name;
-	s.frame0 = load_dawnlike_texture(path);
-	s.frame1 = s.frame0;
-	s.tilesPerRow = s.frame0.width / SPRITE_SIZE;
-	s.tilesPerCol = s.frame0.height / SPRITE_SIZE;
+	const Image frame0 = load_dawnlike_image(path);
+	s.tilesPerRow = frame0.width / SPRITE_SIZE;
+	s.tilesPerCol = frame0.height / SPRITE_SIZE;
 	s.animated = false;
-	s.loaded = (s.frame0.id > 0);
+	s.loaded = (frame0.data != nullptr);
+	stagedFrames.push_back(StagedFrame{ frame0, id, 0 });
+}
+
+// Packs every staged frame into the atlas, points each sheet at its frames
+// and frees the CPU-side images.
+void Renderer::build_atlas()
+{
+	std::vector<Image> images;
+	images.reserve(stagedFrames.size());
+	for (const StagedFrame& staged : stagedFrames)
+	{
+		images.push_back(staged.image);
+	}
+	atlas.build(images);
+
+	for (size_t i = 0; i < stagedFrames.size(); ++i)
+	{
+		SpriteSheet& sheet = sheets[sheet_idx(stagedFrames[i].sheet)];
+		sheet.frames[static_cast<size_t>(stagedFrames[i].frame)] = atlas.rect(i);
+		if (stagedFrames[i].image.data != nullptr)
+		{
+			UnloadImage(stagedFrames[i].image);
+		}
+	}
+	stagedFrames.clear();
+
+	for (SpriteSheet& sheet : sheets)
+	{
+		if (!sheet.animated)
+		{
+			sheet.frames[1] = sheet.frames[0];
+		}
+		sheet.loaded = sheet.loaded && sheet.frames[0].is_valid();
+	}
 }
 
 int Renderer::get_sheet_cols(TileSheet sheet) const
@@ -297,6 +348,7 @@ void Renderer::load_dawnlike(std::string_view basePath)
 	load_static(TileSheet::SHEET_FENCE, "Fence", "Objects/", "Fence");
 	load_animated(TileSheet::SHEET_MAP0, "Map0", "Objects/", "Map");
 
+	build_atlas();
 	sheetsLoaded = true;
 }
 
@@ -318,6 +370,11 @@ void Renderer::add_trauma(float amount)
 
 void Renderer::begin_frame()
 {
+	if (!initialized)
+	{
+		return;
+	}
+
 	// Decay trauma and compute shake offsets
 	shakeTrauma = std::max(0.0f, shakeTrauma - GetFrameTime() * 3.0f);
 	float magnitude = shakeTrauma * shakeTrauma;
@@ -339,12 +396,23 @@ void Renderer::begin_frame()
 		lastAnimToggle = now;
 	}
 
+	lastFrameStats = frameStats;
+	frameStats = RenderStats{};
+	lastTextureId = 0;
+
 	BeginDrawing();
 	ClearBackground(RL_BLACK);
 }
 
 void Renderer::end_frame()
 {
+	if (!initialized)
+	{
+		return;
+	}
+
+	PROFILE_COUNT(ProfileCounter::DRAW_CALLS, frameStats.spriteDraws + frameStats.textDraws);
+
 #ifdef EMSCRIPTEN
 	// EndDrawing's order is: flush -> swap -> WaitTime -> PollInputEvents.
 	// glfwSwapBuffers may yield (emscripten_sleep), so events can fire between
@@ -360,78 +428,179 @@ void Renderer::end_frame()
 #endif
 }
 
-void Renderer::begin_light_mask()
+void Renderer::update_light_mask(std::span<const Color> tileColors, int cols, int rows, int screenX, int screenY)
 {
-	if (!lightMaskLoaded)
+	if (!initialized || cols <= 0 || rows <= 0 || tileColors.size() < static_cast<size_t>(cols) * rows)
 	{
 		return;
 	}
+
+	// The window may have been resized since init.
+	if (!lightMaskLoaded || lightMask.texture.width != screenWidth || lightMask.texture.height != screenHeight)
+	{
+		if (lightMaskLoaded)
+		{
+			UnloadRenderTexture(lightMask);
+		}
+		lightMask = LoadRenderTexture(screenWidth, screenHeight);
+		lightMaskLoaded = (lightMask.id > 0);
+		if (!lightMaskLoaded)
+		{
+			return;
+		}
+	}
+
+	if (!lightTilesLoaded || lightTiles.width != cols || lightTiles.height != rows)
+	{
+		if (lightTilesLoaded)
+		{
+			UnloadTexture(lightTiles);
+		}
+		Image blank = GenImageColor(cols, rows, RL_BLACK);
+		lightTiles = LoadTextureFromImage(blank);
+		UnloadImage(blank);
+		lightTilesLoaded = (lightTiles.id > 0);
+		if (!lightTilesLoaded)
+		{
+			return;
+		}
+		SetTextureFilter(lightTiles, TEXTURE_FILTER_BILINEAR);
+		SetTextureWrap(lightTiles, TEXTURE_WRAP_CLAMP);
+	}
+	UpdateTexture(lightTiles, tileColors.data());
+
+	// Texel centres land on tile centres: each tile keeps its own light at
+	// its centre and blends into its neighbours' toward the edges.
 	BeginTextureMode(lightMask);
 	ClearBackground(RL_BLACK);
+	DrawTexturePro(
+		lightTiles,
+		Rectangle{ 0.0f, 0.0f, static_cast<float>(cols), static_cast<float>(rows) },
+		Rectangle{
+			static_cast<float>(screenX),
+			static_cast<float>(screenY),
+			static_cast<float>(cols * tileSize),
+			static_cast<float>(rows * tileSize) },
+		{ 0.0f, 0.0f },
+		0.0f,
+		RL_WHITE);
+	EndTextureMode();
 }
 
-void Renderer::add_light_quad(int screenX, int screenY, int tileSize, Color tileColor)
+void Renderer::apply_light_mask() const
 {
-	if (!lightMaskLoaded)
+	if (!initialized)
 	{
 		return;
 	}
-	int flippedY = lightMask.texture.height - screenY - tileSize;
-	DrawRectangle(screenX, flippedY, tileSize, tileSize, tileColor);
-}
 
-void Renderer::apply_light_mask()
-{
 	if (!lightMaskLoaded)
 	{
 		return;
 	}
-	EndTextureMode();
+	// Render textures are stored bottom-up; a negative source height flips it.
 	BeginBlendMode(BLEND_MULTIPLIED);
-	DrawTexture(lightMask.texture, 0, 0, RL_WHITE);
+	DrawTextureRec(
+		lightMask.texture,
+		Rectangle{
+			0.0f,
+			0.0f,
+			static_cast<float>(lightMask.texture.width),
+			-static_cast<float>(lightMask.texture.height) },
+		{ 0.0f, 0.0f },
+		RL_WHITE);
 	EndBlendMode();
 }
 
-void Renderer::draw_tile(Vector2D gridPos, TileRef tile, Color tint) const
+void Renderer::begin_world_target(const RenderTexture2D& target, Vector2D worldOrigin)
 {
-	assert(sheetsLoaded);
-	if (!tile.is_valid())
+	savedCamera = camera;
+	savedScreenWidth = screenWidth;
+	savedScreenHeight = screenHeight;
+	camera = worldOrigin;
+	screenWidth = target.texture.width;
+	screenHeight = target.texture.height;
+
+	lastTextureId = 0;
+	BeginTextureMode(target);
+	ClearBackground(Color{ 0, 0, 0, 0 });
+}
+
+void Renderer::end_world_target()
+{
+	EndTextureMode();
+	lastTextureId = 0;
+
+	camera = savedCamera;
+	screenWidth = savedScreenWidth;
+	screenHeight = savedScreenHeight;
+}
+
+void Renderer::draw_world_texture(const Texture2D& texture, Vector2D worldOrigin) const
+{
+	if (!initialized)
 	{
 		return;
 	}
 
-	assert(sheet_idx(tile.sheet) < sheets.size());
-	const SpriteSheet& sheet = sheets[sheet_idx(tile.sheet)];
-	assert(sheet.loaded && sheet.tilesPerRow > 0);
+	note_texture(texture.id);
+	++frameStats.spriteDraws;
 
-	// Screen position with camera offset
-	float destX = static_cast<float>(gridPos.x * tileSize - camera.x);
-	float destY = static_cast<float>(gridPos.y * tileSize - camera.y);
+	// Render textures are stored bottom-up; a negative source height flips it.
+	DrawTextureRec(
+		texture,
+		Rectangle{
+			0.0f,
+			0.0f,
+			static_cast<float>(texture.width),
+			-static_cast<float>(texture.height) },
+		Vector2{
+			static_cast<float>(worldOrigin.x - camera.x),
+			static_cast<float>(worldOrigin.y - camera.y) },
+		RL_WHITE);
+}
 
-	// Cull tiles outside the visible area
-	float tileSizeFloat = static_cast<float>(tileSize);
-	if (destX + tileSizeFloat < 0.0f || destX >= static_cast<float>(screenWidth) ||
-		destY + tileSizeFloat < 0.0f || destY >= static_cast<float>(screenHeight))
+void Renderer::note_texture(unsigned int textureId) const
+{
+	if (textureId != lastTextureId)
+	{
+		++frameStats.textureSwitches;
+		lastTextureId = textureId;
+	}
+}
+
+void Renderer::draw_sprite(TileRef tile, bool animate, Rectangle dest, Color tint) const
+{
+	if (!initialized)
 	{
 		return;
 	}
 
-	const Texture2D& texture = (sheet.animated && currentAnimFrame == 1)
-		? sheet.frame1
-		: sheet.frame0;
+	assert(sheet_idx(tile.sheet) < sheets.size());
+	const SpriteSheet& sheet = sheets[sheet_idx(tile.sheet)];
+	assert(sheet.loaded && sheet.tilesPerRow > 0);
 
-	// Source rect in the 16x16 sprite sheet
+	const bool flips = animate && sheet.animated;
+	const AtlasRect& frame = sheet.frames[(flips && currentAnimFrame == 1) ? 1 : 0];
+	const Texture2D& texture = atlas.page(frame.page);
+	note_texture(texture.id);
+	++frameStats.spriteDraws;
+	frameStats.animatedDraws += flips ? 1 : 0;
+
+	// Source rect of the 16x16 sprite inside the sheet's atlas rectangle
 	Rectangle srcRect = {
-		static_cast<float>(tile.col * SPRITE_SIZE),
-		static_cast<float>(tile.row * SPRITE_SIZE),
+		static_cast<float>(frame.x + tile.col * SPRITE_SIZE),
+		static_cast<float>(frame.y + tile.row * SPRITE_SIZE),
 		static_cast<float>(SPRITE_SIZE),
 		static_cast<float>(SPRITE_SIZE)
 	};
 
-	// Destination rect scaled to display tile size
-	Rectangle destRect = { destX, destY, tileSizeFloat, tileSizeFloat };
+	DrawTexturePro(texture, srcRect, dest, { 0.0f, 0.0f }, 0.0f, tint);
+}
 
-	DrawTexturePro(texture, srcRect, destRect, { 0.0f, 0.0f }, 0.0f, tint);
+void Renderer::draw_tile(Vector2D gridPos, TileRef tile, Color tint) const
+{
+	draw_tile_offset(gridPos, 0, 0, tile, tint);
 }
 
 void Renderer::draw_tile_offset(Vector2D gridPos, int pixelOffsetX, int pixelOffsetY, TileRef tile, Color tint) const
@@ -442,13 +611,11 @@ void Renderer::draw_tile_offset(Vector2D gridPos, int pixelOffsetX, int pixelOff
 		return;
 	}
 
-	assert(sheet_idx(tile.sheet) < sheets.size());
-	const SpriteSheet& sheet = sheets[sheet_idx(tile.sheet)];
-	assert(sheet.loaded && sheet.tilesPerRow > 0);
-
+	// Screen position with camera offset
 	float destX = static_cast<float>(gridPos.x * tileSize - camera.x + pixelOffsetX);
 	float destY = static_cast<float>(gridPos.y * tileSize - camera.y + pixelOffsetY);
 
+	// Cull tiles outside the visible area
 	float tileSizeFloat = static_cast<float>(tileSize);
 	if (destX + tileSizeFloat < 0.0f || destX >= static_cast<float>(screenWidth) ||
 		destY + tileSizeFloat < 0.0f || destY >= static_cast<float>(screenHeight))
@@ -456,20 +623,7 @@ void Renderer::draw_tile_offset(Vector2D gridPos, int pixelOffsetX, int pixelOff
 		return;
 	}
 
-	const Texture2D& texture = (sheet.animated && currentAnimFrame == 1)
-		? sheet.frame1
-		: sheet.frame0;
-
-	Rectangle srcRect = {
-		static_cast<float>(tile.col * SPRITE_SIZE),
-		static_cast<float>(tile.row * SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE)
-	};
-
-	Rectangle destRect = { destX, destY, tileSizeFloat, tileSizeFloat };
-
-	DrawTexturePro(texture, srcRect, destRect, { 0.0f, 0.0f }, 0.0f, tint);
+	draw_sprite(tile, true, Rectangle{ destX, destY, tileSizeFloat, tileSizeFloat }, tint);
 }
 
 void Renderer::draw_tile_static(Vector2D gridPos, TileRef tile, Color tint) const
@@ -480,10 +634,6 @@ void Renderer::draw_tile_static(Vector2D gridPos, TileRef tile, Color tint) cons
 		return;
 	}
 
-	assert(sheet_idx(tile.sheet) < sheets.size());
-	const SpriteSheet& sheet = sheets[sheet_idx(tile.sheet)];
-	assert(sheet.loaded && sheet.tilesPerRow > 0);
-
 	float destX = static_cast<float>(gridPos.x * tileSize - camera.x);
 	float destY = static_cast<float>(gridPos.y * tileSize - camera.y);
 
@@ -494,84 +644,17 @@ void Renderer::draw_tile_static(Vector2D gridPos, TileRef tile, Color tint) cons
 		return;
 	}
 
-	Rectangle srcRect = {
-		static_cast<float>(tile.col * SPRITE_SIZE),
-		static_cast<float>(tile.row * SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE)
-	};
-
-	Rectangle destRect = { destX, destY, tileSizeFloat, tileSizeFloat };
-
-	DrawTexturePro(sheet.frame0, srcRect, destRect, { 0.0f, 0.0f }, 0.0f, tint);
+	draw_sprite(tile, false, Rectangle{ destX, destY, tileSizeFloat, tileSizeFloat }, tint);
 }
 
 void Renderer::draw_tile_screen(Vector2D screenPos, TileRef tile) const
 {
-	assert(sheetsLoaded);
-	if (!tile.is_valid())
-	{
-		return;
-	}
-
-	assert(sheet_idx(tile.sheet) < sheets.size());
-	const SpriteSheet& sheet = sheets[sheet_idx(tile.sheet)];
-	assert(sheet.loaded && sheet.tilesPerRow > 0);
-
-	const Texture2D& texture = (sheet.animated && currentAnimFrame == 1)
-		? sheet.frame1
-		: sheet.frame0;
-
-	Rectangle srcRect = {
-		static_cast<float>(tile.col * SPRITE_SIZE),
-		static_cast<float>(tile.row * SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE)
-	};
-
-	float tileSizeFloat = static_cast<float>(tileSize);
-	Rectangle destRect = {
-		static_cast<float>(screenPos.x),
-		static_cast<float>(screenPos.y),
-		tileSizeFloat,
-		tileSizeFloat
-	};
-
-	DrawTexturePro(texture, srcRect, destRect, { 0.0f, 0.0f }, 0.0f, RL_WHITE);
+	draw_tile_screen_color_sized(screenPos, tileSize, tile, RL_WHITE);
 }
 
 void Renderer::draw_tile_screen_color(Vector2D screenPos, TileRef tile, Color tint) const
 {
-	assert(sheetsLoaded);
-	if (!tile.is_valid())
-	{
-		return;
-	}
-
-	assert(sheet_idx(tile.sheet) < sheets.size());
-	const SpriteSheet& sheet = sheets[sheet_idx(tile.sheet)];
-	assert(sheet.loaded && sheet.tilesPerRow > 0);
-
-	const Texture2D& texture = (sheet.animated && currentAnimFrame == 1)
-		? sheet.frame1
-		: sheet.frame0;
-
-	Rectangle srcRect = {
-		static_cast<float>(tile.col * SPRITE_SIZE),
-		static_cast<float>(tile.row * SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE)
-	};
-
-	float tileSizeFloat = static_cast<float>(tileSize);
-	Rectangle destRect = {
-		static_cast<float>(screenPos.x),
-		static_cast<float>(screenPos.y),
-		tileSizeFloat,
-		tileSizeFloat
-	};
-
-	DrawTexturePro(texture, srcRect, destRect, { 0.0f, 0.0f }, 0.0f, tint);
+	draw_tile_screen_color_sized(screenPos, tileSize, tile, tint);
 }
 
 void Renderer::draw_tile_screen_color_sized(Vector2D screenPos, int size, TileRef tile, Color tint) const
@@ -582,21 +665,6 @@ void Renderer::draw_tile_screen_color_sized(Vector2D screenPos, int size, TileRe
 		return;
 	}
 
-	assert(sheet_idx(tile.sheet) < sheets.size());
-	const SpriteSheet& sheet = sheets[sheet_idx(tile.sheet)];
-	assert(sheet.loaded && sheet.tilesPerRow > 0);
-
-	const Texture2D& texture = (sheet.animated && currentAnimFrame == 1)
-		? sheet.frame1
-		: sheet.frame0;
-
-	Rectangle srcRect = {
-		static_cast<float>(tile.col * SPRITE_SIZE),
-		static_cast<float>(tile.row * SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE)
-	};
-
 	float sizeFloat = static_cast<float>(size);
 	Rectangle destRect = {
 		static_cast<float>(screenPos.x),
@@ -605,50 +673,28 @@ void Renderer::draw_tile_screen_color_sized(Vector2D screenPos, int size, TileRe
 		sizeFloat
 	};
 
-	DrawTexturePro(texture, srcRect, destRect, { 0.0f, 0.0f }, 0.0f, tint);
+	draw_sprite(tile, true, destRect, tint);
 }
 
 void Renderer::draw_tile_screen_sized(Vector2D screenPos, TileRef tile, int displaySize) const
 {
-	assert(sheetsLoaded);
-	if (!tile.is_valid())
-	{
-		return;
-	}
-
-	assert(sheet_idx(tile.sheet) < sheets.size());
-	const SpriteSheet& sheet = sheets[sheet_idx(tile.sheet)];
-	assert(sheet.loaded && sheet.tilesPerRow > 0);
-
-	const Texture2D& texture = (sheet.animated && currentAnimFrame == 1)
-		? sheet.frame1
-		: sheet.frame0;
-
-	Rectangle srcRect = {
-		static_cast<float>(tile.col * SPRITE_SIZE),
-		static_cast<float>(tile.row * SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE),
-		static_cast<float>(SPRITE_SIZE)
-	};
-
-	float displaySizeFloat = static_cast<float>(displaySize);
-	Rectangle destRect = {
-		static_cast<float>(screenPos.x),
-		static_cast<float>(screenPos.y),
-		displaySizeFloat,
-		displaySizeFloat
-	};
-
-	DrawTexturePro(texture, srcRect, destRect, { 0.0f, 0.0f }, 0.0f, RL_WHITE);
+	draw_tile_screen_color_sized(screenPos, displaySize, tile, RL_WHITE);
 }
 
 void Renderer::draw_text(Vector2D screenPos, std::string_view text, int colorPairId) const
 {
+	if (!initialized)
+	{
+		return;
+	}
+
 	ColorPair pair = get_color_pair(colorPairId);
 	std::string textStr(text);
 
+	++frameStats.textDraws;
 	if (fontLoaded)
 	{
+		note_texture(gameFont.texture.id);
 		Vector2 pos = { static_cast<float>(screenPos.x), static_cast<float>(screenPos.y) };
 		DrawTextEx(gameFont, textStr.c_str(), pos, static_cast<float>(fontSize), 1.0f, pair.fg);
 	}
@@ -660,10 +706,17 @@ void Renderer::draw_text(Vector2D screenPos, std::string_view text, int colorPai
 
 void Renderer::draw_text_color(Vector2D screenPos, std::string_view text, Color color) const
 {
+	if (!initialized)
+	{
+		return;
+	}
+
 	std::string textStr(text);
 
+	++frameStats.textDraws;
 	if (fontLoaded)
 	{
+		note_texture(gameFont.texture.id);
 		Vector2 pos = { static_cast<float>(screenPos.x), static_cast<float>(screenPos.y) };
 		DrawTextEx(gameFont, textStr.c_str(), pos, static_cast<float>(fontSize), 1.0f, color);
 	}
@@ -705,6 +758,11 @@ void Renderer::zoom_out()
 
 void Renderer::draw_frame(Vector2D screenPos, int wTiles, int hTiles, const TileConfig& tileConfig) const
 {
+	if (!initialized)
+	{
+		return;
+	}
+
 	assert(sheetsLoaded && "Renderer::draw_frame called before sheets are loaded");
 
 	DrawRectangle(screenPos.x, screenPos.y, wTiles * tileSize, hTiles * tileSize, Color{ 8, 8, 16, 255 });
@@ -735,6 +793,11 @@ void Renderer::draw_frame(Vector2D screenPos, int wTiles, int hTiles, const Tile
 
 void Renderer::draw_bar(Vector2D screenPos, int w, int h, float ratio, Color filled, Color empty) const
 {
+	if (!initialized)
+	{
+		return;
+	}
+
 	DrawRectangle(screenPos.x, screenPos.y, w, h, empty);
 
 	int filledW = static_cast<int>(static_cast<float>(w) * ratio);
@@ -784,6 +847,10 @@ ScreenMetrics Renderer::metrics() const
 
 int Renderer::measure_text(std::string_view text) const
 {
+	if (!initialized)
+	{
+		return static_cast<int>(text.size()) * fontSize / 2; // no font to measure with
+	}
 	std::string text_str(text);
 	if (fontLoaded)
 	{
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <array>
+#include <span>
 #include <string_view>
+#include <vector>
 
 #include <raylib.h>
 
 #include "../Utils/Vector2D.h"
+#include "SpriteAtlas.h"
+#include "TerrainCache.h"
 
 class TileConfig;
 
@@ -126,10 +130,10 @@ struct ColorPair
 };
 
 // Holds one DawnLike sprite sheet (optionally two frames for animation).
+// Both frames live in the sprite atlas; static sheets repeat frame 0.
 struct SpriteSheet
 {
-	Texture2D frame0{};
-	Texture2D frame1{};
+	std::array<AtlasRect, 2> frames{};
 	int tilesPerRow{ 0 };
 	int tilesPerCol{ 0 };
 	bool animated{ false };
@@ -137,6 +141,16 @@ struct SpriteSheet
 	std::string_view name{};
 };
 
+// Sprite and text draws issued through Renderer in one frame. Every texture
+// switch between consecutive draws ends a raylib batch (one draw call).
+struct RenderStats
+{
+	int spriteDraws{ 0 };
+	int textDraws{ 0 };
+	int textureSwitches{ 0 };
+	int animatedDraws{ 0 }; // sprites that change with the animation frame
+};
+
 class Renderer
 {
 	bool initialized{ false };
@@ -154,9 +168,31 @@ class Renderer
 
 	RenderTexture2D lightMask{};
 	bool lightMaskLoaded{ false };
+	Texture2D lightTiles{}; // one texel per lit tile, upscaled into lightMask
+	bool lightTilesLoaded{ false };
+
+	TerrainCache terrainCache;
+	// View saved by begin_world_target, restored by end_world_target.
+	Vector2D savedCamera{};
+	int savedScreenWidth{ 0 };
+	int savedScreenHeight{ 0 };
 
 	std::array<SpriteSheet, static_cast<std::size_t>(TileSheet::COUNT)> sheets{};
 	bool sheetsLoaded{ false };
+	SpriteAtlas atlas;
+
+	// Sheet frames decoded by load_sheet*, packed by build_atlas.
+	struct StagedFrame
+	{
+		Image image{};
+		TileSheet sheet{};
+		int frame{ 0 };
+	};
+	std::vector<StagedFrame> stagedFrames;
+
+	mutable RenderStats frameStats{};
+	mutable unsigned int lastTextureId{ 0 };
+	RenderStats lastFrameStats{};
 
 	Font gameFont{};
 	bool fontLoaded{ false };
@@ -170,6 +206,11 @@ class Renderer
 	void init_color_pairs();
 	void load_sheet(TileSheet id, std::string_view name, std::string_view path0, std::string_view path1);
 	void load_sheet_static(TileSheet id, std::string_view name, std::string_view path);
+	void build_atlas();
+
+	// Draws one sprite from the atlas -- the shared tail of every draw_tile*.
+	void draw_sprite(TileRef tile, bool animate, Rectangle dest, Color tint) const;
+	void note_texture(unsigned int textureId) const;
 
 public:
 	Renderer() = default;
@@ -183,6 +224,11 @@ public:
 	void init();
 	void shutdown();
 
+	// Until init opens the window every draw is dropped and text is measured
+	// at an estimated width, so menus can run windowless (replays, tests).
+	// set_view_size gives such a run the layout a recorded window had.
+	void set_view_size(int tile, int width, int height);
+
 	void load_dawnlike(std::string_view basePath);
 	void load_font(std::string_view fontPath, int size);
 
@@ -219,10 +265,22 @@ public:
 	// Screen shake: add trauma [0..1]. Decays automatically each frame.
 	void add_trauma(float amount);
 
-	// Dynamic lighting: fill darkness then punch light cones, multiply onto screen.
-	void begin_light_mask();
-	void add_light_quad(int screenX, int screenY, int tileSize, Color tileColor);
-	void apply_light_mask();
+	// Dynamic lighting. update_light_mask uploads one colour per tile (cols x
+	// rows, row-major, texel 0 at screen pixel screenX/screenY) and redraws
+	// the screen-sized mask from it in a single bilinear-filtered quad;
+	// apply_light_mask multiplies the last mask onto the screen. Callers
+	// update only when the lit tiles or the view moved.
+	void update_light_mask(std::span<const Color> tileColors, int cols, int rows, int screenX, int screenY);
+	void apply_light_mask() const;
+
+	// Offscreen world drawing. Between begin_world_target and
+	// end_world_target, world-space draws land in target with world pixel
+	// worldOrigin at its top-left (culled to the target instead of the
+	// screen). draw_world_texture blits such a target back at worldOrigin.
+	void begin_world_target(const RenderTexture2D& target, Vector2D worldOrigin);
+	void end_world_target();
+	void draw_world_texture(const Texture2D& texture, Vector2D worldOrigin) const;
+	[[nodiscard]] TerrainCache& get_terrain_cache() { return terrainCache; }
 
 	[[nodiscard]] ColorPair get_color_pair(int id) const;
 	[[nodiscard]] ScreenMetrics metrics() const;
@@ -231,6 +289,7 @@ public:
 	[[nodiscard]] bool is_initialized() const { return initialized; }
 	[[nodiscard]] int get_tile_size() const { return tileSize; }
 	[[nodiscard]] int get_font_size() const { return fontSize; }
+	[[nodiscard]] int get_anim_frame() const { return currentAnimFrame; }
 	[[nodiscard]] int get_viewport_cols() const { return viewportCols; }
 	[[nodiscard]] int get_viewport_rows() const { return viewportRows; }
 	[[nodiscard]] int get_screen_width() const { return screenWidth; }
@@ -242,5 +301,8 @@ public:
 	[[nodiscard]] bool sheet_is_loaded(TileSheet sheet) const;
 	[[nodiscard]] std::string_view get_sheet_name(TileSheet sheet) const;
 	[[nodiscard]] int get_loaded_sheet_count() const;
+	[[nodiscard]] int get_atlas_page_count() const { return atlas.page_count(); }
+	[[nodiscard]] const RenderStats& get_last_frame_stats() const { return lastFrameStats; }
+	[[nodiscard]] const RenderStats& get_frame_stats() const { return frameStats; } // so far this frame
 
 };
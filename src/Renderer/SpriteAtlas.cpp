@@ -0,0 +1,120 @@
+// SpriteAtlas.cpp -- shelf packing and page upload for the sprite atlas.
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include <raylib.h>
+
+#include "../Utils/Vector2D.h"
+#include "SpriteAtlas.h"
+
+std::vector<AtlasRect> SpriteAtlas::pack(std::span<const Vector2D> sizes, int pageSize, int gutter)
+{
+	std::vector<AtlasRect> placed(sizes.size());
+
+	std::vector<size_t> order(sizes.size());
+	std::iota(order.begin(), order.end(), size_t{ 0 });
+	std::ranges::stable_sort(order, [&](size_t a, size_t b)
+		{ return sizes[a].y > sizes[b].y; });
+
+	int page = 0;
+	int shelfX = 0;
+	int shelfY = 0;
+	int shelfHeight = 0;
+	for (size_t index : order)
+	{
+		const Vector2D size = sizes[index];
+		if (size.x <= 0 || size.y <= 0 || size.x > pageSize || size.y > pageSize)
+		{
+			continue;
+		}
+
+		if (shelfX + size.x > pageSize)
+		{
+			shelfY += shelfHeight + gutter;
+			shelfX = 0;
+			shelfHeight = 0;
+		}
+		if (shelfY + size.y > pageSize)
+		{
+			++page;
+			shelfX = 0;
+			shelfY = 0;
+			shelfHeight = 0;
+		}
+
+		placed[index] = AtlasRect{ page, shelfX, shelfY, size.x, size.y };
+		shelfX += size.x + gutter;
+		shelfHeight = std::max(shelfHeight, size.y);
+	}
+	return placed;
+}
+
+void SpriteAtlas::build(std::span<const Image> images)
+{
+	unload();
+
+	std::vector<Vector2D> sizes;
+	sizes.reserve(images.size());
+	for (const Image& image : images)
+	{
+		sizes.push_back(image.data ? Vector2D{ image.width, image.height } : Vector2D{ 0, 0 });
+	}
+	rects = pack(sizes, PAGE_SIZE, GUTTER);
+
+	int pageCount = 0;
+	for (const AtlasRect& r : rects)
+	{
+		pageCount = std::max(pageCount, r.page + 1);
+	}
+
+	for (int p = 0; p < pageCount; ++p)
+	{
+		// Trim the page to the rows actually used.
+		int usedHeight = 1;
+		for (const AtlasRect& r : rects)
+		{
+			if (r.page == p)
+			{
+				usedHeight = std::max(usedHeight, r.y + r.height);
+			}
+		}
+
+		Image canvas = GenImageColor(PAGE_SIZE, usedHeight, Color{ 0, 0, 0, 0 });
+		for (size_t i = 0; i < rects.size(); ++i)
+		{
+			const AtlasRect& r = rects[i];
+			if (r.page != p)
+			{
+				continue;
+			}
+			const Rectangle source{ 0.0f, 0.0f, static_cast<float>(r.width), static_cast<float>(r.height) };
+			const Rectangle dest{
+				static_cast<float>(r.x),
+				static_cast<float>(r.y),
+				static_cast<float>(r.width),
+				static_cast<float>(r.height) };
+			ImageDraw(&canvas, images[i], source, dest, Color{ 255, 255, 255, 255 });
+		}
+
+		Texture2D texture = LoadTextureFromImage(canvas);
+		UnloadImage(canvas);
+		SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+		SetTextureWrap(texture, TEXTURE_WRAP_CLAMP);
+		pages.push_back(texture);
+	}
+}
+
+void SpriteAtlas::unload()
+{
+	for (const Texture2D& texture : pages)
+	{
+		if (texture.id > 0)
+		{
+			UnloadTexture(texture);
+		}
+	}
+	pages.clear();
+	rects.clear();
+}
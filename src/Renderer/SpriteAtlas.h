@@ -0,0 +1,63 @@
+#pragma once
+// SpriteAtlas.h -- packs many sprite sheet images into a few large textures.
+
+#include <span>
+#include <vector>
+
+#include <raylib.h>
+
+#include "../Utils/Vector2D.h"
+
+// Where one packed image landed: atlas page and pixel rectangle on it.
+struct AtlasRect
+{
+	int page{ -1 };
+	int x{ 0 };
+	int y{ 0 };
+	int width{ 0 };
+	int height{ 0 };
+
+	[[nodiscard]] bool is_valid() const noexcept { return page >= 0; }
+};
+
+// ---------------------------------------------------------------------------
+// SpriteAtlas -- the DawnLike sheets (both animation frames) on one or a few
+// pages, so consecutive sprite draws share a texture and raylib's batcher
+// does not flush on every sheet switch.
+//
+// pack() is a shelf packer: tallest images first, left to right, a new shelf
+// when a row is full and a new page when a page is. The sheets are all a
+// few hundred pixels on a side, so this wastes little and runs once at
+// startup. Images are separated by a transparent gutter so scaled sprites at
+// a sheet edge cannot sample the neighbouring sheet.
+// ---------------------------------------------------------------------------
+class SpriteAtlas
+{
+public:
+	static constexpr int PAGE_SIZE = 2048; // safe texture size on GL ES 2 / WebGL
+	static constexpr int GUTTER = 2;
+
+	SpriteAtlas() = default;
+	~SpriteAtlas() = default;
+
+	SpriteAtlas(const SpriteAtlas&) = delete;
+	SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+	// One rect per size, in input order. Sizes larger than a page get an
+	// invalid rect.
+	[[nodiscard]] static std::vector<AtlasRect> pack(std::span<const Vector2D> sizes, int pageSize, int gutter);
+
+	// Packs the images (unchanged, still owned by the caller) and uploads
+	// the pages. rect(i) is where images[i] landed; images without data get
+	// an invalid rect. Replaces any previous build.
+	void build(std::span<const Image> images);
+	void unload();
+
+	[[nodiscard]] const AtlasRect& rect(size_t imageIndex) const { return rects[imageIndex]; }
+	[[nodiscard]] const Texture2D& page(int index) const { return pages[static_cast<size_t>(index)]; }
+	[[nodiscard]] int page_count() const noexcept { return static_cast<int>(pages.size()); }
+
+private:
+	std::vector<AtlasRect> rects;
+	std::vector<Texture2D> pages;
+};
@@ -0,0 +1,74 @@
+// TerrainCache.cpp -- render texture bookkeeping for cached terrain chunks.
+#include <cstddef>
+
+#include <raylib.h>
+
+#include "TerrainCache.h"
+
+void TerrainCache::resize(size_t chunkCount)
+{
+	if (chunkCount == chunks.size())
+	{
+		return;
+	}
+	unload();
+	chunks.resize(chunkCount);
+}
+
+const RenderTexture2D* TerrainCache::find(size_t index, const TerrainChunkKey& key) const
+{
+	const Chunk& chunk = chunks[index];
+	return (chunk.loaded && chunk.key == key) ? &chunk.target : nullptr;
+}
+
+const RenderTexture2D& TerrainCache::prepare(size_t index, const TerrainChunkKey& key, int width, int height)
+{
+	Chunk& chunk = chunks[index];
+	if (chunk.loaded && (chunk.target.texture.width != width || chunk.target.texture.height != height))
+	{
+		release(index);
+	}
+	if (!chunk.loaded)
+	{
+		chunk.target = LoadRenderTexture(width, height);
+		SetTextureFilter(chunk.target.texture, TEXTURE_FILTER_POINT);
+		chunk.loaded = true;
+	}
+	chunk.key = key;
+	++redraws;
+	return chunk.target;
+}
+
+void TerrainCache::mark_animated(size_t index, bool animated, int animFrame) noexcept
+{
+	Chunk& chunk = chunks[index];
+	chunk.animated = animated;
+	chunk.key.animFrame = animated ? animFrame : TerrainChunkKey::STATIC_FRAME;
+}
+
+void TerrainCache::release(size_t index)
+{
+	Chunk& chunk = chunks[index];
+	if (chunk.loaded)
+	{
+		UnloadRenderTexture(chunk.target);
+	}
+	chunk = Chunk{};
+}
+
+void TerrainCache::invalidate() noexcept
+{
+	for (Chunk& chunk : chunks)
+	{
+		chunk.key = TerrainChunkKey{};
+	}
+}
+
+void TerrainCache::unload()
+{
+	for (size_t i = 0; i < chunks.size(); ++i)
+	{
+		release(i);
+	}
+	chunks.clear();
+}
@@ -0,0 +1,78 @@
+#pragma once
+// TerrainCache.h -- render textures holding pre-drawn chunks of map terrain.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <raylib.h>
+
+// What a cached chunk was drawn for. The terrain version comes from the map
+// (Map::get_terrain_version); tile size and animation frame from Renderer.
+// A chunk without animated sprites uses STATIC_FRAME, so flipping the
+// animation frame leaves it cached.
+struct TerrainChunkKey
+{
+	static constexpr int STATIC_FRAME = -2;
+
+	uint64_t terrainVersion{ 0 };
+	int tileSize{ 0 };
+	int animFrame{ -1 };
+
+	bool operator==(const TerrainChunkKey&) const = default;
+};
+
+// ---------------------------------------------------------------------------
+// TerrainCache -- one render texture per map chunk, redrawn only when the
+// chunk's key changes. The map decides what a chunk contains and when it is
+// stale; this class only owns the textures and remembers what each one was
+// drawn for. Chunks scrolled out of view are released by the caller so the
+// textures in use stay proportional to the viewport, not the map.
+// ---------------------------------------------------------------------------
+class TerrainCache
+{
+public:
+	TerrainCache() = default;
+	~TerrainCache() = default;
+
+	TerrainCache(const TerrainCache&) = delete;
+	TerrainCache& operator=(const TerrainCache&) = delete;
+
+	// Sets the number of chunks; a different count releases every texture.
+	void resize(size_t chunkCount);
+	[[nodiscard]] size_t size() const noexcept { return chunks.size(); }
+
+	// The chunk's texture if it was last drawn for key, else nullptr.
+	[[nodiscard]] const RenderTexture2D* find(size_t index, const TerrainChunkKey& key) const;
+
+	// A width x height texture for the chunk, recorded as drawn for key; the
+	// caller draws the chunk into it before the next find().
+	const RenderTexture2D& prepare(size_t index, const TerrainChunkKey& key, int width, int height);
+
+	// Whether the chunk drew animated sprites when it was last drawn.
+	[[nodiscard]] bool is_animated(size_t index) const noexcept { return chunks[index].animated; }
+
+	// Called after drawing a prepared chunk: records whether it drew animated
+	// sprites and keys it on animFrame only if it did.
+	void mark_animated(size_t index, bool animated, int animFrame) noexcept;
+
+	void release(size_t index);
+	void invalidate() noexcept; // forget every key, keep the textures
+	void unload();
+
+	// Chunks redrawn since the last reset (debug statistics).
+	[[nodiscard]] int get_redraw_count() const noexcept { return redraws; }
+	void reset_redraw_count() noexcept { redraws = 0; }
+
+private:
+	struct Chunk
+	{
+		RenderTexture2D target{};
+		bool loaded{ false };
+		bool animated{ false };
+		TerrainChunkKey key{};
+	};
+
+	std::vector<Chunk> chunks;
+	int redraws{ 0 };
+};
@@ -0,0 +1,116 @@
+// AutosaveWorker.cpp -- background writer for the two autosave slots.
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include "../Persistent/SaveFile.h"
+#include "AutosaveWorker.h"
+#include "Logger.h"
+
+AutosaveWorker::AutosaveWorker(std::array<std::filesystem::path, SLOT_COUNT> slotPaths)
+	: slots(std::move(slotPaths))
+{
+	// Start with the older slot so the newest existing autosave survives.
+	std::error_code ec;
+	const auto first = std::filesystem::last_write_time(slots[0], ec);
+	const bool haveFirst = !ec;
+	const auto second = std::filesystem::last_write_time(slots[1], ec);
+	const bool haveSecond = !ec;
+	nextSlot = (haveFirst && (!haveSecond || second < first)) ? 1 : 0;
+
+#ifndef EMSCRIPTEN
+	thread = std::thread([this] { run(); });
+#endif
+}
+
+AutosaveWorker::~AutosaveWorker()
+{
+	{
+		std::lock_guard lock(mutex);
+		stopping = true;
+	}
+	wake.notify_one();
+	if (thread.joinable())
+	{
+		thread.join(); // a queued snapshot is still written first
+	}
+}
+
+void AutosaveWorker::submit(SaveSnapshot snapshot)
+{
+#ifdef EMSCRIPTEN
+	write(snapshot);
+	++completed;
+#else
+	{
+		std::lock_guard lock(mutex);
+		pending = std::move(snapshot);
+	}
+	wake.notify_one();
+#endif
+}
+
+void AutosaveWorker::wait_idle()
+{
+	std::unique_lock lock(mutex);
+	idle.wait(lock, [this] { return !pending && !writing; });
+}
+
+void AutosaveWorker::cancel()
+{
+	std::unique_lock lock(mutex);
+	pending.reset();
+	idle.wait(lock, [this] { return !writing; });
+}
+
+int AutosaveWorker::get_completed_count() const
+{
+	std::lock_guard lock(mutex);
+	return completed;
+}
+
+void AutosaveWorker::run()
+{
+	std::unique_lock lock(mutex);
+	for (;;)
+	{
+		wake.wait(lock, [this] { return pending || stopping; });
+		if (!pending)
+		{
+			return; // stopping with nothing left to write
+		}
+
+		SaveSnapshot snapshot = std::move(*pending);
+		pending.reset();
+		writing = true;
+		lock.unlock();
+
+		write(snapshot);
+
+		lock.lock();
+		writing = false;
+		++completed;
+		idle.notify_all();
+	}
+}
+
+void AutosaveWorker::write(const SaveSnapshot& snapshot)
+{
+	try
+	{
+		snapshot.write_file(slots[nextSlot]);
+		nextSlot = (nextSlot + 1) % SLOT_COUNT;
+	}
+	catch (const std::exception& e)
+	{
+		// The slot keeps its previous contents; try the same slot next time.
+		Logger::instance().print<LogLevel::LOG_ERROR>("Autosave failed: {}", e.what());
+	}
+}
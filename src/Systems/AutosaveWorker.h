@@ -0,0 +1,63 @@
+#pragma once
+// AutosaveWorker.h -- writes captured save snapshots on a background thread.
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "../Persistent/SaveFile.h"
+
+// ---------------------------------------------------------------------------
+// AutosaveWorker -- owns the autosave slots and the thread that fills them.
+//
+// The game thread captures a SaveSnapshot (sections serialised to memory)
+// and hands it over; compression, file I/O and the temp-file rename happen
+// here. Writes alternate between two slot files, always replacing the
+// older one, so a crash or power loss mid-write can only lose the slot
+// being written: the other still holds the previous complete autosave.
+// A snapshot submitted while another is still waiting replaces it; only
+// the newest state is worth writing. Without threads (Emscripten) submit
+// writes synchronously.
+// ---------------------------------------------------------------------------
+class AutosaveWorker
+{
+public:
+	static constexpr size_t SLOT_COUNT = 2;
+
+	explicit AutosaveWorker(std::array<std::filesystem::path, SLOT_COUNT> slotPaths);
+	~AutosaveWorker();
+
+	AutosaveWorker(const AutosaveWorker&) = delete;
+	AutosaveWorker& operator=(const AutosaveWorker&) = delete;
+
+	void submit(SaveSnapshot snapshot);
+
+	// Blocks until nothing is queued or being written.
+	void wait_idle();
+
+	// Drops a queued snapshot and waits for a write in progress to finish.
+	void cancel();
+
+	[[nodiscard]] int get_completed_count() const;
+
+	[[nodiscard]] const std::array<std::filesystem::path, SLOT_COUNT>& get_slot_paths() const noexcept { return slots; }
+
+private:
+	void run();
+	void write(const SaveSnapshot& snapshot);
+
+	const std::array<std::filesystem::path, SLOT_COUNT> slots;
+	mutable std::mutex mutex;
+	std::condition_variable wake; // worker: a snapshot was queued, or stop
+	std::condition_variable idle; // waiters: the worker finished a write
+	std::optional<SaveSnapshot> pending;
+	bool writing{ false };
+	bool stopping{ false };
+	int completed{ 0 };
+	size_t nextSlot{ 0 }; // touched only by whoever writes (worker, or submit without threads)
+	std::thread thread;
+};
@@ -3,6 +3,7 @@
 #include <memory>
 #include <span>
 #include <stdexcept>
+#include <unordered_set>
 #include <vector>
 
 #include "../Actor/Creature.h"
@@ -15,19 +16,37 @@
 
 void CreatureManager::update_creatures(std::span<std::unique_ptr<Creature>> creatures, GameContext& ctx)
 {
+	// Batch every monster's FOV before anyone acts; later queries for a
+	// creature that moved this turn recompute just that one.
+	if (ctx.map)
+	{
+		ctx.map->refresh_creature_fov(creatures);
+	}
+
 	for (const auto& creature : creatures)
 	{
 		assert(creature);
 		creature->update(ctx);
 	}
+
+	assert(verify_occupancy(creatures));
 }
 
 void CreatureManager::cleanup_dead_creatures(std::vector<std::unique_ptr<Creature>>& creatures)
 {
 	// Remove dead creatures from the game
 	// This is called at safe points to avoid dangling references during combat
-	std::erase_if(creatures, [](const auto& creature)
+	const size_t removed = std::erase_if(creatures, [](const auto& creature)
 		{ return creature && creature->is_dead(); });
+
+	// Freed creatures may still sit in a slot (e.g. the tile they died on was
+	// never reclaimed); reindex so no slot can dangle.
+	if (removed > 0 && occupancy.is_bound())
+	{
+		rebuild_occupancy(creatures);
+	}
+
+	assert(verify_occupancy(creatures));
 }
 
 void CreatureManager::spawn_creatures(GameContext& ctx)
@@ -72,17 +91,122 @@ Creature* CreatureManager::get_actor_at_position(
 	std::span<const std::unique_ptr<Creature>> creatures,
 	Vector2D pos) const noexcept
 {
-	for (const auto& actor : creatures)
+	if (!occupancy.is_bound() || !occupancy.in_bounds(pos))
 	{
-		assert(actor);
-		if (actor->position == pos)
+		for (const auto& actor : creatures)
 		{
-			return actor.get();
+			assert(actor);
+			if (actor->position == pos && !actor->is_dead())
+			{
+				return actor.get();
+			}
 		}
+		return nullptr;
+	}
+
+	sync_occupancy(creatures);
+
+	// A slot may lag behind a death until cleanup_dead_creatures runs.
+	Creature* occupant = occupancy.at(pos);
+	if (occupant && occupant->position == pos && !occupant->is_dead())
+	{
+		return occupant;
 	}
 	return nullptr;
 }
 
+void CreatureManager::bind_occupancy(int width, int height)
+{
+	occupancy.resize(width, height);
+	indexedCount = 0;
+}
+
+void CreatureManager::move_creature(Creature& creature, Vector2D to) noexcept
+{
+	occupancy.remove(creature, creature.position);
+	creature.position = to;
+	occupancy.place(creature, to);
+}
+
+void CreatureManager::sync_occupancy(std::span<const std::unique_ptr<Creature>> creatures) const noexcept
+{
+	if (creatures.size() < indexedCount)
+	{
+		rebuild_occupancy(creatures);
+		return;
+	}
+
+	// Index only what was appended since the last sync. The first living
+	// creature on a tile keeps the slot, matching the old linear scan order.
+	for (size_t i = indexedCount; i < creatures.size(); ++i)
+	{
+		Creature& creature = *creatures[i];
+		if (creature.is_dead())
+		{
+			continue;
+		}
+		const Creature* current = occupancy.at(creature.position);
+		if (current == nullptr || current->position != creature.position || current->is_dead())
+		{
+			occupancy.place(creature, creature.position);
+		}
+	}
+	indexedCount = creatures.size();
+}
+
+void CreatureManager::rebuild_occupancy(std::span<const std::unique_ptr<Creature>> creatures) const noexcept
+{
+	occupancy.clear();
+	indexedCount = 0;
+	sync_occupancy(creatures);
+}
+
+bool CreatureManager::verify_occupancy(std::span<const std::unique_ptr<Creature>> creatures) const noexcept
+{
+	if (!occupancy.is_bound())
+	{
+		return true;
+	}
+
+	sync_occupancy(creatures);
+
+	std::unordered_set<const Creature*> living;
+	for (const auto& actor : creatures)
+	{
+		if (actor && !actor->is_dead())
+		{
+			living.insert(actor.get());
+		}
+	}
+
+	// Every living creature's tile must be held by a living creature standing
+	// there (two creatures may legitimately share a tile; one keeps the slot).
+	for (const Creature* actor : living)
+	{
+		if (!occupancy.in_bounds(actor->position))
+		{
+			continue;
+		}
+		const Creature* occupant = occupancy.at(actor->position);
+		if (!living.contains(occupant) || occupant->position != actor->position)
+		{
+			return false;
+		}
+	}
+
+	// No slot may point at a living creature standing somewhere else.
+	// Dead or freed occupants are never dereferenced here.
+	bool consistent = true;
+	occupancy.for_each_occupied([&](Vector2D pos, const Creature* occupant)
+		{
+			if (living.contains(occupant) && occupant->position != pos)
+			{
+				consistent = false;
+			}
+		});
+	return consistent;
+}
+
 bool CreatureManager::can_spawn_creature(
 	std::span<const std::unique_ptr<Creature>> creatures,
 	int max_creatures) const noexcept
@@ -101,7 +225,7 @@ Vector2D CreatureManager::find_spawn_position(GameContext& ctx)
 	while (true)
 	{
 		const size_t index = static_cast<size_t>(
-			ctx.dice->roll(0, static_cast<int>(ctx.rooms->size()) - 1));
+			ctx.dice->mapgen().roll(0, static_cast<int>(ctx.rooms->size()) - 1));
 		auto pos = SpawnUtils::find_random_room_position(ctx.rooms->at(index), ctx);
 		if (pos)
 		{
@@ -5,6 +5,8 @@
 #include <span>
 #include <vector>
 
+#include "../Map/OccupancyGrid.h"
+
 // Forward declarations
 class Creature;
 class Map;
@@ -30,14 +32,35 @@ public:
 		Vector2D fromPosition,
 		int inRange) const noexcept;
 
+	// Returns the living creature standing on pos, or nullptr.
+	// O(1) once the occupancy index is bound; falls back to a scan otherwise.
 	Creature* get_actor_at_position(
 		std::span<const std::unique_ptr<Creature>> creatures,
 		Vector2D pos) const noexcept;
 
+	// Occupancy index
+	// Call whenever a new level grid is created or loaded.
+	void bind_occupancy(int width, int height);
+	// Moves a creature and keeps the occupancy index in sync.
+	void move_creature(Creature& creature, Vector2D to) noexcept;
+	// Debug consistency check: every living creature is indexed on its tile
+	// and no live slot points at a creature standing elsewhere.
+	bool verify_occupancy(std::span<const std::unique_ptr<Creature>> creatures) const noexcept;
+
 private:
 	int maxCreatures{ 10 };
 	int spawnRate{ 2 };
 
+	// Spawns append to the creature list from many call sites (factories,
+	// encounter planner, treasure rooms, load). Instead of hooking each one,
+	// the index remembers how many entries it has seen and indexes the new
+	// tail lazily; a shrink forces a full rebuild.
+	mutable OccupancyGrid occupancy;
+	mutable size_t indexedCount{ 0 };
+
+	void sync_occupancy(std::span<const std::unique_ptr<Creature>> creatures) const noexcept;
+	void rebuild_occupancy(std::span<const std::unique_ptr<Creature>> creatures) const noexcept;
+
 	// Helper methods
 	bool can_spawn_creature(
 		std::span<const std::unique_ptr<Creature>> creatures,
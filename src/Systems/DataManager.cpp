@@ -61,7 +61,7 @@ std::vector<Weapons> DataManager::load_weapons(const std::string& filename, Mess
 	std::ifstream file(filename);
 	if (!file.is_open())
 	{
-		message_system.log("DataManager: Error opening " + filename);
+		message_system.debug("DataManager: Error opening {}", filename);
 		return {};
 	}
 
@@ -143,7 +143,7 @@ std::vector<Weapons> DataManager::load_weapons(const std::string& filename, Mess
 		data.push_back(w);
 	}
 
-	message_system.log("DataManager: Loaded " + std::to_string(data.size()) + " weapons");
+	message_system.debug("DataManager: Loaded {} weapons", data.size());
 	return data;
 }
 
@@ -152,7 +152,7 @@ std::vector<StrengthAttributes> DataManager::load_strength(const std::string& fi
 	std::ifstream file(filename);
 	if (!file.is_open())
 	{
-		message_system.log("DataManager: Error opening " + filename);
+		message_system.debug("DataManager: Error opening {}", filename);
 		return {};
 	}
 
@@ -174,7 +174,7 @@ std::vector<StrengthAttributes> DataManager::load_strength(const std::string& fi
 		data.push_back(s);
 	}
 
-	message_system.log("DataManager: Loaded " + std::to_string(data.size()) + " strength attributes");
+	message_system.debug("DataManager: Loaded {} strength attributes", data.size());
 	return data;
 }
 
@@ -183,7 +183,7 @@ std::vector<DexterityAttributes> DataManager::load_dexterity(const std::string&
 	std::ifstream file(filename);
 	if (!file.is_open())
 	{
-		message_system.log("DataManager: Error opening " + filename);
+		message_system.debug("DataManager: Error opening {}", filename);
 		return {};
 	}
 
@@ -201,7 +201,7 @@ std::vector<DexterityAttributes> DataManager::load_dexterity(const std::string&
 		data.push_back(d);
 	}
 
-	message_system.log("DataManager: Loaded " + std::to_string(data.size()) + " dexterity attributes");
+	message_system.debug("DataManager: Loaded {} dexterity attributes", data.size());
 	return data;
 }
 
@@ -210,7 +210,7 @@ std::vector<ConstitutionAttributes> DataManager::load_constitution(const std::st
 	std::ifstream file(filename);
 	if (!file.is_open())
 	{
-		message_system.log("DataManager: Error opening " + filename);
+		message_system.debug("DataManager: Error opening {}", filename);
 		return {};
 	}
 
@@ -230,7 +230,7 @@ std::vector<ConstitutionAttributes> DataManager::load_constitution(const std::st
 		data.push_back(c);
 	}
 
-	message_system.log("DataManager: Loaded " + std::to_string(data.size()) + " constitution attributes");
+	message_system.debug("DataManager: Loaded {} constitution attributes", data.size());
 	return data;
 }
 
@@ -239,7 +239,7 @@ std::vector<CharismaAttributes> DataManager::load_charisma(const std::string& fi
 	std::ifstream file(filename);
 	if (!file.is_open())
 	{
-		message_system.log("DataManager: Error opening " + filename);
+		message_system.debug("DataManager: Error opening {}", filename);
 		return {};
 	}
 
@@ -257,7 +257,7 @@ std::vector<CharismaAttributes> DataManager::load_charisma(const std::string& fi
 		data.push_back(c);
 	}
 
-	message_system.log("DataManager: Loaded " + std::to_string(data.size()) + " charisma attributes");
+	message_system.debug("DataManager: Loaded {} charisma attributes", data.size());
 	return data;
 }
 
@@ -266,7 +266,7 @@ std::vector<IntelligenceAttributes> DataManager::load_intelligence(const std::st
 	std::ifstream file(filename);
 	if (!file.is_open())
 	{
-		message_system.log("DataManager: Error opening " + filename);
+		message_system.debug("DataManager: Error opening {}", filename);
 		return {};
 	}
 
@@ -286,7 +286,7 @@ std::vector<IntelligenceAttributes> DataManager::load_intelligence(const std::st
 		data.push_back(i);
 	}
 
-	message_system.log("DataManager: Loaded " + std::to_string(data.size()) + " intelligence attributes");
+	message_system.debug("DataManager: Loaded {} intelligence attributes", data.size());
 	return data;
 }
 
@@ -295,7 +295,7 @@ std::vector<WisdomAttributes> DataManager::load_wisdom(const std::string& filena
 	std::ifstream file(filename);
 	if (!file.is_open())
 	{
-		message_system.log("DataManager: Error opening " + filename);
+		message_system.debug("DataManager: Error opening {}", filename);
 		return {};
 	}
 
@@ -314,7 +314,7 @@ std::vector<WisdomAttributes> DataManager::load_wisdom(const std::string& filena
 		data.push_back(w);
 	}
 
-	message_system.log("DataManager: Loaded " + std::to_string(data.size()) + " wisdom attributes");
+	message_system.debug("DataManager: Loaded {} wisdom attributes", data.size());
 	return data;
 }
 
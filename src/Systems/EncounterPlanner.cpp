@@ -105,7 +105,7 @@ std::vector<std::string> select_encounter(
 
 	while (!affordable.empty() && static_cast<int>(selected.size()) < cap)
 	{
-		const int idx = rng.roll(0, static_cast<int>(affordable.size()) - 1);
+		const int idx = rng.mapgen().roll(0, static_cast<int>(affordable.size()) - 1);
 		const MonsterCandidate& pick = *affordable[idx];
 		if (pick.xpCost > remaining)
 		{
@@ -147,7 +147,7 @@ void plan_encounter(const DungeonRoom& room, GameContext& ctx)
 
 	const int dungeonLevel = ctx.levelManager->get_dungeon_level();
 	const int baseBudget = calculate_budget(room.type, dungeonLevel);
-	const int roll = ctx.dice->roll(60, 100);
+	const int roll = ctx.dice->mapgen().roll(60, 100);
 	const int budget = baseBudget * roll / 100;
 
 	if (budget <= 0)
@@ -181,7 +181,7 @@ void plan_encounter(const DungeonRoom& room, GameContext& ctx)
 	}
 
 	// Shuffle candidates for variety in phase 1 selection order
-	std::ranges::shuffle(candidates, ctx.dice->get_rng());
+	std::ranges::shuffle(candidates, ctx.dice->mapgen().get_rng());
 
 	// Two-phase selection: variety first, fill second
 	std::vector<std::string> selected = select_encounter(
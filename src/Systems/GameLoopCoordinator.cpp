@@ -14,6 +14,8 @@
 #include "../Core/GameContext.h"
 #include "../Core/Paths.h"
 #include "../Gui/Gui.h"
+#include "../Gui/ProfilerOverlay.h"
+#include "../Map/LevelGenerator.h"
 #include "../Map/Map.h"
 #include "../Map/Minimap.h"
 #include "../Menu/DeathMenu.h"
@@ -21,8 +23,10 @@
 #include "../Renderer/InputSystem.h"
 #include "../Renderer/Renderer.h"
 #include "../Systems/InputHandler.h"
+#include "../Systems/InputRecorder.h"
 #include "../Systems/MenuManager.h"
 #include "../Systems/MessageSystem.h"
+#include "../Systems/Profiler.h"
 #include "../Systems/RenderingManager.h"
 #include "../Tools/ContentEditor.h"
 #include "../Tools/DecorEditor.h"
@@ -32,6 +36,7 @@
 #include "CurseSystem.h"
 #include "FloatingTextSystem.h"
 #include "GameLoopCoordinator.h"
+#include "GameStateManager.h"
 #include "HungerSystem.h"
 #include "LevelManager.h"
 
@@ -39,13 +44,23 @@ void GameLoopCoordinator::handle_gameloop(GameContext& ctx, Gui& gui, int loopNu
 {
 	handle_initialization(ctx);
 
-	if (ctx.messageSystem->is_debug_mode())
+	ctx.messageSystem->trace("//====================LOOP====================//");
+	ctx.messageSystem->trace("Loop number: {}\n", loopNum);
+	if (ctx.renderer)
 	{
-		ctx.messageSystem->log("//====================LOOP====================//");
-		ctx.messageSystem->log(std::format("Loop number: {}\n", loopNum));
+		const RenderStats& stats = ctx.renderer->get_last_frame_stats();
+		ctx.messageSystem->trace(
+			"Last frame: {} sprites, {} texts, {} texture switches, {} atlas pages",
+			stats.spriteDraws,
+			stats.textDraws,
+			stats.textureSwitches,
+			ctx.renderer->get_atlas_page_count());
 	}
 
-	handle_input_phase(ctx);
+	{
+		PROFILE_ZONE("input");
+		handle_input_phase(ctx);
+	}
 
 	if (ctx.inputHandler->was_resized())
 	{
@@ -116,6 +131,29 @@ void GameLoopCoordinator::handle_input_phase(GameContext& ctx)
 				ctx.minimap->toggle();
 				return true;
 			}
+			if (key == GameKey::MINIMAP_RESOLUTION_TOGGLE && ctx.minimap)
+			{
+				ctx.minimap->toggle_reduced();
+				return true;
+			}
+#if PROFILER_ENABLED
+			// F9/F10 do nothing when the profiler is compiled out.
+			if (key == GameKey::PROFILER_TOGGLE && ctx.profilerOverlay)
+			{
+				ctx.profilerOverlay->toggle();
+				return true;
+			}
+			if (key == GameKey::PROFILER_EXPORT)
+			{
+				const bool written = ProfilerOverlay::export_history();
+				ctx.messageSystem->message(
+					WHITE_BLACK_PAIR,
+					written ? std::format("Profile written to {} and {}", Paths::PROFILE_TRACE, Paths::PROFILE_CSV)
+							: std::string("Could not write the profile"),
+					true);
+				return true;
+			}
+#endif
 			if (key == GameKey::ZOOM_IN)
 			{
 				ctx.renderer->zoom_in();
@@ -136,6 +174,10 @@ void GameLoopCoordinator::handle_input_phase(GameContext& ctx)
 			}
 			if (key == GameKey::CONTENT_EDIT_TOGGLE && ctx.contentEditor)
 			{
+				if (ctx.levelGenerator)
+				{
+					ctx.levelGenerator->discard(); // the next level is rebuilt from the edited content
+				}
 				ctx.contentEditor->toggle(*ctx.contentRegistry);
 				return true;
 			}
@@ -168,10 +210,22 @@ void GameLoopCoordinator::handle_input_phase(GameContext& ctx)
 					if (key == GameKey::MOUSE_LEFT)
 					{
 						ctx.decorEditor->place(world_x, world_y);
+						const TileRef placed = ctx.decorEditor->get_override(world_x, world_y);
+						if (ctx.map && placed.is_valid())
+						{
+							ctx.map->stamp_decoration(world, placed, ctx);
+						}
 					}
 					else
 					{
 						ctx.decorEditor->erase(world_x, world_y);
+						if (ctx.map)
+						{
+							if (auto* decor = ctx.map->find_decoration_at(world, ctx))
+							{
+								ctx.map->break_decoration(*decor, ctx);
+							}
+						}
 					}
 					return true;
 				}
@@ -209,6 +263,7 @@ void GameLoopCoordinator::handle_input_phase(GameContext& ctx)
 
 void GameLoopCoordinator::handle_update_phase(GameContext& ctx, Gui& gui)
 {
+	PROFILE_ZONE("update");
 	ctx.messageSystem->log("Running update...");
 	ctx.gameLoopCoordinator->update(ctx);
 	gui.gui_update(ctx);
@@ -217,7 +272,8 @@ void GameLoopCoordinator::handle_update_phase(GameContext& ctx, Gui& gui)
 
 void GameLoopCoordinator::handle_render_phase(GameContext& ctx, Gui& gui)
 {
-	ctx.messageSystem->log("Running render...");
+	PROFILE_ZONE("render");
+	ctx.messageSystem->trace("Running render...");
 
 	// Center camera on player before rendering
 	ctx.renderer->set_camera_center(
@@ -230,14 +286,17 @@ void GameLoopCoordinator::handle_render_phase(GameContext& ctx, Gui& gui)
 
 	ctx.renderingManager->render(ctx);
 
-	if (ctx.animSystem)
 	{
-		ctx.animSystem->update_and_render(*ctx.renderer);
-	}
+		PROFILE_ZONE("animations");
+		if (ctx.animSystem)
+		{
+			ctx.animSystem->update_and_render(*ctx.renderer);
+		}
 
-	if (ctx.floatingText)
-	{
-		ctx.floatingText->update_and_render(*ctx.renderer);
+		if (ctx.floatingText)
+		{
+			ctx.floatingText->update_and_render(*ctx.renderer);
+		}
 	}
 
 #ifndef EMSCRIPTEN
@@ -254,13 +313,21 @@ void GameLoopCoordinator::handle_render_phase(GameContext& ctx, Gui& gui)
 
 	if (gui.guiInit)
 	{
+		PROFILE_ZONE("gui");
 		gui.gui_render(ctx);
 	}
 
 	draw_hover_tooltip(ctx);
 
+#if PROFILER_ENABLED
+	if (ctx.profilerOverlay)
+	{
+		ctx.profilerOverlay->render(*ctx.renderer);
+	}
+#endif
+
 	ctx.renderer->end_frame();
-	ctx.messageSystem->log("Render OK.");
+	ctx.messageSystem->trace("Render OK.");
 }
 
 void GameLoopCoordinator::handle_menu_check(GameContext& ctx)
@@ -488,10 +555,14 @@ void GameLoopCoordinator::update(GameContext& ctx)
 	}
 
 	ctx.map->update();
-	ctx.player->update(ctx);
+	{
+		PROFILE_ZONE("player");
+		ctx.player->update(ctx);
+	}
 
 	if (ctx.gameState->get_game_status() == GameStatus::STARTUP)
 	{
+		PROFILE_ZONE("level start");
 #ifndef EMSCRIPTEN
 		// Ensure active map key is set for loaded games (new games set it in Map::init).
 		if (ctx.decorEditor && ctx.map && ctx.levelManager)
@@ -519,6 +590,19 @@ void GameLoopCoordinator::update(GameContext& ctx)
 		else
 		{
 			ctx.gameState->set_game_status(GameStatus::NEW_TURN);
+
+			// A fresh level (new game or descent): checkpoint it.
+			if (ctx.stateManager && ctx.gameState->get_should_save())
+			{
+				ctx.stateManager->autosave(ctx);
+			}
+		}
+
+		// Build the level below while this one is played.
+		if (ctx.levelGenerator && ctx.dice)
+		{
+			const int nextLevel = ctx.levelManager->get_dungeon_level() + 1;
+			ctx.levelGenerator->prefetch(ctx, nextLevel, ctx.levelManager->get_next_level_seed(*ctx.dice));
 		}
 
 		if (!ctx.gui->guiInit)
@@ -535,15 +619,20 @@ void GameLoopCoordinator::update(GameContext& ctx)
 			[](const auto& obj)
 			{ return !obj; });
 
-		if (ctx.decorations)
+		if (ctx.map)
 		{
-			std::erase_if(*ctx.decorations,
-				[](const auto& d)
-				{ return !d || d->isBroken; });
+			ctx.map->prune_decorations(ctx);
+
+			// What keeping the player flow field current cost this turn.
+			PROFILE_COUNT(ProfileCounter::FLOW_CELLS, static_cast<int64_t>(ctx.map->get_dijkstra_touched_count()));
+			ctx.map->reset_dijkstra_touched_count();
 		}
 
-		ctx.creatureManager->update_creatures(*ctx.creatures, ctx);
-		ctx.creatureManager->spawn_creatures(ctx);
+		{
+			PROFILE_ZONE("creatures");
+			ctx.creatureManager->update_creatures(*ctx.creatures, ctx);
+			ctx.creatureManager->spawn_creatures(ctx);
+		}
 
 		for (const auto& creature : *ctx.creatures)
 		{
@@ -558,20 +647,31 @@ void GameLoopCoordinator::update(GameContext& ctx)
 			ctx.player->update_constitution_bonus(ctx);
 		}
 
-		ctx.hungerSystem->increase_hunger(ctx, 1);
-		ctx.hungerSystem->apply_hunger_effects(ctx);
+		{
+			PROFILE_ZONE("hunger");
+			ctx.hungerSystem->increase_hunger(ctx, 1);
+			ctx.hungerSystem->apply_hunger_effects(ctx);
+		}
 
 		if (ctx.playerOwner && ctx.curseSystem)
 		{
+			PROFILE_ZONE("curses");
 			ctx.curseSystem->apply_curses(**ctx.playerOwner, ctx);
 		}
 
-		ctx.creatureManager->cleanup_dead_creatures(*ctx.creatures);
+		{
+			PROFILE_ZONE("cleanup");
+			ctx.creatureManager->cleanup_dead_creatures(*ctx.creatures);
+		}
 
 		ctx.gameState->increment_time();
 		if (ctx.gameState->get_game_status() != GameStatus::DEFEAT)
 		{
 			ctx.gameState->set_game_status(GameStatus::IDLE);
+			if (ctx.stateManager)
+			{
+				ctx.stateManager->autosave_tick(ctx);
+			}
 		}
 	}
 
@@ -581,4 +681,9 @@ void GameLoopCoordinator::update(GameContext& ctx)
 		ctx.menus->push_back(std::make_unique<DeathMenu>(ctx));
 		ctx.gameState->set_game_status(GameStatus::IDLE);
 	}
+
+	if (ctx.inputRecorder)
+	{
+		ctx.inputRecorder->record_step(*ctx.inputHandler);
+	}
 }
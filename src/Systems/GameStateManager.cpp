@@ -1,14 +1,22 @@
 // GameStateManager.cpp - Handles game state persistence and level management
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
+#include <string_view>
 #include <system_error>
 #include <utility>
 #include <vector>
 
-#include <nlohmann/json_fwd.hpp>
+#include <nlohmann/json.hpp>
 
 #include "../Actor/Actor.h"
 #include "../Actor/InventoryOperations.h"
@@ -19,16 +27,23 @@
 #include "../Gui/Gui.h"
 #include "../Map/DungeonRoom.h"
 #include "../Map/Map.h"
+#include "../Persistent/BinaryStream.h"
+#include "../Persistent/SaveFile.h"
+#include "../Random/RandomDice.h"
 #include "../Renderer/Renderer.h"
+#include "../Systems/CreatureManager.h"
 #include "../Systems/DataManager.h"
 #include "../Systems/HungerSystem.h"
 #include "../Systems/LevelManager.h"
 #include "../Systems/MenuManager.h"
 #include "../Systems/MessageSystem.h"
 #include "../Utils/Vector2D.h"
+#include "AutosaveWorker.h"
 #include "ContentRegistry.h"
 #include "ContentRegistryIO.h"
 #include "GameStateManager.h"
+#include "InputRecorder.h"
+#include "Logger.h"
 #include "TileConfig.h"
 
 using json = nlohmann::json;
@@ -69,6 +84,34 @@ void load_rooms(const json& j, std::vector<DungeonRoom>& rooms)
 	}
 }
 
+void save_rooms(const std::vector<DungeonRoom>& rooms, BinaryWriter& out)
+{
+	out.write_u32(static_cast<uint32_t>(rooms.size()));
+	for (const auto& room : rooms)
+	{
+		out.write_i32(room.col);
+		out.write_i32(room.row);
+		out.write_i32(room.width);
+		out.write_i32(room.height);
+		out.write_u8(static_cast<uint8_t>(room.type));
+	}
+}
+
+void load_rooms(BinaryReader& in, std::vector<DungeonRoom>& rooms)
+{
+	const uint32_t count = in.read_u32();
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		DungeonRoom room;
+		room.col = in.read_i32();
+		room.row = in.read_i32();
+		room.width = in.read_i32();
+		room.height = in.read_i32();
+		room.type = static_cast<RoomType>(in.read_u8());
+		rooms.push_back(std::move(room));
+	}
+}
+
 void save_creatures(const std::vector<std::unique_ptr<Creature>>& creatures, json& j)
 {
 	j["creatures"] = json::array();
@@ -96,8 +139,183 @@ void load_creatures(const json& j, std::vector<std::unique_ptr<Creature>>& creat
 	}
 }
 
+// The whole game state as one JSON document: the pre-binary save format,
+// now used for export_json.
+json build_state_json(GameContext& ctx)
+{
+	json j;
+
+	ctx.map->save(j);
+	save_rooms(*ctx.rooms, j);
+
+	json playerJson;
+	ctx.player->save(playerJson);
+	j["player"] = playerJson;
+
+	json stairsJson;
+	ctx.stairs->save(stairsJson);
+	j["stairs"] = stairsJson;
+
+	save_creatures(*ctx.creatures, j);
+	save_inventory(*ctx.floorInventory, j);
+
+	json guiJson;
+	ctx.gui->save(guiJson);
+	j["gui"] = guiJson;
+
+	json hungerJson;
+	ctx.hungerSystem->save(hungerJson);
+	j["hunger_system"] = hungerJson;
+
+	ctx.levelManager->save_to_json(j);
+	j["time"] = ctx.gameState->get_time();
+	return j;
+}
+
+// Map-derived state the rest of the load depends on.
+void after_map_load(GameContext& ctx)
+{
+	if (ctx.creatureManager)
+	{
+		ctx.creatureManager->bind_occupancy(ctx.map->get_width(), ctx.map->get_height());
+	}
+	ctx.map->rebuild_decoration_index(ctx);
+}
+
+void load_json_state(GameContext& ctx, const json& j)
+{
+	ctx.map->load(j);
+	after_map_load(ctx);
+	load_rooms(j, *ctx.rooms);
+
+	if (j.contains("player"))
+	{
+		ctx.player->load(j["player"]);
+	}
+
+	if (j.contains("stairs"))
+	{
+		ctx.stairs->load(j["stairs"]);
+	}
+
+	load_creatures(j, *ctx.creatures);
+	load_inventory(*ctx.floorInventory, j);
+
+	if (j.contains("gui"))
+	{
+		ctx.gui->load(j["gui"]);
+	}
+
+	if (j.contains("hunger_system"))
+	{
+		ctx.hungerSystem->load(ctx, j["hunger_system"]);
+	}
+
+	ctx.levelManager->load_from_json(j);
+
+	if (j.contains("time"))
+	{
+		ctx.gameState->set_time(j["time"]);
+	}
+}
+
+void load_binary_state(GameContext& ctx, const SaveReader& save)
+{
+	{
+		const std::vector<uint8_t> mapBytes = save.payload(SaveSection::MAP);
+		BinaryReader in(mapBytes);
+		ctx.map->load(in, save.get_version());
+	}
+	after_map_load(ctx);
+
+	{
+		const std::vector<uint8_t> roomBytes = save.payload(SaveSection::ROOMS);
+		if (!roomBytes.empty())
+		{
+			BinaryReader in(roomBytes);
+			load_rooms(in, *ctx.rooms);
+		}
+	}
+
+	if (save.has(SaveSection::PLAYER))
+	{
+		ctx.player->load(save.json_section(SaveSection::PLAYER));
+	}
+
+	if (save.has(SaveSection::STAIRS))
+	{
+		ctx.stairs->load(save.json_section(SaveSection::STAIRS));
+	}
+
+	if (save.has(SaveSection::CREATURES))
+	{
+		load_creatures(save.json_section(SaveSection::CREATURES), *ctx.creatures);
+	}
+
+	if (save.has(SaveSection::FLOOR_ITEMS))
+	{
+		load_inventory(*ctx.floorInventory, save.json_section(SaveSection::FLOOR_ITEMS));
+	}
+
+	if (save.has(SaveSection::GUI))
+	{
+		ctx.gui->load(save.json_section(SaveSection::GUI));
+	}
+
+	if (save.has(SaveSection::HUNGER))
+	{
+		ctx.hungerSystem->load(ctx, save.json_section(SaveSection::HUNGER));
+	}
+
+	if (save.has(SaveSection::LEVEL))
+	{
+		ctx.levelManager->load_from_json(save.json_section(SaveSection::LEVEL));
+	}
+
+	const std::vector<uint8_t> timeBytes = save.payload(SaveSection::TIME);
+	if (!timeBytes.empty())
+	{
+		BinaryReader in(timeBytes);
+		ctx.gameState->set_time(in.read_i32());
+	}
+
+	if (ctx.dice && save.has(SaveSection::DICE))
+	{
+		const std::vector<uint8_t> diceBytes = save.payload(SaveSection::DICE);
+		BinaryReader in(diceBytes);
+		ctx.dice->load(in);
+	}
+}
+
+// Existing save files, newest first: the manual save and both autosave slots.
+std::vector<std::filesystem::path> save_candidates()
+{
+	std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> found;
+	for (const std::string_view relative : { Paths::SAVE_FILE, Paths::AUTOSAVE_SLOT_A, Paths::AUTOSAVE_SLOT_B })
+	{
+		std::error_code ec;
+		auto path = Paths::resolve(relative);
+		const auto written = std::filesystem::last_write_time(path, ec);
+		if (!ec)
+		{
+			found.emplace_back(written, std::move(path));
+		}
+	}
+	std::ranges::stable_sort(found, std::greater{}, [](const auto& entry) { return entry.first; });
+
+	std::vector<std::filesystem::path> paths;
+	for (auto& entry : found)
+	{
+		paths.push_back(std::move(entry.second));
+	}
+	return paths;
+}
+
 } // namespace
 
+GameStateManager::GameStateManager() = default;
+GameStateManager::~GameStateManager() = default; // joins the autosave thread, finishing a queued write
+
 void GameStateManager::init_new_game(GameContext& ctx)
 {
 	assert(ctx.dataManager != nullptr);
@@ -114,8 +332,16 @@ void GameStateManager::init_new_game(GameContext& ctx)
 	ctx.levelManager->reset_to_first_level();
 	ctx.gameState->set_time(0);
 	ctx.gameState->set_is_loaded_game(false);
+	if (ctx.hungerSystem)
+	{
+		ctx.hungerSystem->reset(); // a game started after a death must not inherit its hunger
+	}
 
 	assert(ctx.playerBlueprint != nullptr);
+	if (ctx.inputRecorder)
+	{
+		ctx.inputRecorder->begin(ctx); // reseeds the dice, so before anything rolls
+	}
 	*ctx.playerOwner = std::make_unique<Player>(Vector2D{ 0, 0 }, *ctx.playerBlueprint, ctx);
 	*ctx.playerBlueprint = PlayerBlueprint{};
 	ctx.player = ctx.playerOwner->get();
@@ -136,6 +362,11 @@ bool GameStateManager::load_all(GameContext& ctx)
 	assert(ctx.playerOwner != nullptr);
 	assert(ctx.tileConfig != nullptr);
 
+	if (ctx.inputRecorder)
+	{
+		ctx.inputRecorder->finish(ctx); // a replay starts from a new game, not a save
+	}
+
 	ContentRegistryIO::load(*ctx.contentRegistry, Paths::CONTENT_TILES);
 	ctx.menuManager->set_game_initialized(true);
 	ctx.dataManager->load_all_data(*ctx.messageSystem);
@@ -156,7 +387,7 @@ bool GameStateManager::load_all(GameContext& ctx)
 	return true;
 }
 
-void GameStateManager::save_game(GameContext& ctx)
+SaveSnapshot GameStateManager::capture(GameContext& ctx) const
 {
 	assert(ctx.map != nullptr);
 	assert(ctx.rooms != nullptr);
@@ -169,50 +400,96 @@ void GameStateManager::save_game(GameContext& ctx)
 	assert(ctx.levelManager != nullptr);
 	assert(ctx.gameState != nullptr);
 
-	auto save_path = Paths::resolve(Paths::SAVE_FILE);
-	std::filesystem::create_directories(save_path.parent_path());
+	SaveSnapshot snapshot;
+	BinaryWriter section;
 
-	std::filesystem::path temp_path = save_path;
-	temp_path.replace_extension(".tmp");
+	ctx.map->save(section);
+	snapshot.add(SaveSection::MAP, section.data(), compressMap);
 
-	{
-		std::ofstream file(temp_path);
-		if (!file.is_open())
-		{
-			throw std::runtime_error("Error occurred while saving the game.");
-		}
+	section.clear();
+	save_rooms(*ctx.rooms, section);
+	snapshot.add(SaveSection::ROOMS, section.data());
+
+	json playerJson;
+	ctx.player->save(playerJson);
+	snapshot.add_json(SaveSection::PLAYER, playerJson);
+
+	json stairsJson;
+	ctx.stairs->save(stairsJson);
+	snapshot.add_json(SaveSection::STAIRS, stairsJson);
+
+	json creaturesJson;
+	save_creatures(*ctx.creatures, creaturesJson);
+	snapshot.add_json(SaveSection::CREATURES, creaturesJson);
+
+	json floorJson;
+	save_inventory(*ctx.floorInventory, floorJson);
+	snapshot.add_json(SaveSection::FLOOR_ITEMS, floorJson);
 
-		json j;
+	json guiJson;
+	ctx.gui->save(guiJson);
+	snapshot.add_json(SaveSection::GUI, guiJson);
 
-		ctx.map->save(j);
-		save_rooms(*ctx.rooms, j);
+	json hungerJson;
+	ctx.hungerSystem->save(hungerJson);
+	snapshot.add_json(SaveSection::HUNGER, hungerJson);
 
-		json playerJson;
-		ctx.player->save(playerJson);
-		j["player"] = playerJson;
+	json levelJson;
+	ctx.levelManager->save_to_json(levelJson);
+	snapshot.add_json(SaveSection::LEVEL, levelJson);
 
-		json stairsJson;
-		ctx.stairs->save(stairsJson);
-		j["stairs"] = stairsJson;
+	section.clear();
+	section.write_i32(ctx.gameState->get_time());
+	snapshot.add(SaveSection::TIME, section.data());
 
-		save_creatures(*ctx.creatures, j);
-		save_inventory(*ctx.floorInventory, j);
+	if (ctx.dice)
+	{
+		section.clear();
+		ctx.dice->save(section);
+		snapshot.add(SaveSection::DICE, section.data());
+	}
 
-		json guiJson;
-		ctx.gui->save(guiJson);
-		j["gui"] = guiJson;
+	return snapshot;
+}
 
-		json hungerJson;
-		ctx.hungerSystem->save(hungerJson);
-		j["hunger_system"] = hungerJson;
+void GameStateManager::save_game(GameContext& ctx)
+{
+	SaveSnapshot snapshot = capture(ctx);
 
-		ctx.levelManager->save_to_json(j);
-		j["time"] = ctx.gameState->get_time();
+	// A queued autosave is older than this save; drop it so it cannot
+	// land afterwards and shadow the manual save on the next load.
+	if (autosaveWorker)
+	{
+		autosaveWorker->cancel();
+	}
+	snapshot.write_file(Paths::resolve(Paths::SAVE_FILE));
+}
 
-		file << j.dump(4);
+void GameStateManager::autosave(GameContext& ctx)
+{
+	if (!autosaveWorker)
+	{
+		autosaveWorker = std::make_unique<AutosaveWorker>(std::array<std::filesystem::path, AutosaveWorker::SLOT_COUNT>{
+			Paths::resolve(Paths::AUTOSAVE_SLOT_A),
+			Paths::resolve(Paths::AUTOSAVE_SLOT_B) });
 	}
+	autosaveWorker->submit(capture(ctx));
+}
 
-	std::filesystem::rename(temp_path, save_path);
+void GameStateManager::autosave_tick(GameContext& ctx)
+{
+	if (ctx.gameState->get_should_save() && ctx.gameState->get_time() % AUTOSAVE_INTERVAL_TURNS == 0)
+	{
+		autosave(ctx);
+	}
+}
+
+void GameStateManager::flush_autosave()
+{
+	if (autosaveWorker)
+	{
+		autosaveWorker->wait_idle();
+	}
 }
 
 bool GameStateManager::load_game(GameContext& ctx)
@@ -228,67 +505,86 @@ bool GameStateManager::load_game(GameContext& ctx)
 	assert(ctx.levelManager != nullptr);
 	assert(ctx.gameState != nullptr);
 
-	std::ifstream file(Paths::resolve(Paths::SAVE_FILE));
-	if (!file.is_open())
-	{
-		return false;
-	}
-
-	json j;
-	file >> j;
-
-	ctx.map->load(j);
-	load_rooms(j, *ctx.rooms);
+	flush_autosave();
 
-	if (j.contains("player"))
+	// Newest first; a file that does not parse (cut short by a crash)
+	// falls through to the next candidate.
+	for (const std::filesystem::path& path : save_candidates())
 	{
-		ctx.player->load(j["player"]);
-	}
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open())
+		{
+			continue;
+		}
+		std::vector<uint8_t> bytes{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
 
-	if (j.contains("stairs"))
-	{
-		ctx.stairs->load(j["stairs"]);
+		if (SaveReader::is_binary(bytes))
+		{
+			std::optional<SaveReader> save;
+			try
+			{
+				save.emplace(std::move(bytes));
+			}
+			catch (const std::exception& e)
+			{
+				Logger::instance().print<LogLevel::LOG_WARN>("Skipping unreadable save {}: {}", path.string(), e.what());
+				continue;
+			}
+			load_binary_state(ctx, *save);
+		}
+		else
+		{
+			json j = json::parse(bytes, nullptr, false);
+			if (j.is_discarded())
+			{
+				Logger::instance().print<LogLevel::LOG_WARN>("Skipping unreadable save {}", path.string());
+				continue;
+			}
+			load_json_state(ctx, j);
+		}
+		return true; // Successfully loaded
 	}
 
-	load_creatures(j, *ctx.creatures);
-	load_inventory(*ctx.floorInventory, j);
-
-	if (j.contains("gui"))
-	{
-		ctx.gui->load(j["gui"]);
-	}
+	return false;
+}
 
-	if (j.contains("hunger_system"))
-	{
-		ctx.hungerSystem->load(ctx, j["hunger_system"]);
-	}
+void GameStateManager::export_json(GameContext& ctx)
+{
+	assert(ctx.map != nullptr);
+	assert(ctx.player != nullptr);
 
-	ctx.levelManager->load_from_json(j);
+	auto export_path = Paths::resolve(Paths::SAVE_JSON_EXPORT);
+	std::filesystem::create_directories(export_path.parent_path());
 
-	if (j.contains("time"))
+	std::ofstream file(export_path);
+	if (!file.is_open())
 	{
-		ctx.gameState->set_time(j["time"]);
+		throw std::runtime_error("Could not write the JSON export.");
 	}
-
-	return true; // Successfully loaded
+	file << build_state_json(ctx).dump(4);
 }
 
 bool GameStateManager::save_file_exists()
 {
-	std::ifstream file(Paths::resolve(Paths::SAVE_FILE));
-	return file.good();
+	return !save_candidates().empty();
 }
 
 bool GameStateManager::delete_save_file()
 {
-	std::error_code ec;
-	auto save_path = Paths::resolve(Paths::SAVE_FILE);
-
-	if (!std::filesystem::exists(save_path, ec))
+	if (autosaveWorker)
 	{
-		return true; // File doesn't exist, nothing to delete
+		autosaveWorker->cancel();
 	}
 
-	const bool removed = std::filesystem::remove(save_path, ec);
-	return removed && !ec;
+	bool removedAll = true;
+	for (const std::string_view relative : { Paths::SAVE_FILE, Paths::AUTOSAVE_SLOT_A, Paths::AUTOSAVE_SLOT_B })
+	{
+		std::error_code ec;
+		const auto path = Paths::resolve(relative);
+		if (std::filesystem::exists(path, ec))
+		{
+			removedAll = std::filesystem::remove(path, ec) && !ec && removedAll;
+		}
+	}
+	return removedAll;
 }
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory>
+
+#include "../Persistent/SaveFile.h"
+
 // Forward declarations
 class Map;
 class Player;
@@ -13,20 +17,56 @@ struct FloorInventory;
 struct Vector2D;
 struct DungeonRoom;
 struct GameContext;
+class AutosaveWorker;
 
 // - Handles game state persistence and level management
 class GameStateManager
 {
 public:
+	// Turns between periodic autosaves.
+	static constexpr int AUTOSAVE_INTERVAL_TURNS = 100;
+
+	GameStateManager();
+	~GameStateManager();
+	GameStateManager(const GameStateManager&) = delete;
+	GameStateManager& operator=(const GameStateManager&) = delete;
+
 	// High-level game state operations
 	bool load_all(GameContext& ctx);
 	void init_new_game(GameContext& ctx);
 
-	// Save/Load operations
+	// Save/Load operations. Saves are binary (see Persistent/SaveFile.h);
+	// load_game also accepts the older JSON saves and export_json output.
 	void save_game(GameContext& ctx);
 	bool load_game(GameContext& ctx);
 
+	// Serialises the game into memory. Game thread only; cheap next to
+	// the compression and file I/O it leaves for later.
+	[[nodiscard]] SaveSnapshot capture(GameContext& ctx) const;
+
+	// Captures now and writes in the background to the older of the two
+	// autosave slots. load_game picks the newest of the manual save and
+	// the slots, so an autosave is what a crash falls back to.
+	void autosave(GameContext& ctx);
+
+	// Called once per finished turn; autosaves every AUTOSAVE_INTERVAL_TURNS.
+	void autosave_tick(GameContext& ctx);
+
+	// Blocks until queued autosaves are on disk.
+	void flush_autosave();
+
+	// Writes the whole game state as indented JSON to Paths::SAVE_JSON_EXPORT
+	// for inspection. Not used by save/load.
+	void export_json(GameContext& ctx);
+
+	// LZ-compress the map planes in binary saves (on by default).
+	void set_compress_map(bool enabled) noexcept { compressMap = enabled; }
+
 	// File operations
 	static bool save_file_exists();
-	static bool delete_save_file();
+	bool delete_save_file();
+
+private:
+	bool compressMap{ true };
+	std::unique_ptr<AutosaveWorker> autosaveWorker; // started on first autosave
 };
@@ -31,6 +31,13 @@ void HungerSystem::decrease_hunger(GameContext& ctx, int amount)
 	update_hunger_state(ctx);
 }
 
+void HungerSystem::reset() noexcept
+{
+	hungerValue = 0;
+	wellFedMessageShown = false;
+	currentState = HungerState::SATIATED;
+}
+
 HungerState HungerSystem::get_hunger_state() const
 {
 	return currentState;
@@ -58,6 +58,9 @@ public:
 	// Apply hunger effects to player stats
 	void apply_hunger_effects(GameContext& ctx);
 
+	// Back to the state a new game starts in
+	void reset() noexcept;
+
 	// Save/Load methods for game persistence
 	void save(nlohmann::json& j) const;
 	void load(GameContext& ctx, const nlohmann::json& j);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "../Utils/Vector2D.h"
 
 class InputSystem;
@@ -13,6 +15,7 @@ private:
 	bool animationTick{ false };
 	Vector2D lastMousePos{ 0, 0 };
 	Vector2D currentMousePos{ 0, 0 };
+	std::optional<Vector2D> clickTile{};
 
 public:
 	void key_store() noexcept;
@@ -23,12 +26,20 @@ public:
 	Vector2D get_mouse_position_old() const noexcept;
 
 	int get_current_key() const noexcept { return keyPress; }
+	// Scripted input (headless runs, replays) stores its key here instead of key_listen.
+	void set_key(int key) noexcept { keyPress = key; }
+
+	// The world tile this step's mouse click resolved to. PlayerController
+	// sets it on the first lookup; a replay sets it from the recording.
+	void set_click_tile(Vector2D tile) noexcept { clickTile = tile; }
+	std::optional<Vector2D> get_click_tile() const noexcept { return clickTile; }
 	int get_last_key() const noexcept { return lastKey; }
 
 	void reset_key() noexcept
 	{
 		keyPress = -1;
 		animationTick = false;
+		clickTile.reset();
 	}
 
 	bool is_animation_tick() const noexcept { return animationTick; }
@@ -0,0 +1,434 @@
+// InputRecorder.cpp -- recording format, state checksum and the recorder.
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../Actor/Creature.h"
+#include "../Actor/EquipmentSlot.h"
+#include "../Actor/InventoryData.h"
+#include "../Actor/Item.h"
+#include "../Core/GameContext.h"
+#include "../Map/Map.h"
+#include "../Persistent/BinaryStream.h"
+#include "../Persistent/LzCodec.h"
+#include "../Random/RandomDice.h"
+#include "../Renderer/InputSystem.h"
+#include "../Renderer/Renderer.h"
+#include "InputHandler.h"
+#include "InputRecorder.h"
+#include "LevelManager.h"
+#include "Logger.h"
+
+namespace
+{
+	constexpr std::array<uint8_t, 4> MAGIC{ 'C', 'R', 'L', 'R' };
+
+	// A step is a tag byte -- its Kind in the low bits, HAS_DATA when a
+	// click or menu poll follows -- then by kind: UPDATE a u16 key (NO_KEY
+	// for -1) and maybe two i16 tile coordinates; MENU the polled GameKey
+	// as u8, the character as u32 and two i16 mouse coordinates; VIEW three
+	// u16 sizes; DISMISS_MENUS nothing.
+	constexpr uint8_t KIND_MASK = 0x03;
+	constexpr uint8_t HAS_DATA = 0x04;
+	constexpr uint8_t MOUSE_MOVED = 0x08;
+	constexpr uint16_t NO_KEY = 0xFFFF;
+
+	void write_i16(BinaryWriter& out, int value)
+	{
+		out.write_u16(static_cast<uint16_t>(static_cast<int16_t>(value)));
+	}
+
+	int read_i16(BinaryReader& in)
+	{
+		return static_cast<int16_t>(in.read_u16());
+	}
+
+	void encode_steps(const std::vector<InputStep>& steps, BinaryWriter& out)
+	{
+		for (const InputStep& step : steps)
+		{
+			uint8_t tag = static_cast<uint8_t>(step.kind);
+			if (step.kind == InputStep::Kind::UPDATE ? step.click.has_value() : step.input.has_value())
+			{
+				tag |= HAS_DATA;
+			}
+			if (step.input && step.input->mouseMoved)
+			{
+				tag |= MOUSE_MOVED;
+			}
+			out.write_u8(tag);
+
+			switch (step.kind)
+			{
+
+			case InputStep::Kind::UPDATE:
+			{
+				out.write_u16(step.key < 0 ? NO_KEY : static_cast<uint16_t>(step.key));
+				if (step.click)
+				{
+					write_i16(out, step.click->x);
+					write_i16(out, step.click->y);
+				}
+				break;
+			}
+
+			case InputStep::Kind::MENU:
+			{
+				if (step.input)
+				{
+					out.write_u8(static_cast<uint8_t>(step.input->key));
+					out.write_u32(static_cast<uint32_t>(step.input->charInput));
+					write_i16(out, step.input->mouse.x);
+					write_i16(out, step.input->mouse.y);
+				}
+				break;
+			}
+
+			case InputStep::Kind::VIEW:
+			{
+				out.write_u16(static_cast<uint16_t>(step.view.tileSize));
+				out.write_u16(static_cast<uint16_t>(step.view.width));
+				out.write_u16(static_cast<uint16_t>(step.view.height));
+				break;
+			}
+
+			case InputStep::Kind::DISMISS_MENUS:
+			{
+				break;
+			}
+
+			}
+		}
+	}
+
+	std::vector<InputStep> decode_steps(BinaryReader& in, uint32_t count)
+	{
+		std::vector<InputStep> steps;
+		steps.reserve(count);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const uint8_t tag = in.read_u8();
+			if ((tag & KIND_MASK) > static_cast<uint8_t>(InputStep::Kind::VIEW))
+			{
+				throw std::runtime_error("Input recording holds an unknown step.");
+			}
+			InputStep step;
+			step.kind = static_cast<InputStep::Kind>(tag & KIND_MASK);
+
+			switch (step.kind)
+			{
+
+			case InputStep::Kind::UPDATE:
+			{
+				const uint16_t key = in.read_u16();
+				step.key = key == NO_KEY ? -1 : key;
+				if (tag & HAS_DATA)
+				{
+					const int x = read_i16(in);
+					const int y = read_i16(in);
+					step.click = Vector2D{ x, y };
+				}
+				break;
+			}
+
+			case InputStep::Kind::MENU:
+			{
+				if (tag & HAS_DATA)
+				{
+					InputEvent event;
+					const uint8_t key = in.read_u8();
+					if (key > static_cast<uint8_t>(LAST_GAME_KEY))
+					{
+						throw std::runtime_error("Input recording holds an unknown key.");
+					}
+					event.key = static_cast<GameKey>(key);
+					event.charInput = static_cast<int>(in.read_u32());
+					event.mouse.x = read_i16(in);
+					event.mouse.y = read_i16(in);
+					event.mouseMoved = (tag & MOUSE_MOVED) != 0;
+					step.input = event;
+				}
+				break;
+			}
+
+			case InputStep::Kind::VIEW:
+			{
+				step.view.tileSize = in.read_u16();
+				step.view.width = in.read_u16();
+				step.view.height = in.read_u16();
+				break;
+			}
+
+			case InputStep::Kind::DISMISS_MENUS:
+			{
+				break;
+			}
+
+			}
+			steps.push_back(step);
+		}
+		return steps;
+	}
+
+	class Fnv1a
+	{
+	public:
+		void add(uint64_t value) noexcept
+		{
+			for (int i = 0; i < 8; ++i)
+			{
+				hash = (hash ^ ((value >> (8 * i)) & 0xFF)) * PRIME;
+			}
+		}
+
+		void add(int value) noexcept { add(static_cast<uint64_t>(static_cast<int64_t>(value))); }
+
+		void add(std::string_view text) noexcept
+		{
+			for (const char c : text)
+			{
+				hash = (hash ^ static_cast<uint8_t>(c)) * PRIME;
+			}
+			add(static_cast<uint64_t>(text.size()));
+		}
+
+		[[nodiscard]] uint64_t value() const noexcept { return hash; }
+
+	private:
+		static constexpr uint64_t PRIME = 0x100000001b3ULL;
+		uint64_t hash{ 0xcbf29ce484222325ULL };
+	};
+} // namespace
+
+void InputRecording::write_file(const std::filesystem::path& path) const
+{
+	BinaryWriter stepBytes;
+	encode_steps(steps, stepBytes);
+	const std::vector<uint8_t> packed = LzCodec::compress(stepBytes.data());
+
+	BinaryWriter out;
+	out.write_bytes(MAGIC);
+	out.write_u32(VERSION);
+	out.write_u64(seed);
+	out.write_string(blueprint.gender);
+	out.write_string(blueprint.name);
+	out.write_string(blueprint.playerClass);
+	out.write_string(blueprint.playerRace);
+	out.write_u64(checksum);
+	out.write_u32(static_cast<uint32_t>(steps.size()));
+	out.write_u32(static_cast<uint32_t>(stepBytes.size()));
+	out.write_u32(static_cast<uint32_t>(packed.size()));
+	out.write_bytes(packed);
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(out.data().data()), static_cast<std::streamsize>(out.size()));
+	if (!file)
+	{
+		throw std::runtime_error("Could not write input recording " + path.string());
+	}
+}
+
+InputRecording InputRecording::read_file(const std::filesystem::path& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		throw std::runtime_error("Could not open input recording " + path.string());
+	}
+	const std::vector<uint8_t> bytes{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+	BinaryReader in(bytes);
+	const std::span<const uint8_t> magic = in.read_bytes(MAGIC.size());
+	if (!std::equal(magic.begin(), magic.end(), MAGIC.begin()) || in.read_u32() != VERSION)
+	{
+		throw std::runtime_error(path.string() + " is not an input recording");
+	}
+
+	InputRecording recording;
+	recording.seed = in.read_u64();
+	recording.blueprint.gender = in.read_string();
+	recording.blueprint.name = in.read_string();
+	recording.blueprint.playerClass = in.read_string();
+	recording.blueprint.playerRace = in.read_string();
+	recording.checksum = in.read_u64();
+	const uint32_t stepCount = in.read_u32();
+	const uint32_t rawSize = in.read_u32();
+	const uint32_t packedSize = in.read_u32();
+
+	std::vector<uint8_t> stepBytes(rawSize);
+	if (!LzCodec::decompress(in.read_bytes(packedSize), stepBytes))
+	{
+		throw std::runtime_error(path.string() + ": corrupt input steps");
+	}
+	BinaryReader steps(stepBytes);
+	recording.steps = decode_steps(steps, stepCount);
+	return recording;
+}
+
+uint64_t state_checksum(const GameContext& ctx)
+{
+	Fnv1a hash;
+	if (ctx.gameState)
+	{
+		hash.add(ctx.gameState->get_time());
+	}
+	if (ctx.levelManager)
+	{
+		hash.add(ctx.levelManager->get_dungeon_level());
+	}
+	if (ctx.map)
+	{
+		hash.add(static_cast<uint64_t>(ctx.map->get_seed()));
+	}
+	if (ctx.player)
+	{
+		hash.add(ctx.player->position.x);
+		hash.add(ctx.player->position.y);
+		hash.add(ctx.player->get_hp());
+		hash.add(ctx.player->get_gold());
+		for (int slot = 0; slot < static_cast<int>(EquipmentSlot::NONE); ++slot)
+		{
+			const Item* equipped = ctx.player->get_equipped_item(static_cast<EquipmentSlot>(slot));
+			hash.add(equipped ? std::string_view{ equipped->itemKey } : std::string_view{});
+		}
+		hash.add(static_cast<uint64_t>(ctx.player->inventoryData.items.size()));
+	}
+	if (ctx.creatures)
+	{
+		for (const auto& creature : *ctx.creatures)
+		{
+			if (creature)
+			{
+				hash.add(creature->position.x);
+				hash.add(creature->position.y);
+				hash.add(creature->get_hp());
+			}
+		}
+	}
+	if (ctx.floorInventory)
+	{
+		hash.add(static_cast<uint64_t>(ctx.floorInventory->items.size()));
+	}
+	if (ctx.dice)
+	{
+		for (size_t i = 0; i < RandomDice::STREAM_COUNT; ++i)
+		{
+			hash.add(ctx.dice->get_rng(static_cast<RngStream>(i)).get_state());
+		}
+	}
+	return hash.value();
+}
+
+void InputRecorder::begin(GameContext& ctx)
+{
+	if (!is_enabled() || !ctx.dice)
+	{
+		return;
+	}
+	finish(ctx);
+
+	// Drawn from the dice so a seeded session records the same games.
+	Pcg32& rng = ctx.dice->get_rng();
+	const uint64_t seed = (static_cast<uint64_t>(rng()) << 32) | rng();
+	ctx.dice->reseed(seed);
+
+	recording.emplace();
+	recording->seed = seed;
+	++games;
+	view = MenuView{};
+	if (ctx.playerBlueprint)
+	{
+		recording->blueprint = *ctx.playerBlueprint;
+	}
+}
+
+void InputRecorder::record_step(const InputHandler& input)
+{
+	if (recording)
+	{
+		recording->steps.push_back(InputStep{ input.get_current_key(), input.get_click_tile() });
+	}
+}
+
+void InputRecorder::begin_menu_frame(const GameContext& ctx)
+{
+	menuFrame.reset();
+	if (!recording || !ctx.inputSystem)
+	{
+		return;
+	}
+	menuFrame = MenuFrame{ games, ctx.inputSystem->get_poll_count() };
+
+	if (ctx.renderer)
+	{
+		const MenuView current{
+			ctx.renderer->get_tile_size(),
+			ctx.renderer->get_screen_width(),
+			ctx.renderer->get_screen_height()
+		};
+		if (current != view)
+		{
+			view = current;
+			recording->steps.push_back(InputStep{ .kind = InputStep::Kind::VIEW, .view = current });
+		}
+	}
+}
+
+void InputRecorder::record_menu_frame(const GameContext& ctx)
+{
+	if (!recording || !menuFrame || menuFrame->game != games || !ctx.inputSystem)
+	{
+		return;
+	}
+	// A menu polls at most once a frame; a frame that did not poll still
+	// runs, and replays, its menu.
+	InputStep step{ .kind = InputStep::Kind::MENU };
+	if (ctx.inputSystem->get_poll_count() != menuFrame->polls)
+	{
+		step.input = ctx.inputSystem->last_event();
+	}
+	recording->steps.push_back(step);
+	menuFrame.reset();
+}
+
+void InputRecorder::record_menus_dismissed()
+{
+	if (recording)
+	{
+		recording->steps.push_back(InputStep{ .kind = InputStep::Kind::DISMISS_MENUS });
+	}
+}
+
+bool InputRecorder::finish(const GameContext& ctx)
+{
+	if (!recording)
+	{
+		return false;
+	}
+	recording->checksum = state_checksum(ctx);
+	// Idle first: a failed write must not leave a recording that keeps growing.
+	const InputRecording done = std::move(*recording);
+	recording.reset();
+	try
+	{
+		done.write_file(output);
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		Logger::instance().print<LogLevel::LOG_ERROR>("Input recording not written: {}", e.what());
+		return false;
+	}
+}
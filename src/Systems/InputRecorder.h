@@ -0,0 +1,133 @@
+#pragma once
+// InputRecorder.h -- records a game's seed and input for exact replays.
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "../Core/GameContext.h"
+#include "../Renderer/InputSystem.h"
+#include "../Utils/Vector2D.h"
+
+class InputHandler;
+
+// The tile and window size a menu laid itself out in, in pixels.
+struct MenuView
+{
+	int tileSize{ 0 };
+	int width{ 0 };
+	int height{ 0 };
+
+	friend bool operator==(const MenuView&, const MenuView&) = default;
+};
+
+// One recorded step, in the order the game took them.
+struct InputStep
+{
+	enum class Kind : uint8_t
+	{
+		UPDATE, // GameLoopCoordinator::update: key and click
+		MENU, // MenuManager::handle_menus: what the top menu polled, if it did
+		DISMISS_MENUS, // HeadlessRunner::run dropped menus nothing could answer
+		VIEW, // the tile or window size changed before the next menu frame
+	};
+
+	// UPDATE: the InputHandler key (-1 for a mouse-path step) and the world
+	// tile a click resolved to.
+	int key{ -1 };
+	std::optional<Vector2D> click{};
+	Kind kind{ Kind::UPDATE };
+	std::optional<InputEvent> input{}; // MENU
+	MenuView view{}; // VIEW
+
+	friend bool operator==(const InputStep&, const InputStep&) = default;
+};
+
+// ---------------------------------------------------------------------------
+// InputRecording -- a recorded game: the master seed the dice were reset to
+// when it began, the character it was started with, every update's and
+// menu frame's input and a checksum of the state the game ended in.
+//
+// On disk: magic, version, the header fields, then the steps as one LZ
+// block -- a tag byte per step, then two bytes for a key, four for a click
+// and ten for a menu poll -- so long walks and idle menu frames pack to
+// almost nothing.
+// ---------------------------------------------------------------------------
+struct InputRecording
+{
+	static constexpr uint32_t VERSION = 2;
+
+	uint64_t seed{ 0 };
+	PlayerBlueprint blueprint{};
+	std::vector<InputStep> steps;
+	uint64_t checksum{ 0 };
+
+	// Throw std::runtime_error when the file cannot be written or read, or
+	// is not a recording.
+	void write_file(const std::filesystem::path& path) const;
+	[[nodiscard]] static InputRecording read_file(const std::filesystem::path& path);
+};
+
+// FNV-1a over the state a diverging replay would disturb first: turn,
+// dungeon level, map seed, player and creature positions and hit points,
+// the player's equipment and backpack size, floor item count and every
+// dice stream's position.
+[[nodiscard]] uint64_t state_checksum(const GameContext& ctx);
+
+// ---------------------------------------------------------------------------
+// InputRecorder -- builds an InputRecording while the game is played.
+//
+// Idle until given an output path. Each new game then reseeds the dice
+// from their current state and starts a recording; the previous one is
+// written out first. Loading a save ends the recording, since a replay
+// starts from a new game.
+//
+// Menus read the InputSystem themselves, so each MenuManager::handle_menus
+// call is a step of its own holding what the top menu polled; the view
+// size is recorded whenever it changes, since menus hit-test the mouse in
+// pixels. Menu frames from before a game began -- the title and character
+// menus -- are not recorded.
+// ---------------------------------------------------------------------------
+class InputRecorder
+{
+public:
+	void set_output(std::filesystem::path path) { output = std::move(path); }
+	[[nodiscard]] bool is_enabled() const noexcept { return !output.empty(); }
+	[[nodiscard]] bool is_recording() const noexcept { return recording.has_value(); }
+
+	// GameStateManager::init_new_game, before anything rolls.
+	void begin(GameContext& ctx);
+
+	// After each GameLoopCoordinator::update.
+	void record_step(const InputHandler& input);
+
+	// On each side of a menu frame in MenuManager::handle_menus. A frame
+	// that begins or ends the recording is left out of it.
+	void begin_menu_frame(const GameContext& ctx);
+	void record_menu_frame(const GameContext& ctx);
+
+	// HeadlessRunner::run, when it drops menus nothing can answer.
+	void record_menus_dismissed();
+
+	// Writes the recording with the current state's checksum, then idles
+	// until the next begin. Returns false when not recording or the file
+	// could not be written; a failed write is logged, not thrown.
+	bool finish(const GameContext& ctx);
+
+	[[nodiscard]] const std::optional<InputRecording>& current() const noexcept { return recording; }
+
+private:
+	struct MenuFrame
+	{
+		uint32_t game{ 0 };
+		uint64_t polls{ 0 };
+	};
+
+	std::filesystem::path output;
+	std::optional<InputRecording> recording;
+	uint32_t games{ 0 }; // begin calls, telling one recording from the next
+	std::optional<MenuFrame> menuFrame;
+	MenuView view{}; // the last one recorded
+};
@@ -4,6 +4,8 @@
 
 #include "../../Items/ItemIdentification.h"
 
+class RandomDice;
+
 enum class PrefixType
 {
 	NONE,
@@ -100,18 +102,18 @@ struct ItemEnhancement
 	void apply_enhancement_effects();
 
 	// Enhancement generation
-	static ItemEnhancement generate_random_enhancement(bool allowMagical);
-	static ItemEnhancement generate_weapon_enhancement();
-	static ItemEnhancement generate_armor_enhancement();
+	static ItemEnhancement generate_random_enhancement(bool allowMagical, RandomDice& dice);
+	static ItemEnhancement generate_weapon_enhancement(RandomDice& dice);
+	static ItemEnhancement generate_armor_enhancement(RandomDice& dice);
 
 	// Rarity-based generation
-	static ItemEnhancement generate_by_rarity(int rarity_level); // 1-5
+	static ItemEnhancement generate_by_rarity(int rarity_level, RandomDice& dice); // 1-5
 
 private:
-	static PrefixType get_random_weapon_prefix();
-	static PrefixType get_random_armor_prefix();
-	static PrefixType get_random_universal_prefix();
-	static SuffixType get_random_combat_suffix();
-	static SuffixType get_random_resistance_suffix();
-	static SuffixType get_random_special_suffix();
+	static PrefixType get_random_weapon_prefix(RandomDice& dice);
+	static PrefixType get_random_armor_prefix(RandomDice& dice);
+	static PrefixType get_random_universal_prefix(RandomDice& dice);
+	static SuffixType get_random_combat_suffix(RandomDice& dice);
+	static SuffixType get_random_resistance_suffix(RandomDice& dice);
+	static SuffixType get_random_special_suffix(RandomDice& dice);
 };
@@ -1,17 +1,22 @@
 // LevelManager.cpp - Handles dungeon level progression and level-specific state
 #include <format>
+#include <limits>
 
 #include <nlohmann/json.hpp>
 
 #include "../ActorTypes/Player.h"
 #include "../Colors/Colors.h"
 #include "../Core/GameContext.h"
+#include "../Map/LevelGenerator.h"
 #include "../Map/Map.h"
+#include "../Random/RandomDice.h"
 #include "../Systems/MessageSystem.h"
 #include "LevelManager.h"
 
 void LevelManager::advance_to_next_level(GameContext& ctx)
 {
+	const long seed = get_next_level_seed(*ctx.dice);
+	next_level_seed = NO_SEED;
 	dungeon_level++;
 	shopkeepers_on_current_level = 0; // Reset shopkeeper counter for new level
 
@@ -21,14 +26,31 @@ void LevelManager::advance_to_next_level(GameContext& ctx)
 	// Heal player between levels
 	heal_player_between_levels(ctx);
 
-	// Regenerate the map for new level
-	ctx.map->regenerate(ctx);
+	// Build the new level, or take the one LevelGenerator prepared
+	if (ctx.levelGenerator)
+	{
+		ctx.levelGenerator->enter_level(ctx, dungeon_level, seed);
+	}
+	else
+	{
+		ctx.map->regenerate(ctx);
+	}
 }
 
 void LevelManager::reset_to_first_level()
 {
 	dungeon_level = 1;
 	shopkeepers_on_current_level = 0;
+	next_level_seed = NO_SEED;
+}
+
+long LevelManager::get_next_level_seed(RandomDice& dice)
+{
+	if (next_level_seed == NO_SEED)
+	{
+		next_level_seed = dice.mapgen().roll(0, std::numeric_limits<int>::max());
+	}
+	return next_level_seed;
 }
 
 bool LevelManager::can_spawn_shopkeeper(int max_shopkeepers) const noexcept
@@ -40,12 +62,14 @@ void LevelManager::save_to_json(nlohmann::json& j) const
 {
 	j["level_manager"] = {
 		{ "dungeonLevel", dungeon_level },
-		{ "shopkeepersOnCurrentLevel", shopkeepers_on_current_level }
+		{ "shopkeepersOnCurrentLevel", shopkeepers_on_current_level },
+		{ "nextLevelSeed", next_level_seed }
 	};
 }
 
 void LevelManager::load_from_json(const nlohmann::json& j)
 {
+	next_level_seed = NO_SEED; // older saves roll it on first use
 	if (j.contains("level_manager"))
 	{
 		const auto& level_data = j["level_manager"];
@@ -59,6 +83,8 @@ void LevelManager::load_from_json(const nlohmann::json& j)
 		{
 			shopkeepers_on_current_level = level_data["shopkeepersOnCurrentLevel"];
 		}
+
+		next_level_seed = level_data.value("nextLevelSeed", NO_SEED);
 	}
 	// Legacy support - check old format
 	else
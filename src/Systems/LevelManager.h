@@ -6,6 +6,7 @@
 class Map;
 class Player;
 class MessageSystem;
+class RandomDice;
 struct GameContext;
 
 // - Handles dungeon level progression and level-specific state
@@ -15,6 +16,13 @@ public:
 	// Level state
 	int get_dungeon_level() const noexcept { return dungeon_level; }
 	int get_shopkeepers_count() const noexcept { return shopkeepers_on_current_level; }
+	void set_dungeon_level(int level) noexcept { dungeon_level = level; }
+	void set_shopkeepers_count(int count) noexcept { shopkeepers_on_current_level = count; }
+
+	// Seed of the level below, rolled on first use. Saved with the level so
+	// a reloaded game descends into the same level, and known in advance so
+	// LevelGenerator can build that level before the player gets there.
+	long get_next_level_seed(RandomDice& dice);
 
 	// Level management
 	void advance_to_next_level(GameContext& ctx);
@@ -29,8 +37,11 @@ public:
 	void load_from_json(const nlohmann::json& j);
 
 private:
+	static constexpr long NO_SEED = -1;
+
 	int dungeon_level{ 1 };
 	int shopkeepers_on_current_level{ 0 };
+	long next_level_seed{ NO_SEED };
 
 	// Helper methods
 	void display_level_messages(MessageSystem& message_system) const;
@@ -69,7 +69,7 @@ void apply_thac0_improvement(Creature& owner, int newLevel, GameContext* ctx)
             ctx->messageSystem->finalize_message();
         }
 
-        ctx->messageSystem->log(std::format("THAC0 improved: {} -> {}", oldTHAC0, newTHAC0));
+        ctx->messageSystem->debug("THAC0 improved: {} -> {}", oldTHAC0, newTHAC0);
     }
 }
 
@@ -142,11 +142,11 @@ int apply_hit_point_gain(Creature& owner, int newLevel, GameContext* ctx)
         ctx->messageSystem->finalize_message();
     }
 
-    ctx->messageSystem->log(std::format("HP increased by {} ({} rolled + {} CON bonus). Max HP now: {}",
+    ctx->messageSystem->debug("HP increased by {} ({} rolled + {} CON bonus). Max HP now: {}",
         totalHPGain,
         hitDiceRoll,
         conBonus,
-        owner.get_max_hp()));
+        owner.get_max_hp());
 
     return totalHPGain;
 }
@@ -205,7 +205,7 @@ void apply_rogue_improvements(Creature& owner, int newLevel, GameContext* ctx)
         ctx->messageSystem->append_message_part(WHITE_BLACK_PAIR, " Damage multiplier: x");
         ctx->messageSystem->append_message_part(GREEN_BLACK_PAIR, std::to_string(backstabMultiplier));
         ctx->messageSystem->finalize_message();
-        ctx->messageSystem->log(std::format("Rogue backstab multiplier increased to x{}", backstabMultiplier));
+        ctx->messageSystem->debug("Rogue backstab multiplier increased to x{}", backstabMultiplier);
     }
 
     if (newLevel % 2 == 0)
@@ -228,7 +228,7 @@ void apply_cleric_improvements(Creature& owner, int newLevel, GameContext* ctx)
         ctx->messageSystem->append_message_part(GREEN_BLACK_PAIR, "Turn Undead improved!");
         ctx->messageSystem->append_message_part(WHITE_BLACK_PAIR, " You can affect more powerful undead.");
         ctx->messageSystem->finalize_message();
-        ctx->messageSystem->log(std::format("Cleric turn undead ability improved at level {}", newLevel));
+        ctx->messageSystem->debug("Cleric turn undead ability improved at level {}", newLevel);
     }
 
     if (newLevel >= 2)
@@ -256,7 +256,7 @@ void apply_wizard_improvements(Creature& owner, int newLevel, GameContext* ctx)
             ctx->messageSystem->append_message_part(GREEN_BLACK_PAIR, std::to_string(spellLevel));
             ctx->messageSystem->append_message_part(WHITE_BLACK_PAIR, " spells.");
             ctx->messageSystem->finalize_message();
-            ctx->messageSystem->log(std::format("Wizard can now cast level {} spells", spellLevel));
+            ctx->messageSystem->debug("Wizard can now cast level {} spells", spellLevel);
         }
     }
 
@@ -360,7 +360,7 @@ void apply_ability_score_improvement(Creature& owner, int newLevel, GameContext*
     }
     }
 
-    ctx->messageSystem->log(std::format("Ability score improved at level {}", newLevel));
+    ctx->messageSystem->debug("Ability score improved at level {}", newLevel);
 }
 
 void apply_saving_throw_improvements(Creature& owner, int newLevel, GameContext* ctx)
@@ -412,7 +412,7 @@ void apply_saving_throw_improvements(Creature& owner, int newLevel, GameContext*
             ctx->messageSystem->append_message_part(WHITE_BLACK_PAIR, "Saving throws improved!");
             ctx->messageSystem->finalize_message();
         }
-        ctx->messageSystem->log(std::format("Saving throws improved at level {}", newLevel));
+        ctx->messageSystem->debug("Saving throws improved at level {}", newLevel);
     }
 }
 
@@ -458,11 +458,11 @@ void apply_level_up_benefits(Creature& owner, int newLevel, GameContext* ctx)
                 std::format("THAC0 {}->{}", oldTHAC0, owner.get_thaco()));
         }
         ctx->messageSystem->finalize_message();
-        ctx->messageSystem->log(std::format("Level {} reached! Combat abilities improved.", newLevel));
+        ctx->messageSystem->debug("Level {} reached! Combat abilities improved.", newLevel);
     }
     else
     {
-        ctx->messageSystem->log(std::format("{} reaches level {}.", owner.actorData.name, newLevel));
+        ctx->messageSystem->debug("{} reaches level {}.", owner.actorData.name, newLevel);
     }
 }
 
@@ -0,0 +1,132 @@
+// Logger.cpp -- writer thread and direct fallback for the debug log.
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "Logger.h"
+
+Logger& Logger::instance()
+{
+	static Logger logger;
+	return logger;
+}
+
+Logger::Logger()
+{
+#ifndef EMSCRIPTEN
+	running.store(true, std::memory_order_release);
+	writer = std::thread([this] { run(); });
+#endif
+}
+
+Logger::~Logger()
+{
+	shutdown();
+}
+
+void Logger::write(LogLevel level, std::string text)
+{
+	if (!running.load(std::memory_order_acquire))
+	{
+		std::lock_guard lock(directMutex);
+		emit(level, text);
+		return;
+	}
+
+	if (!ring.try_push(level, text))
+	{
+		dropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	queued.fetch_add(1, std::memory_order_release);
+	wakeups.fetch_add(1, std::memory_order_release);
+	wakeups.notify_one();
+}
+
+void Logger::flush()
+{
+	if (!running.load(std::memory_order_acquire))
+	{
+		std::lock_guard lock(directMutex);
+		std::clog.flush();
+		return;
+	}
+
+	const uint64_t target = queued.load(std::memory_order_acquire);
+	uint64_t done = written.load(std::memory_order_acquire);
+	while (done < target && running.load(std::memory_order_acquire))
+	{
+		written.wait(done, std::memory_order_acquire);
+		done = written.load(std::memory_order_acquire);
+	}
+}
+
+void Logger::shutdown()
+{
+	if (!running.exchange(false, std::memory_order_acq_rel))
+	{
+		return;
+	}
+	wakeups.fetch_add(1, std::memory_order_release);
+	wakeups.notify_one();
+	if (writer.joinable())
+	{
+		writer.join();
+	}
+
+	// Lines pushed while the writer was stopping; this thread is the only consumer now.
+	std::lock_guard lock(directMutex);
+	drain();
+}
+
+void Logger::run()
+{
+	for (;;)
+	{
+		const uint32_t seen = wakeups.load(std::memory_order_acquire);
+		{
+			std::lock_guard lock(directMutex);
+			drain();
+		}
+		if (!running.load(std::memory_order_acquire))
+		{
+			return;
+		}
+		wakeups.wait(seen, std::memory_order_acquire);
+	}
+}
+
+// One flush per batch: a burst of lines costs one write to the file.
+void Logger::drain()
+{
+	LogLevel level{};
+	std::string line;
+	uint64_t count = 0;
+	while (ring.try_pop(level, line))
+	{
+		emit(level, line);
+		++count;
+	}
+	if (count > 0)
+	{
+		std::clog.flush();
+		written.fetch_add(count, std::memory_order_release);
+		written.notify_all();
+	}
+}
+
+void Logger::emit(LogLevel level, std::string_view text) const
+{
+	const std::string_view prefix = level >= LogLevel::LOG_ERROR ? "[error] "
+		: level == LogLevel::LOG_WARN ? "[warn] "
+		: "";
+	std::clog << prefix << text << '\n';
+	if (echo.load(std::memory_order_relaxed))
+	{
+		std::cout << prefix << text << '\n';
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+// Logger.h -- levelled debug log, written to disk by a background thread.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "../Utils/LogRing.h"
+
+enum class LogLevel : uint8_t
+{
+	LOG_TRACE, // per-frame chatter
+	LOG_DEBUG, // per-turn detail (MessageSystem::log)
+	LOG_INFO,
+	LOG_WARN,
+	LOG_ERROR,
+	LOG_OFF,
+};
+
+// Lowest level compiled in. Sites below it are removed by if constexpr, so
+// their arguments are never evaluated. Release builds keep INFO and above;
+// define LOG_COMPILED_LEVEL (0 = trace .. 5 = off) to override.
+#ifndef LOG_COMPILED_LEVEL
+#ifdef NDEBUG
+#define LOG_COMPILED_LEVEL 2
+#else
+#define LOG_COMPILED_LEVEL 0
+#endif
+#endif
+inline constexpr LogLevel COMPILED_LOG_LEVEL = static_cast<LogLevel>(LOG_COMPILED_LEVEL);
+
+// ---------------------------------------------------------------------------
+// Logger -- process-wide sink behind MessageSystem::log and the startup log.
+//
+// A log call checks the level first (compile time, then one relaxed atomic
+// load) and only then formats. The finished line goes into a LogRing and a
+// writer thread drains it to std::clog (the log file once main redirects
+// it) and, with echo on, std::cout. The game thread never touches the file
+// or the console. If the ring is full the line is dropped and counted
+// rather than stalling a frame. Once shutdown() has run, or where there are
+// no threads (Emscripten), lines are written synchronously instead.
+//
+// The writer is the only thread that writes std::clog; code that used to
+// write std::clog directly goes through here.
+// ---------------------------------------------------------------------------
+class Logger
+{
+public:
+	static constexpr size_t RING_CAPACITY = 4096;
+
+	static Logger& instance();
+
+	Logger(const Logger&) = delete;
+	Logger& operator=(const Logger&) = delete;
+
+	[[nodiscard]] bool is_enabled(LogLevel level) const noexcept
+	{
+		return level >= COMPILED_LOG_LEVEL && level >= runtimeLevel.load(std::memory_order_relaxed);
+	}
+	void set_level(LogLevel level) noexcept { runtimeLevel.store(level, std::memory_order_relaxed); }
+	[[nodiscard]] LogLevel get_level() const noexcept { return runtimeLevel.load(std::memory_order_relaxed); }
+
+	// Also copy every line to std::cout (on by default, as the old log did).
+	void set_echo(bool enabled) noexcept { echo.store(enabled, std::memory_order_relaxed); }
+
+	// Queues a finished line. Callers check is_enabled first.
+	void write(LogLevel level, std::string text);
+
+	template <LogLevel Level>
+	void print(std::string_view text)
+	{
+		if constexpr (Level >= COMPILED_LOG_LEVEL)
+		{
+			if (is_enabled(Level))
+			{
+				write(Level, std::string(text));
+			}
+		}
+	}
+
+	template <LogLevel Level, typename... Args>
+	void print(std::format_string<Args...> fmt, Args&&... args)
+	{
+		if constexpr (Level >= COMPILED_LOG_LEVEL)
+		{
+			if (is_enabled(Level))
+			{
+				write(Level, std::format(fmt, std::forward<Args>(args)...));
+			}
+		}
+	}
+
+	// Blocks until every line queued so far has been written out.
+	void flush();
+
+	// Drains the ring and stops the writer; later lines are written directly.
+	// main calls this before it closes the file std::clog points at.
+	void shutdown();
+
+	[[nodiscard]] uint64_t get_dropped_count() const noexcept { return dropped.load(std::memory_order_relaxed); }
+
+private:
+	Logger();
+	~Logger();
+
+	void run();
+	void emit(LogLevel level, std::string_view text) const;
+	void drain(); // caller holds directMutex
+
+	LogRing<LogLevel> ring{ RING_CAPACITY };
+	std::atomic<LogLevel> runtimeLevel{ LogLevel::LOG_DEBUG };
+	std::atomic<bool> echo{ true };
+	std::atomic<bool> running{ false };
+	std::atomic<uint64_t> queued{ 0 };
+	std::atomic<uint64_t> written{ 0 };
+	std::atomic<uint64_t> dropped{ 0 };
+	std::atomic<uint32_t> wakeups{ 0 };
+	std::mutex directMutex; // held by whoever writes std::clog: the writer, or direct writes
+
+	std::thread writer;
+};
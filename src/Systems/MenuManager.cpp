@@ -4,6 +4,7 @@
 #include "../Core/GameContext.h"
 #include "../Menu/BaseMenu.h"
 #include "../Systems/RenderingManager.h"
+#include "InputRecorder.h"
 #include "MenuManager.h"
 
 void MenuManager::handle_menus(std::deque<std::unique_ptr<BaseMenu>>& menus, GameContext& ctx)
@@ -12,7 +13,15 @@ void MenuManager::handle_menus(std::deque<std::unique_ptr<BaseMenu>>& menus, Gam
 	{
 		bool menuWasPopped = false;
 
+		if (ctx.inputRecorder)
+		{
+			ctx.inputRecorder->begin_menu_frame(ctx);
+		}
 		menus.back()->menu(ctx);
+		if (ctx.inputRecorder)
+		{
+			ctx.inputRecorder->record_menu_frame(ctx);
+		}
 		// if back is pressed, pop the menu
 		if (menus.back()->back)
 		{
@@ -1,4 +1,3 @@
-#include <iostream>
 #include <string>
 
 #include "../Gui/Gui.h"
@@ -26,8 +25,8 @@ void MessageSystem::message(int color, std::string_view text, bool isComplete)
         attackMessageParts.clear();
     }
 
-    log("Stored message: '" + messageToDisplay + "'");
-    log("Stored message color: " + std::to_string(messageColor));
+    debug("Stored message: '{}'", messageToDisplay);
+    debug("Stored message color: {}", messageColor);
 }
 
 void MessageSystem::append_message_part(int color, std::string_view text)
@@ -53,19 +52,10 @@ void MessageSystem::transfer_messages_to_gui(Gui& gui)
     attackMessagesWhole.clear();
 }
 
-void MessageSystem::log(std::string_view message) const
-{
-    if (debugMode)
-    {
-        std::clog << message << "\n";
-        std::cout << message << "\n";
-    }
-}
-
 void MessageSystem::display_debug_messages() const noexcept
 {
     // Scrollable debug log viewer — not yet ported from curses to Raylib.
-    // The log() function already streams to std::clog / std::cout in debug mode.
+    // log() already reaches std::clog / std::cout through Logger in debug mode.
     // When implemented: read log file and render via ctx.renderer with scroll support.
     log("display_debug_messages: debug viewer not yet implemented for Raylib");
 }
@@ -1,9 +1,14 @@
 #pragma once
 
+#include <cstddef>
+#include <format>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "../Gui/LogMessage.h"
+#include "Logger.h"
 
 class Gui;
 
@@ -24,18 +29,39 @@ public:
 	void finalize_message();
 	void transfer_messages_to_gui(Gui& gui);
 
-	// Debug logging
-	void log(std::string_view message) const;
+	// Debug logging. log() and debug() are LOG_DEBUG, trace() is for
+	// per-frame lines; all are compiled out below COMPILED_LOG_LEVEL and
+	// format their arguments only when the level is enabled. log() takes a
+	// string literal only: a message built with + or std::to_string would be
+	// paid for with the level off, so anything carrying values uses debug().
+	template <size_t N>
+	void log(const char (&message)[N]) const
+	{
+		Logger::instance().print<LogLevel::LOG_DEBUG>(std::string_view{ message, N - 1 });
+	}
+
+	template <typename... Args>
+	void trace(std::format_string<Args...> fmt, Args&&... args) const
+	{
+		Logger::instance().print<LogLevel::LOG_TRACE>(fmt, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void debug(std::format_string<Args...> fmt, Args&&... args) const
+	{
+		Logger::instance().print<LogLevel::LOG_DEBUG>(fmt, std::forward<Args>(args)...);
+	}
+
 	void display_debug_messages() const noexcept;
 
 	// Getters for current message state
 	const std::string& get_current_message() const noexcept { return messageToDisplay; }
 	int get_current_message_color() const noexcept { return messageColor; }
 
-	// Debug mode control
-	void enable_debug_mode() noexcept { debugMode = true; }
-	void disable_debug_mode() noexcept { debugMode = false; }
-	bool is_debug_mode() const noexcept { return debugMode; }
+	// Debug mode control: the logger's runtime level (process-wide)
+	void enable_debug_mode() noexcept { Logger::instance().set_level(LogLevel::LOG_DEBUG); }
+	void disable_debug_mode() noexcept { Logger::instance().set_level(LogLevel::LOG_INFO); }
+	bool is_debug_mode() const noexcept { return Logger::instance().is_enabled(LogLevel::LOG_DEBUG); }
 
 	// Get size of stored messages
 	size_t get_stored_message_count() const noexcept { return attackMessagesWhole.size(); }
@@ -52,7 +78,4 @@ private:
 	std::string messageToDisplay{ "Init Message" };
 	int messageColor{ 0 };
 
-	// Debug state
-	bool debugMode{ true };
-
 };
@@ -0,0 +1,317 @@
+// Profiler.cpp -- per-frame zone timings and counters in a ring of frames.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <new>
+#include <ostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "Profiler.h"
+
+namespace
+{
+	constinit std::atomic<int64_t> allocationCount{ 0 };
+
+	double to_us(int64_t ns) noexcept
+	{
+		return static_cast<double>(ns) / 1000.0;
+	}
+} // namespace
+
+#if PROFILER_ENABLED
+// Counting replacements for the global allocation functions. The array,
+// nothrow and sized forms all route here by default. On failure the
+// installed new-handler gets to free memory and retry, as the standard
+// operator new does; bad_alloc is thrown only when there is none.
+void* operator new(std::size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+	const std::size_t bytes = size == 0 ? 1 : size;
+	while (true)
+	{
+		if (void* p = std::malloc(bytes))
+		{
+			return p;
+		}
+		const std::new_handler handler = std::get_new_handler();
+		if (!handler)
+		{
+			throw std::bad_alloc{};
+		}
+		handler();
+	}
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+#endif
+
+int64_t profiler_allocation_count() noexcept
+{
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+std::string_view counter_name(ProfileCounter counter) noexcept
+{
+	switch (counter)
+	{
+
+	case ProfileCounter::DRAW_CALLS:
+	{
+		return "draw calls";
+	}
+
+	case ProfileCounter::FOV_CELLS:
+	{
+		return "fov cells";
+	}
+
+	case ProfileCounter::PATH_NODES:
+	{
+		return "path nodes";
+	}
+
+	case ProfileCounter::FLOW_CELLS:
+	{
+		return "flow cells";
+	}
+
+	case ProfileCounter::ALLOCATIONS:
+	{
+		return "allocations";
+	}
+
+	default:
+	{
+		return "?";
+	}
+
+	}
+}
+
+Profiler& Profiler::instance()
+{
+	static Profiler profiler;
+	return profiler;
+}
+
+// One slot more than the history: the open frame never overwrites a frame
+// that can still be read.
+Profiler::Profiler() : ring(FRAME_HISTORY + 1), origin(Clock::now())
+{
+}
+
+int64_t Profiler::now_ns() const noexcept
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - origin).count();
+}
+
+void Profiler::begin_frame() noexcept
+{
+	if (open)
+	{
+		end_frame();
+	}
+	if (!is_enabled())
+	{
+		return;
+	}
+	if (owner == std::thread::id{})
+	{
+		owner = std::this_thread::get_id();
+	}
+
+	open = &ring[closedFrames.load(std::memory_order_relaxed) % ring.size()];
+	open->index = begunFrames++;
+	open->zoneCount = 0;
+	open->droppedZones = 0;
+	open->counters.fill(0);
+	depth = 0;
+	for (std::atomic<int64_t>& counter : pending)
+	{
+		counter.store(0, std::memory_order_relaxed);
+	}
+	allocationsAtBegin = profiler_allocation_count();
+	open->startNs = now_ns();
+}
+
+void Profiler::end_frame() noexcept
+{
+	if (!open)
+	{
+		return;
+	}
+	open->durationNs = now_ns() - open->startNs;
+	for (size_t i = 0; i < pending.size(); ++i)
+	{
+		open->counters[i] = pending[i].exchange(0, std::memory_order_relaxed);
+	}
+	open->counters[static_cast<size_t>(ProfileCounter::ALLOCATIONS)] = profiler_allocation_count() - allocationsAtBegin;
+	open = nullptr;
+	closedFrames.fetch_add(1, std::memory_order_release);
+}
+
+uint32_t Profiler::begin_zone(const char* name) noexcept
+{
+	if (!open || std::this_thread::get_id() != owner)
+	{
+		return NO_ZONE;
+	}
+	if (open->zoneCount == ProfileFrame::MAX_ZONES)
+	{
+		++open->droppedZones;
+		return NO_ZONE;
+	}
+	const uint32_t slot = open->zoneCount++;
+	ProfileZone& zone = open->zones[slot];
+	zone.name = name;
+	zone.depth = depth++;
+	zone.durationNs = 0;
+	zone.startNs = now_ns();
+	return slot;
+}
+
+void Profiler::end_zone(uint32_t slot) noexcept
+{
+	// The frame may have closed (or been reset) since the zone began.
+	if (slot == NO_ZONE || !open || slot >= open->zoneCount)
+	{
+		return;
+	}
+	ProfileZone& zone = open->zones[slot];
+	zone.durationNs = now_ns() - zone.startNs;
+	depth = zone.depth;
+}
+
+size_t Profiler::frame_count() const noexcept
+{
+	return static_cast<size_t>(std::min<uint64_t>(closedFrames.load(std::memory_order_acquire), FRAME_HISTORY));
+}
+
+const ProfileFrame& Profiler::frame(size_t i) const noexcept
+{
+	const uint64_t closed = closedFrames.load(std::memory_order_acquire);
+	const uint64_t oldest = closed - std::min<uint64_t>(closed, FRAME_HISTORY);
+	return ring[(oldest + i) % ring.size()];
+}
+
+std::vector<ZoneTotal> Profiler::top_zones(size_t n, size_t frames) const
+{
+	std::vector<ZoneTotal> totals;
+	const size_t count = frame_count();
+	for (size_t i = count - std::min(frames, count); i < count; ++i)
+	{
+		const ProfileFrame& f = frame(i);
+		for (uint32_t z = 0; z < f.zoneCount; ++z)
+		{
+			const ProfileZone& zone = f.zones[z];
+			const std::string_view name = zone.name;
+			auto it = std::ranges::find(totals, name, &ZoneTotal::name);
+			if (it == totals.end())
+			{
+				totals.push_back(ZoneTotal{ name });
+				it = totals.end() - 1;
+			}
+			it->totalNs += zone.durationNs;
+			++it->calls;
+		}
+	}
+	std::ranges::sort(totals, std::ranges::greater{}, &ZoneTotal::totalNs);
+	if (totals.size() > n)
+	{
+		totals.resize(n);
+	}
+	return totals;
+}
+
+void Profiler::write_chrome_trace(std::ostream& out) const
+{
+	nlohmann::json events = nlohmann::json::array();
+	for (size_t i = 0; i < frame_count(); ++i)
+	{
+		const ProfileFrame& f = frame(i);
+		events.push_back({
+			{ "name", "frame" },
+			{ "ph", "X" },
+			{ "ts", to_us(f.startNs) },
+			{ "dur", to_us(f.durationNs) },
+			{ "pid", 1 },
+			{ "tid", 1 },
+			{ "args", { { "frame", f.index } } },
+		});
+		for (uint32_t z = 0; z < f.zoneCount; ++z)
+		{
+			const ProfileZone& zone = f.zones[z];
+			events.push_back({
+				{ "name", zone.name },
+				{ "ph", "X" },
+				{ "ts", to_us(zone.startNs) },
+				{ "dur", to_us(zone.durationNs) },
+				{ "pid", 1 },
+				{ "tid", 1 },
+			});
+		}
+		nlohmann::json counters = nlohmann::json::object();
+		for (size_t c = 0; c < f.counters.size(); ++c)
+		{
+			counters[std::string(counter_name(static_cast<ProfileCounter>(c)))] = f.counters[c];
+		}
+		events.push_back({
+			{ "name", "counters" },
+			{ "ph", "C" },
+			{ "ts", to_us(f.startNs) },
+			{ "pid", 1 },
+			{ "args", counters },
+		});
+	}
+	out << nlohmann::json{ { "traceEvents", events }, { "displayTimeUnit", "ms" } }.dump() << '\n';
+}
+
+void Profiler::write_csv(std::ostream& out) const
+{
+	out << "frame,kind,name,depth,start_us,duration_us,value\n";
+	for (size_t i = 0; i < frame_count(); ++i)
+	{
+		const ProfileFrame& f = frame(i);
+		out << std::format("{},frame,frame,,{:.3f},{:.3f},\n", f.index, to_us(f.startNs), to_us(f.durationNs));
+		for (uint32_t z = 0; z < f.zoneCount; ++z)
+		{
+			const ProfileZone& zone = f.zones[z];
+			out << std::format("{},zone,{},{},{:.3f},{:.3f},\n", f.index, zone.name, zone.depth, to_us(zone.startNs), to_us(zone.durationNs));
+		}
+		for (size_t c = 0; c < f.counters.size(); ++c)
+		{
+			if (f.counters[c] != 0)
+			{
+				out << std::format("{},counter,{},,,,{}\n", f.index, counter_name(static_cast<ProfileCounter>(c)), f.counters[c]);
+			}
+		}
+	}
+}
+
+void Profiler::reset() noexcept
+{
+	open = nullptr;
+	depth = 0;
+	begunFrames = 0;
+	closedFrames.store(0, std::memory_order_release);
+	for (std::atomic<int64_t>& counter : pending)
+	{
+		counter.store(0, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,190 @@
+#pragma once
+// Profiler.h -- per-frame zone timings and counters in a ring of frames.
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Zones and counters are compiled in unless PROFILER_ENABLED is 0. Release
+// builds leave them out, so the macro arguments are never evaluated; define
+// PROFILER_ENABLED=1 to profile an optimised build.
+#ifndef PROFILER_ENABLED
+#ifdef NDEBUG
+#define PROFILER_ENABLED 0
+#else
+#define PROFILER_ENABLED 1
+#endif
+#endif
+
+enum class ProfileCounter : uint8_t
+{
+	DRAW_CALLS, // sprites and text drawn by the Renderer
+	FOV_CELLS, // cells FovMap::compute_fov found visible
+	PATH_NODES, // nodes Dijkstra::find_path took off the open list
+	FLOW_CELLS, // player flow-field cells written during the last turn
+	ALLOCATIONS, // operator new calls, any thread
+	COUNT // sentinel -- keep last
+};
+
+[[nodiscard]] std::string_view counter_name(ProfileCounter counter) noexcept;
+
+// One timed scope. Times are nanoseconds since the profiler was created.
+struct ProfileZone
+{
+	const char* name{ nullptr }; // a string literal; only the pointer is kept
+	uint32_t depth{ 0 }; // 0 for zones directly inside the frame
+	int64_t startNs{ 0 };
+	int64_t durationNs{ 0 };
+};
+
+struct ProfileFrame
+{
+	static constexpr size_t MAX_ZONES = 256;
+
+	uint64_t index{ 0 }; // frames begun since the profiler was created or reset
+	int64_t startNs{ 0 };
+	int64_t durationNs{ 0 };
+	uint32_t zoneCount{ 0 };
+	uint32_t droppedZones{ 0 }; // zones past MAX_ZONES
+	std::array<int64_t, static_cast<size_t>(ProfileCounter::COUNT)> counters{};
+	std::array<ProfileZone, MAX_ZONES> zones{};
+
+	[[nodiscard]] int64_t counter(ProfileCounter c) const noexcept { return counters[static_cast<size_t>(c)]; }
+};
+
+// Inclusive time of every zone with one name, summed over a run of frames.
+struct ZoneTotal
+{
+	std::string_view name;
+	int64_t totalNs{ 0 };
+	int64_t calls{ 0 };
+};
+
+// ---------------------------------------------------------------------------
+// Profiler -- process-wide frame profiler behind the PROFILE_* macros.
+//
+// The game thread opens a frame per tick and records zones into it; a
+// closed frame is published into a ring of FRAME_HISTORY frames by bumping
+// an atomic count, so neither recording nor reading takes a lock and the
+// oldest frame is simply overwritten. Zones are recorded only on the thread
+// that opened the first frame -- a zone on a worker is ignored -- while
+// counters may be bumped from any thread: they are relaxed atomics folded
+// into whichever frame is open when it closes. The allocation counter is a
+// plain global so operator new can bump it before the profiler exists.
+//
+// Frames are read (overlay, exports) on the game thread, between frames.
+// ---------------------------------------------------------------------------
+class Profiler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr size_t FRAME_HISTORY = 240; // four seconds at 60 fps
+	static constexpr uint32_t NO_ZONE = UINT32_MAX;
+
+	static Profiler& instance();
+
+	Profiler(const Profiler&) = delete;
+	Profiler& operator=(const Profiler&) = delete;
+
+	// Paused, begin_frame and begin_zone do nothing; history is kept.
+	void set_enabled(bool on) noexcept { enabled.store(on, std::memory_order_relaxed); }
+	[[nodiscard]] bool is_enabled() const noexcept { return enabled.load(std::memory_order_relaxed); }
+
+	// Game thread. An open frame is closed first.
+	void begin_frame() noexcept;
+	void end_frame() noexcept;
+
+	// Game thread. Returns the zone's slot in the open frame, or NO_ZONE.
+	[[nodiscard]] uint32_t begin_zone(const char* name) noexcept;
+	void end_zone(uint32_t slot) noexcept;
+
+	// Any thread.
+	void count(ProfileCounter counter, int64_t amount = 1) noexcept
+	{
+		pending[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+	}
+
+	// Closed frames still in the ring; frame(0) is the oldest.
+	[[nodiscard]] size_t frame_count() const noexcept;
+	[[nodiscard]] const ProfileFrame& frame(size_t i) const noexcept;
+
+	// The n zone names with the most inclusive time over the last frames
+	// closed frames, most expensive first.
+	[[nodiscard]] std::vector<ZoneTotal> top_zones(size_t n, size_t frames) const;
+
+	// Chrome trace event format (chrome://tracing, Perfetto): one complete
+	// event per frame and zone, one counter event per frame.
+	void write_chrome_trace(std::ostream& out) const;
+
+	// One row per frame, zone and nonzero counter:
+	// frame,kind,name,depth,start_us,duration_us,value
+	void write_csv(std::ostream& out) const;
+
+	// Drops the history and any open frame.
+	void reset() noexcept;
+
+private:
+	Profiler();
+
+	std::vector<ProfileFrame> ring;
+	std::atomic<uint64_t> closedFrames{ 0 };
+	uint64_t begunFrames{ 0 };
+	ProfileFrame* open{ nullptr };
+	uint32_t depth{ 0 };
+	int64_t allocationsAtBegin{ 0 };
+	std::thread::id owner{};
+	Clock::time_point origin;
+	std::atomic<bool> enabled{ true };
+	std::array<std::atomic<int64_t>, static_cast<size_t>(ProfileCounter::COUNT)> pending{};
+
+	[[nodiscard]] int64_t now_ns() const noexcept;
+};
+
+// operator new calls since start; bumped by the replacement operator new
+// in Profiler.cpp when the profiler is compiled in.
+[[nodiscard]] int64_t profiler_allocation_count() noexcept;
+
+// Records the enclosing scope as a zone of the open frame.
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* name) noexcept : slot(Profiler::instance().begin_zone(name)) {}
+	~ProfileScope() { Profiler::instance().end_zone(slot); }
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+	uint32_t slot;
+};
+
+// Opens a frame for the enclosing scope.
+class ProfileFrameScope
+{
+public:
+	ProfileFrameScope() noexcept { Profiler::instance().begin_frame(); }
+	~ProfileFrameScope() { Profiler::instance().end_frame(); }
+
+	ProfileFrameScope(const ProfileFrameScope&) = delete;
+	ProfileFrameScope& operator=(const ProfileFrameScope&) = delete;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if PROFILER_ENABLED
+#define PROFILE_FRAME() const ProfileFrameScope PROFILE_CONCAT(profileFrame, __LINE__)
+#define PROFILE_ZONE(name) const ProfileScope PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_COUNT(counter, amount) Profiler::instance().count((counter), (amount))
+#else
+#define PROFILE_FRAME() static_cast<void>(0)
+#define PROFILE_ZONE(name) static_cast<void>(0)
+#define PROFILE_COUNT(counter, amount) static_cast<void>(0)
+#endif
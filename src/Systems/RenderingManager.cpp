@@ -12,36 +12,51 @@
 #include "../Map/Map.h"
 #include "../Map/Minimap.h"
 #include "../Renderer/Renderer.h"
+#include "Profiler.h"
 #include "RenderingManager.h"
 
 void RenderingManager::render(GameContext& ctx) const
 {
+	if (!ctx.renderer || !ctx.renderer->is_initialized())
+	{
+		return; // menus replayed without a window redraw nothing behind them
+	}
 	render_world(ctx);
 }
 
 void RenderingManager::render_world(const GameContext& ctx) const
 {
-	ctx.map->render(ctx);
-	ctx.stairs->render(ctx);
+	{
+		PROFILE_ZONE("map");
+		ctx.map->render(ctx);
+		ctx.stairs->render(ctx);
+	}
 
-	render_objects(*ctx.objects, ctx);
+	{
+		PROFILE_ZONE("entities");
+		render_objects(*ctx.objects, ctx);
 
-	// Render floor items
-	render_items(ctx.floorInventory->items, ctx);
+		// Render floor items
+		render_items(ctx.floorInventory->items, ctx);
 
-	render_creatures(*ctx.creatures, ctx);
-	ctx.player->render(ctx);
+		render_creatures(*ctx.creatures, ctx);
+		ctx.player->render(ctx);
 
-	if (ctx.decorations)
-	{
-		render_decorations(*ctx.decorations, ctx);
+		if (ctx.decorations)
+		{
+			render_decorations(*ctx.decorations, ctx);
+		}
 	}
 
-	apply_lighting(ctx);
+	{
+		PROFILE_ZONE("lighting");
+		apply_lighting(ctx);
+	}
 	render_mouse_path_overlay(ctx);
 
 	if (ctx.minimap)
 	{
+		PROFILE_ZONE("minimap");
 		ctx.minimap->render(ctx);
 	}
 }
@@ -100,14 +115,39 @@ void RenderingManager::apply_lighting(const GameContext& ctx) const
 	}
 
 	Renderer& renderer = *ctx.renderer;
-	const int tileSize = renderer.get_tile_size();
-	const int cameraX = renderer.get_camera_x();
-	const int cameraY = renderer.get_camera_y();
+	const LightMaskKey key{
+		.map = ctx.map,
+		.viewVersion = ctx.map->get_view_version(),
+		.player = ctx.player->position,
+		.cameraX = renderer.get_camera_x(),
+		.cameraY = renderer.get_camera_y(),
+		.tileSize = renderer.get_tile_size(),
+		.screenWidth = renderer.get_screen_width(),
+		.screenHeight = renderer.get_screen_height(),
+	};
+	if (key == lightKey)
+	{
+		renderer.apply_light_mask();
+		return;
+	}
+
+	// Only the tiles overlapping the screen get a light value.
+	const int firstX = std::max(0, key.cameraX / key.tileSize);
+	const int firstY = std::max(0, key.cameraY / key.tileSize);
+	const int lastX = std::min(ctx.map->get_width() - 1, (key.cameraX + key.screenWidth - 1) / key.tileSize);
+	const int lastY = std::min(ctx.map->get_height() - 1, (key.cameraY + key.screenHeight - 1) / key.tileSize);
+	const int cols = lastX - firstX + 1;
+	const int rows = lastY - firstY + 1;
+	if (cols <= 0 || rows <= 0)
+	{
+		return;
+	}
 
 	static constexpr float torchRadiusTiles = 6.5f;
 	static constexpr Color torchInner = { 255, 210, 140, 255 };
 	static constexpr Color torchOuter = { 0, 0, 0, 255 };
 	static constexpr Color exploredMemoryLight = { 160, 155, 148, 255 };
+	static constexpr Color unexploredDark = { 0, 0, 0, 255 };
 
 	auto lerp_channel = [](unsigned char fromChannel, unsigned char toChannel, float fraction) -> unsigned char
 	{
@@ -115,40 +155,47 @@ void RenderingManager::apply_lighting(const GameContext& ctx) const
 			static_cast<float>(fromChannel) + fraction * (static_cast<float>(toChannel) - static_cast<float>(fromChannel)));
 	};
 
-	renderer.begin_light_mask();
+	// Unexplored, unseen tiles stay black.
+	const BitPlane& explored = ctx.map->get_tile_grid().explored();
+	const BitPlane& fov = ctx.map->get_fov_plane();
+	const int mapWidth = ctx.map->get_width();
 
-	for (int tileY = 0; tileY < ctx.map->get_height(); ++tileY)
+	lightTexels.resize(static_cast<size_t>(cols) * rows);
+	for (int row = 0; row < rows; ++row)
 	{
-		for (int tileX = 0; tileX < ctx.map->get_width(); ++tileX)
+		const int tileY = firstY + row;
+		for (int col = 0; col < cols; ++col)
 		{
-			Vector2D tilePos{ tileX, tileY };
-			if (!ctx.map->is_in_fov(tilePos))
+			const int tileX = firstX + col;
+			const size_t index = static_cast<size_t>(tileY) * mapWidth + tileX;
+			Color& texel = lightTexels[static_cast<size_t>(row) * cols + col];
+
+			if (!fov.test(index))
 			{
-				if (ctx.map->is_explored(tilePos))
-				{
-					int screenX = tileX * tileSize - cameraX;
-					int screenY = tileY * tileSize - cameraY;
-					renderer.add_light_quad(screenX, screenY, tileSize, exploredMemoryLight);
-				}
+				texel = explored.test(index) ? exploredMemoryLight : unexploredDark;
 				continue;
 			}
 
+			Vector2D tilePos{ tileX, tileY };
 			float distanceTiles = static_cast<float>(tilePos.distance_to(ctx.player->position));
 			float falloff = std::min(distanceTiles / torchRadiusTiles, 1.0f);
 
-			Color litColor{
+			texel = Color{
 				lerp_channel(torchInner.r, torchOuter.r, falloff),
 				lerp_channel(torchInner.g, torchOuter.g, falloff),
 				lerp_channel(torchInner.b, torchOuter.b, falloff),
 				255
 			};
-
-			int screenX = tileX * tileSize - cameraX;
-			int screenY = tileY * tileSize - cameraY;
-			renderer.add_light_quad(screenX, screenY, tileSize, litColor);
 		}
 	}
 
+	renderer.update_light_mask(
+		lightTexels,
+		cols,
+		rows,
+		firstX * key.tileSize - key.cameraX,
+		firstY * key.tileSize - key.cameraY);
+	lightKey = key;
 	renderer.apply_light_mask();
 }
 
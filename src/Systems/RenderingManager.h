@@ -1,11 +1,18 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <span>
+#include <vector>
+
+#include <raylib.h>
+
+#include "../Utils/Vector2D.h"
 
 // Forward declarations
 class Creature;
 class Item;
+class Map;
 class Object;
 struct Decoration;
 struct GameContext;
@@ -27,6 +34,25 @@ public:
 	void restore_screen(GameContext& ctx) const;
 
 private:
+	// Everything the light mask depends on; while it is unchanged the mask
+	// from the last rebuild is reused as is.
+	struct LightMaskKey
+	{
+		const Map* map{ nullptr };
+		uint64_t viewVersion{ 0 };
+		Vector2D player{};
+		int cameraX{ 0 };
+		int cameraY{ 0 };
+		int tileSize{ 0 };
+		int screenWidth{ 0 };
+		int screenHeight{ 0 };
+
+		bool operator==(const LightMaskKey&) const = default;
+	};
+
+	mutable LightMaskKey lightKey{};
+	mutable std::vector<Color> lightTexels; // viewport tiles, row-major
+
 	// Helper methods
 	void render_objects(std::span<const std::unique_ptr<Object>> objects, const GameContext& ctx) const;
 	void render_decorations(std::span<const std::unique_ptr<Decoration>> decorations, const GameContext& ctx) const;
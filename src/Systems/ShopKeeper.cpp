@@ -1,6 +1,5 @@
 #include <algorithm>
 #include <cassert>
-#include <cstdlib>
 #include <memory>
 #include <string>
 #include <utility>
@@ -54,8 +53,8 @@ ShopKeeper::ShopKeeper(ShopType type, ShopQuality quality)
 	}
 	}
 
-	generate_shop_name();
-	// Note: generate_initial_inventory(ctx) must be called separately after construction
+	// Note: generate_initial_inventory(ctx) must be called separately after
+	// construction; it also names the shop.
 }
 
 int ShopKeeper::get_buy_price(const Item& item) const
@@ -73,9 +72,10 @@ int ShopKeeper::get_sell_price(const Item& item) const
 void ShopKeeper::generate_initial_inventory(GameContext& ctx)
 {
 	shopInventory.items.clear();
+	generate_shop_name(*ctx.dice);
 
 	// Generate 3-7 random items based on shop type
-	int item_count = ctx.dice->roll(3, 7);
+	int item_count = ctx.dice->loot().roll(3, 7);
 
 	for (int i = 0; i < item_count; i++)
 	{
@@ -109,7 +109,7 @@ std::unique_ptr<Item> ShopKeeper::generate_random_item_by_type(GameContext& ctx)
 	}
 	case ShopType::GENERAL_STORE:
 	{
-		switch (ctx.dice->roll(0, 3))
+		switch (ctx.dice->loot().roll(0, 3))
 		{
 		case 0:
 		{
@@ -143,9 +143,9 @@ std::unique_ptr<Item> ShopKeeper::generate_random_weapon(GameContext& ctx)
 	const int level = ctx.levelManager->get_dungeon_level();
 	auto item = ItemCreator::create_random_of_category("weapon", { 0, 0 }, ctx, level);
 
-	if (item && ctx.dice->roll(1, 100) <= 40)
+	if (item && ctx.dice->loot().roll(1, 100) <= 40)
 	{
-		item->generate_random_enhancement(true);
+		item->generate_random_enhancement(true, *ctx.dice);
 	}
 
 	return item;
@@ -156,9 +156,9 @@ std::unique_ptr<Item> ShopKeeper::generate_random_armor(GameContext& ctx)
 	const int level = ctx.levelManager->get_dungeon_level();
 	auto item = ItemCreator::create_random_of_category("armor", { 0, 0 }, ctx, level);
 
-	if (item && ctx.dice->roll(1, 100) <= 35)
+	if (item && ctx.dice->loot().roll(1, 100) <= 35)
 	{
-		item->generate_random_enhancement(true);
+		item->generate_random_enhancement(true, *ctx.dice);
 	}
 
 	return item;
@@ -182,7 +182,7 @@ std::unique_ptr<Item> ShopKeeper::generate_random_misc_item(GameContext& ctx)
 	const int level = ctx.levelManager->get_dungeon_level();
 
 	std::unique_ptr<Item> item;
-	const int category = ctx.dice->roll(0, 3);
+	const int category = ctx.dice->loot().roll(0, 3);
 	switch (category)
 	{
 	case 0:
@@ -208,14 +208,14 @@ std::unique_ptr<Item> ShopKeeper::generate_random_misc_item(GameContext& ctx)
 	}
 
 	// Apply price variation (+-5)
-	item->set_value(std::max(1, item->get_value() + ctx.dice->roll(-5, 5)));
+	item->set_value(std::max(1, item->get_value() + ctx.dice->loot().roll(-5, 5)));
 
 	// 15% chance for enhancement (only for equipment)
 	if (item->is_weapon() || item->is_armor())
 	{
-		if (ctx.dice->roll(1, 100) <= 15)
+		if (ctx.dice->loot().roll(1, 100) <= 15)
 		{
-			item->generate_random_enhancement(false);
+			item->generate_random_enhancement(false, *ctx.dice);
 		}
 	}
 
@@ -285,7 +285,7 @@ bool ShopKeeper::process_player_sale(GameContext& ctx, Item& item, Creature& pla
 	return true;
 }
 
-void ShopKeeper::generate_shop_name()
+void ShopKeeper::generate_shop_name(RandomDice& dice)
 {
 	std::vector<std::string> weapon_names = {
 		"The Sharp Edge", "Blades & Bludgeons", "Steel & Iron", "The Armory", "Warrior's Arsenal", "The Forge", "Sword & Shield", "Battle Ready"
@@ -311,27 +311,27 @@ void ShopKeeper::generate_shop_name()
 	{
 	case ShopType::WEAPON_SHOP:
 	{
-		shopName = weapon_names[rand() % weapon_names.size()];
+		shopName = weapon_names[dice.loot().roll(0, static_cast<int>(weapon_names.size()) - 1)];
 		break;
 	}
 	case ShopType::ARMOR_SHOP:
 	{
-		shopName = armor_names[rand() % armor_names.size()];
+		shopName = armor_names[dice.loot().roll(0, static_cast<int>(armor_names.size()) - 1)];
 		break;
 	}
 	case ShopType::POTION_SHOP:
 	{
-		shopName = potion_names[rand() % potion_names.size()];
+		shopName = potion_names[dice.loot().roll(0, static_cast<int>(potion_names.size()) - 1)];
 		break;
 	}
 	case ShopType::SCROLL_SHOP:
 	{
-		shopName = scroll_names[rand() % scroll_names.size()];
+		shopName = scroll_names[dice.loot().roll(0, static_cast<int>(scroll_names.size()) - 1)];
 		break;
 	}
 	case ShopType::GENERAL_STORE:
 	{
-		shopName = general_names[rand() % general_names.size()];
+		shopName = general_names[dice.loot().roll(0, static_cast<int>(general_names.size()) - 1)];
 		break;
 	}
 	default:
@@ -343,10 +343,10 @@ void ShopKeeper::generate_shop_name()
 }
 
 // Static utility function for creating random shopkeepers
-std::unique_ptr<ShopKeeper> ShopKeeper::create_random_shopkeeper()
+std::unique_ptr<ShopKeeper> ShopKeeper::create_random_shopkeeper(RandomDice& dice)
 {
 	// Random shop type selection with weighted probabilities
-	int typeRoll = rand() % 100;
+	int typeRoll = dice.loot().roll(0, 99);
 	ShopType randomType;
 
 	if (typeRoll < 25)
@@ -375,7 +375,7 @@ std::unique_ptr<ShopKeeper> ShopKeeper::create_random_shopkeeper()
 	}
 
 	// Random quality selection with weighted probabilities
-	int qualityRoll = rand() % 100;
+	int qualityRoll = dice.loot().roll(0, 99);
 	ShopQuality randomQuality;
 
 	if (qualityRoll < 15)
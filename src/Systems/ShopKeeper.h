@@ -7,6 +7,7 @@
 #include "../Persistent/Persistent.h"
 
 struct GameContext;
+class RandomDice;
 
 enum class ShopType
 {
@@ -28,6 +29,7 @@ enum class ShopQuality
 
 // Forward declarations
 struct GameContext;
+class RandomDice;
 class Item;
 class Creature;
 
@@ -41,7 +43,7 @@ private:
 	int markupPercent{ 120 }; // Buy price percentage
 	int sellbackPercent{ 60 }; // Sell price percentage
 
-	void generate_shop_name();
+	void generate_shop_name(RandomDice& dice);
 
 	// Random item generation methods
 	std::unique_ptr<Item> generate_random_item_by_type(GameContext& ctx);
@@ -92,5 +94,5 @@ public:
 	bool process_player_sale(GameContext& ctx, Item& item, Creature& player);
 
 	// Static utility function for creating random shopkeepers
-	static std::unique_ptr<ShopKeeper> create_random_shopkeeper();
+	static std::unique_ptr<ShopKeeper> create_random_shopkeeper(RandomDice& dice);
 };
@@ -37,7 +37,7 @@ bool ShopkeeperFactory::should_spawn_shopkeeper(int dungeonLevel, GameContext& c
 	int shopkeeperChance = 8 + (dungeonLevel * 2);
 	shopkeeperChance = std::min(shopkeeperChance, 20);
 
-	return ctx.dice->d100() <= shopkeeperChance;
+	return ctx.dice->mapgen().d100() <= shopkeeperChance;
 }
 
 void ShopkeeperFactory::configure_shopkeeper(Creature& shopkeeper, int dungeonLevel, GameContext& ctx)
@@ -63,7 +63,7 @@ void ShopkeeperFactory::configure_shopkeeper(Creature& shopkeeper, int dungeonLe
 	shopkeeper.shop = std::make_unique<ShopKeeper>(shopType, shopQuality);
 	shopkeeper.shop->generate_initial_inventory(ctx);
 
-	ctx.messageSystem->log(std::format("Created shopkeeper: {} (Level {})", shopkeeper.shop->get_shop_name(), dungeonLevel));
+	ctx.messageSystem->debug("Created shopkeeper: {} (Level {})", shopkeeper.shop->get_shop_name(), dungeonLevel);
 }
 
 ShopType ShopkeeperFactory::select_shop_type_for_level(int dungeonLevel, GameContext& ctx)
@@ -71,11 +71,11 @@ ShopType ShopkeeperFactory::select_shop_type_for_level(int dungeonLevel, GameCon
 	// Early levels favor general stores, deeper levels get specialized shops
 	if (dungeonLevel <= 2)
 	{
-		return (ctx.dice->d100() <= 60) ? ShopType::GENERAL_STORE : ShopType::WEAPON_SHOP;
+		return (ctx.dice->mapgen().d100() <= 60) ? ShopType::GENERAL_STORE : ShopType::WEAPON_SHOP;
 	}
 	else if (dungeonLevel <= 4)
 	{
-		int roll = ctx.dice->d100();
+		int roll = ctx.dice->mapgen().d100();
 		if (roll <= 25)
 			return ShopType::WEAPON_SHOP;
 		if (roll <= 50)
@@ -87,7 +87,7 @@ ShopType ShopkeeperFactory::select_shop_type_for_level(int dungeonLevel, GameCon
 	else
 	{
 		// Higher levels get full variety including scroll shops
-		int roll = ctx.dice->d100();
+		int roll = ctx.dice->mapgen().d100();
 		if (roll <= 20)
 			return ShopType::WEAPON_SHOP;
 		if (roll <= 40)
@@ -103,7 +103,7 @@ ShopType ShopkeeperFactory::select_shop_type_for_level(int dungeonLevel, GameCon
 ShopQuality ShopkeeperFactory::select_shop_quality_for_level(int dungeonLevel, GameContext& ctx)
 {
 	// Quality improves with dungeon depth
-	int qualityRoll = ctx.dice->d100();
+	int qualityRoll = ctx.dice->mapgen().d100();
 	int levelBonus = dungeonLevel * 5; // 5% quality improvement per level
 
 	if (qualityRoll + levelBonus >= 85)
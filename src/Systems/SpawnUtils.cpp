@@ -48,8 +48,8 @@ Vector2D find_random_floor_tile(GameContext& ctx)
     {
         const Vector2D pos
         {
-            ctx.dice->roll(MAP_EDGE_MARGIN, ctx.map->get_width() - MAP_EDGE_MARGIN),
-            ctx.dice->roll(MAP_EDGE_MARGIN, ctx.map->get_height() - MAP_EDGE_MARGIN)
+            ctx.dice->mapgen().roll(MAP_EDGE_MARGIN, ctx.map->get_width() - MAP_EDGE_MARGIN),
+            ctx.dice->mapgen().roll(MAP_EDGE_MARGIN, ctx.map->get_height() - MAP_EDGE_MARGIN)
         };
 
         if (ctx.map->get_tile_type(pos) == TileType::FLOOR && is_position_free(pos))
@@ -70,8 +70,8 @@ std::optional<Vector2D> find_random_room_position(const DungeonRoom& room, GameC
     {
         const Vector2D pos
         {
-            ctx.dice->roll(room.col, room.col_end()),
-            ctx.dice->roll(room.row, room.row_end())
+            ctx.dice->mapgen().roll(room.col, room.col_end()),
+            ctx.dice->mapgen().roll(room.row, room.row_end())
         };
 
         if (ctx.map->can_walk(pos, ctx) &&
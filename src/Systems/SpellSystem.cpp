@@ -771,7 +771,7 @@ bool SpellSystem::cast_cure_light_wounds(Creature& caster, GameContext& ctx)
 {
 	animate_heal(caster.position, ctx);
 
-	int healing = ctx.dice->roll(1, 8);
+	int healing = ctx.dice->combat().roll(1, 8);
 	int oldHp = caster.get_hp();
 	int maxHp = caster.get_max_hp();
 	int newHp = std::min(oldHp + healing, maxHp);
@@ -898,7 +898,7 @@ void SpellSystem::cast_web(
 			}
 
 			// AD&D 2e: Save vs. Paralyzation (d20 >= 10) avoids entanglement
-			int save = innerCtx.dice->roll(1, 20);
+			int save = innerCtx.dice->combat().roll(1, 20);
 			if (save < 10)
 			{
 				innerCtx.buffSystem->add_buff(*creature, BuffType::WEBBED, 0, duration, false);
@@ -959,7 +959,7 @@ void SpellSystem::cast_fireball(
 		int totalDamage = 0;
 		for (int i = 0; i < diceCnt; ++i)
 		{
-			totalDamage += innerCtx.dice->roll(1, 6);
+			totalDamage += innerCtx.dice->combat().roll(1, 6);
 		}
 
 		int affected = 0;
@@ -975,7 +975,7 @@ void SpellSystem::cast_fireball(
 			}
 
 			// AD&D 2e: Save vs. Spells (d20 >= 15) for half damage
-			int save = innerCtx.dice->roll(1, 20);
+			int save = innerCtx.dice->combat().roll(1, 20);
 			int dealt = (save >= 15) ? totalDamage / 2 : totalDamage;
 			creature->take_damage_and_check_death(dealt, innerCtx);
 			++affected;
@@ -1059,7 +1059,7 @@ bool SpellSystem::cast_magic_missile(Creature& caster, GameContext& ctx)
 
 		SpellAnimations::animate_magic_missile(caster.position, target->position, ctx);
 
-		int damage = ctx.dice->roll(1, 4) + 1;
+		int damage = ctx.dice->combat().roll(1, 4) + 1;
 		totalDamage += damage;
 		damagePerTarget[target] += damage;
 
@@ -1089,7 +1089,7 @@ bool SpellSystem::cast_shield(Creature& caster, GameContext& ctx)
 bool SpellSystem::cast_sleep(Creature& caster, GameContext& ctx)
 {
 	// AD&D 2e: 2d8 HD of creatures affected, lowest HD first
-	int hdBudget = ctx.dice->roll(2, 8);
+	int hdBudget = ctx.dice->combat().roll(2, 8);
 	int affected = 0;
 
 	for (const auto& creature : *ctx.creatures)
@@ -1138,7 +1138,7 @@ bool SpellSystem::cast_hold_person(Creature& caster, GameContext& ctx)
 	// Duration: 2 rounds per caster level
 	int casterLevel = caster.get_creature_level();
 	int duration = 2 * casterLevel;
-	int maxTargets = ctx.dice->roll(1, 4);
+	int maxTargets = ctx.dice->combat().roll(1, 4);
 	int affected = 0;
 
 	for (const auto& creature : *ctx.creatures)
@@ -1156,7 +1156,7 @@ bool SpellSystem::cast_hold_person(Creature& caster, GameContext& ctx)
 			continue;
 		}
 
-		int save = ctx.dice->roll(1, 20);
+		int save = ctx.dice->combat().roll(1, 20);
 		if (save < 15)
 		{
 			ctx.buffSystem->add_buff(*creature, BuffType::HOLD_PERSON, 0, duration, false);
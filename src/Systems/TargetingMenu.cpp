@@ -112,6 +112,11 @@ void TargetingMenu::menu(GameContext& ctx)
         }
     }
 
+    if (!ctx.renderer->is_initialized())
+    {
+        return; // replayed without a window
+    }
+
     ctx.renderer->begin_frame();
     ctx.renderingManager->render(ctx);
 
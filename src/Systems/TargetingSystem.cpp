@@ -19,6 +19,7 @@
 #include "RenderingManager.h"
 #include "TileConfig.h"
 #include "TargetingMenu.h"
+#include "../Utils/BresenhamLine.h"
 #include "../Utils/Vector2D.h"
 #include "TargetingSystem.h"
 
@@ -29,14 +30,13 @@ void TargetingSystem::draw_los(GameContext& ctx, Vector2D targetCursor) const
 		return;
 	}
 
-	auto path = Map::bresenham_line(ctx.player->position, targetCursor);
 	int tileSize = ctx.renderer->get_tile_size();
 	int cameraOffsetX = ctx.renderer->get_camera_x();
 	int cameraOffsetY = ctx.renderer->get_camera_y();
 
 	bool hasLineOfSight = ctx.map->has_los(ctx.player->position, targetCursor);
 
-	for (const auto& pos : path)
+	for (Vector2D pos : BresenhamLine{ ctx.player->position, targetCursor })
 	{
 		if (pos == ctx.player->position)
 		{
@@ -4,9 +4,9 @@
 #include <filesystem>
 #include <format>
 #include <fstream>
-#include <iostream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -15,6 +15,7 @@
 
 #include "../Core/Paths.h"
 #include "../Renderer/Renderer.h"
+#include "../Systems/Logger.h"
 #include "DecorEditor.h"
 
 using json = nlohmann::json;
@@ -116,7 +117,7 @@ void DecorEditor::save_palette(std::string_view path) const
 			}
 			catch (const json::exception& e)
 			{
-				std::clog << std::format("[DecorEditor] tile_config.json error, starting fresh: {}\n", e.what());
+				Logger::instance().print<LogLevel::LOG_WARN>("[DecorEditor] tile_config.json error, starting fresh: {}", e.what());
 				j = json::object();
 			}
 		}
@@ -128,7 +129,7 @@ void DecorEditor::save_palette(std::string_view path) const
 	std::ofstream out(abs);
 	out << j.dump(4);
 	last_save_time = GetTime();
-	std::clog << std::format("[DecorEditor] palette saved: {}\n", abs.string());
+	Logger::instance().print<LogLevel::LOG_INFO>("[DecorEditor] palette saved: {}", abs.string());
 }
 
 void DecorEditor::load_palette(std::string_view path)
@@ -141,10 +142,10 @@ void DecorEditor::load_palette(std::string_view path)
 	std::ifstream in(abs);
 	if (!in.is_open())
 	{
-		std::clog << std::format("[DecorEditor] palette not found: {}\n", abs.string());
+		Logger::instance().print<LogLevel::LOG_WARN>("[DecorEditor] palette not found: {}", abs.string());
 		return;
 	}
-	std::clog << std::format("[DecorEditor] palette loaded: {}\n", abs.string());
+	Logger::instance().print<LogLevel::LOG_INFO>("[DecorEditor] palette loaded: {}", abs.string());
 
 	try
 	{
@@ -162,16 +163,38 @@ void DecorEditor::load_palette(std::string_view path)
 	}
 	catch (const json::exception& e)
 	{
-		std::clog << std::format("[DecorEditor] palette error, clearing: {}\n", e.what());
+		Logger::instance().print<LogLevel::LOG_WARN>("[DecorEditor] palette error, clearing: {}", e.what());
 		palette.clear();
 	}
 }
 
 // ---------------------------------------------------------------------------
 
+std::string DecorEditor::map_key(long seed, int dungeon_level)
+{
+	return std::format("{}_{}", seed, dungeon_level);
+}
+
 void DecorEditor::set_active_map(long seed, int dungeon_level)
 {
-	active_key = std::format("{}_{}", seed, dungeon_level);
+	active_key = map_key(seed, dungeon_level);
+}
+
+std::unordered_map<uint32_t, TileRef> DecorEditor::get_map_overrides(long seed, int dungeon_level) const
+{
+	const auto it = all_overrides.find(map_key(seed, dungeon_level));
+	return it != all_overrides.end() ? it->second : std::unordered_map<uint32_t, TileRef>{};
+}
+
+void DecorEditor::set_map_overrides(long seed, int dungeon_level, std::unordered_map<uint32_t, TileRef> overrides)
+{
+	const std::string key = map_key(seed, dungeon_level);
+	if (overrides.empty())
+	{
+		all_overrides.erase(key);
+		return;
+	}
+	all_overrides[key] = std::move(overrides);
 }
 
 void DecorEditor::toggle()
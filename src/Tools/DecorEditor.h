@@ -50,6 +50,11 @@ public:
 
 	void set_active_map(long seed, int dungeon_level);
 
+	// Override bucket of any map, so a level can be generated against a
+	// private editor and its prefab stamps carried over afterwards.
+	[[nodiscard]] std::unordered_map<uint32_t, TileRef> get_map_overrides(long seed, int dungeon_level) const;
+	void set_map_overrides(long seed, int dungeon_level, std::unordered_map<uint32_t, TileRef> overrides);
+
 	// Palette persistence -- both read/write the "palette" array in tile_config.json.
 	void save_palette(std::string_view path) const;
 	void load_palette(std::string_view path);
@@ -103,6 +108,7 @@ private:
 	bool label_all_selected{ false }; // first keystroke replaces entire label
 	int buffered_char{ 0 }; // char polled by InputSystem::poll(), fed in before render
 
+	[[nodiscard]] static std::string map_key(long seed, int dungeon_level);
 	[[nodiscard]] static uint32_t make_key(int x, int y) noexcept
 	{
 		return (static_cast<uint32_t>(y) << 16) | static_cast<uint32_t>(x & 0xFFFF);
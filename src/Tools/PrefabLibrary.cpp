@@ -2,7 +2,6 @@
 #include <algorithm>
 #include <format>
 #include <fstream>
-#include <iostream>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -13,6 +12,7 @@
 #include "../Map/DungeonRoom.h"
 #include "../Map/Map.h"
 #include "../Renderer/Renderer.h"
+#include "../Systems/Logger.h"
 #include "DecorEditor.h"
 #include "PrefabLibrary.h"
 
@@ -85,7 +85,7 @@ void PrefabLibrary::load_tile_labels(std::string_view path)
 	}
 	catch (const json::exception& e)
 	{
-		std::clog << std::format("[PrefabLibrary] tile_config.json error: {}\n", e.what());
+		Logger::instance().print<LogLevel::LOG_WARN>("[PrefabLibrary] tile_config.json error: {}", e.what());
 	}
 }
 
@@ -159,7 +159,7 @@ void PrefabLibrary::load(std::string_view path)
 	}
 	catch (const json::exception& e)
 	{
-		std::clog << std::format("[PrefabLibrary] prefabs.json error, clearing: {}\n", e.what());
+		Logger::instance().print<LogLevel::LOG_WARN>("[PrefabLibrary] prefabs.json error, clearing: {}", e.what());
 		prefabs.clear();
 	}
 }
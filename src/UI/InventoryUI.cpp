@@ -132,6 +132,11 @@ void InventoryUI::menu(GameContext& ctx)
 
 	rebuild_item_list(playerRef, ctx);
 
+	if (!ctx.renderer->is_initialized())
+	{
+		return; // replayed without a window
+	}
+
 	ctx.renderer->begin_frame();
 
 	draw_frame(ctx);
@@ -821,8 +826,7 @@ bool InventoryUI::handle_input(Player& player, GameContext& ctx)
 	if (ctx.renderer)
 	{
 		int tileSize = ctx.renderer->get_tile_size();
-		::Vector2 rawMouse = GetMousePosition();
-		int mouseRow = static_cast<int>(rawMouse.y) / tileSize;
+		int mouseRow = ctx.inputSystem->get_mouse_position().y / tileSize;
 		constexpr int startYTiles = 2 + TAB_BAR_HEIGHT;
 
 		if (activeScreen == InventoryScreen::EQUIPMENT)
@@ -910,9 +914,9 @@ bool InventoryUI::handle_input(Player& player, GameContext& ctx)
 		assert(ctx.renderer && "InventoryUI::handle_input MOUSE_LEFT called without a renderer");
 
 		int tileSize = ctx.renderer->get_tile_size();
-		::Vector2 rawMouse = GetMousePosition();
-		int mousePixelX = static_cast<int>(rawMouse.x);
-		int mousePixelY = static_cast<int>(rawMouse.y);
+		const Vector2D mousePixel = ctx.inputSystem->get_mouse_position();
+		int mousePixelX = mousePixel.x;
+		int mousePixelY = mousePixel.y;
 		int mouseRow = mousePixelY / tileSize;
 		int vcols = screen_cols(ctx);
 		int vrows = screen_rows(ctx);
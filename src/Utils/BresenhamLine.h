@@ -0,0 +1,106 @@
+#pragma once
+// BresenhamLine.h -- allocation-free Bresenham line range.
+
+#include <cstdlib>
+#include <iterator>
+
+#include "Vector2D.h"
+
+// ---------------------------------------------------------------------------
+// BresenhamLine -- the cells from `from` (exclusive) to `to` (inclusive),
+// stepped lazily. Same cells and order as Map::bresenham_line, without the
+// vector: `for (Vector2D pos : BresenhamLine{ from, to })`, and a loop can
+// stop early without having computed the rest of the line.
+// ---------------------------------------------------------------------------
+class BresenhamLine
+{
+public:
+	class Iterator
+	{
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = Vector2D;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const Vector2D*;
+		using reference = const Vector2D&;
+
+		Iterator() = default;
+
+		const Vector2D& operator*() const noexcept { return pos; }
+		const Vector2D* operator->() const noexcept { return &pos; }
+
+		Iterator& operator++() noexcept
+		{
+			if (pos == line->to)
+			{
+				done = true;
+				return *this;
+			}
+			step();
+			return *this;
+		}
+
+		Iterator operator++(int) noexcept
+		{
+			Iterator previous = *this;
+			++*this;
+			return previous;
+		}
+
+		bool operator==(const Iterator& rhs) const noexcept { return done == rhs.done && (done || pos == rhs.pos); }
+		bool operator!=(const Iterator& rhs) const noexcept { return !(*this == rhs); }
+
+	private:
+		friend class BresenhamLine;
+
+		const BresenhamLine* line{ nullptr };
+		Vector2D pos{};
+		int err{ 0 };
+		bool done{ true };
+
+		explicit Iterator(const BresenhamLine& owner) noexcept
+			: line(&owner), pos(owner.from), err(owner.dx - owner.dy), done(owner.from == owner.to)
+		{
+			if (!done)
+			{
+				step();
+			}
+		}
+
+		void step() noexcept
+		{
+			const int e2 = 2 * err;
+			if (e2 > -line->dy)
+			{
+				err -= line->dy;
+				pos.x += line->sx;
+			}
+			if (e2 < line->dx)
+			{
+				err += line->dx;
+				pos.y += line->sy;
+			}
+		}
+	};
+
+	BresenhamLine(Vector2D from, Vector2D to) noexcept
+		: from(from),
+		  to(to),
+		  dx(std::abs(to.x - from.x)),
+		  dy(std::abs(to.y - from.y)),
+		  sx(from.x < to.x ? 1 : -1),
+		  sy(from.y < to.y ? 1 : -1)
+	{
+	}
+
+	Iterator begin() const noexcept { return Iterator{ *this }; }
+	Iterator end() const noexcept { return Iterator{}; }
+
+private:
+	Vector2D from;
+	Vector2D to;
+	int dx;
+	int dy;
+	int sx;
+	int sy;
+};
@@ -0,0 +1,125 @@
+#pragma once
+// BucketQueue.h -- monotone integer priority queue (Dial's buckets).
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+// BucketQueue -- min-queue over small integer priorities.
+//
+// Built for grid searches whose priorities never drop below the last popped
+// one and never run more than span() ahead of it (A* with a consistent
+// heuristic, Dijkstra, BFS). Buckets form a ring indexed by priority; each
+// bucket is an intrusive LIFO list threaded through one flat node pool, and
+// an occupancy bitmap lets pop() skip 64 empty buckets per word. push and
+// pop are O(1) amortised, clear() touches only the buckets still in use and
+// every buffer keeps its capacity across searches.
+// ---------------------------------------------------------------------------
+class BucketQueue
+{
+public:
+	// span is rounded up to a power of two; it must exceed the largest gap
+	// between the lowest and highest priority queued at the same time.
+	explicit BucketQueue(int span)
+	{
+		const size_t buckets = std::bit_ceil(static_cast<size_t>(span < 64 ? 64 : span));
+		heads_.assign(buckets, NONE);
+		occupied_.assign(buckets / 64, 0);
+		mask_ = static_cast<int>(buckets - 1);
+	}
+
+	bool empty() const noexcept { return size_ == 0; }
+	size_t size() const noexcept { return size_; }
+	int span() const noexcept { return mask_ + 1; }
+
+	// Priority of the last popped value; pushes below it are raised to it.
+	int cursor() const noexcept { return cursor_; }
+
+	void clear() noexcept
+	{
+		for (size_t w = 0; w < occupied_.size(); ++w)
+		{
+			uint64_t word = occupied_[w];
+			while (word != 0)
+			{
+				heads_[w * 64 + static_cast<size_t>(std::countr_zero(word))] = NONE;
+				word &= word - 1;
+			}
+			occupied_[w] = 0;
+		}
+		nodes_.clear();
+		size_ = 0;
+		cursor_ = 0;
+	}
+
+	void push(int32_t value, int priority)
+	{
+		if (priority < cursor_)
+		{
+			priority = cursor_;
+		}
+		assert(priority - cursor_ <= mask_ && "BucketQueue::push priority beyond span");
+
+		const int bucket = priority & mask_;
+		nodes_.push_back(Node{ value, heads_[bucket] });
+		heads_[bucket] = static_cast<int32_t>(nodes_.size() - 1);
+		occupied_[bucket >> 6] |= uint64_t{ 1 } << (bucket & 63);
+		++size_;
+	}
+
+	// Removes and returns a value with the lowest priority; most recently
+	// pushed first among equals. The queue must not be empty.
+	int32_t pop() noexcept
+	{
+		assert(size_ > 0 && "BucketQueue::pop on empty queue");
+
+		const int bucket = next_occupied(cursor_ & mask_);
+		cursor_ += (bucket - (cursor_ & mask_)) & mask_;
+
+		const Node node = nodes_[heads_[bucket]];
+		heads_[bucket] = node.next;
+		if (node.next == NONE)
+		{
+			occupied_[bucket >> 6] &= ~(uint64_t{ 1 } << (bucket & 63));
+		}
+		--size_;
+		return node.value;
+	}
+
+private:
+	static constexpr int32_t NONE = -1;
+
+	struct Node
+	{
+		int32_t value;
+		int32_t next;
+	};
+
+	std::vector<int32_t> heads_;
+	std::vector<Node> nodes_;
+	std::vector<uint64_t> occupied_;
+	int mask_{ 0 };
+	int cursor_{ 0 };
+	size_t size_{ 0 };
+
+	// First occupied bucket at or after start, wrapping around the ring.
+	int next_occupied(int start) const noexcept
+	{
+		const size_t words = occupied_.size();
+		size_t w = static_cast<size_t>(start) >> 6;
+		uint64_t word = occupied_[w] & (~uint64_t{ 0 } << (start & 63));
+		for (size_t step = 0; step <= words; ++step)
+		{
+			if (word != 0)
+			{
+				return static_cast<int>(w * 64 + static_cast<size_t>(std::countr_zero(word)));
+			}
+			w = (w + 1) % words;
+			word = occupied_[w];
+		}
+		return start;
+	}
+};
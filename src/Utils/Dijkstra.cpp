@@ -1,25 +1,234 @@
 #include <algorithm>
-#include <functional>
-#include <limits>
-#include <queue>
+#include <cstdint>
+#include <cstdlib>
 #include <vector>
 
-#include "../Actor/Attacker.h"
+#include "../Actor/Creature.h"
+#include "../Map/BitPlane.h"
+#include "../Map/Decoration.h"
 #include "../Map/Map.h"
+#include "../Map/TileGrid.h"
+#include "../Systems/Profiler.h"
 #include "Dijkstra.h"
 #include "Vector2D.h"
 
+namespace
+{
+	constexpr uint8_t JUMP_OPEN = 1; // walkable and unoccupied
+	constexpr uint8_t JUMP_REGULAR = 2; // cost 1 with no other-cost open tile around it
+
+	int sign(int value) noexcept
+	{
+		return (value > 0) - (value < 0);
+	}
+
+	// Widest priority spread the open list can hold: one occupied-goal step
+	// plus the longest jump (diagonal cost and heuristic change per step).
+	int frontier_span(int width, int height) noexcept
+	{
+		const int longestRun = std::max(width, height);
+		return Dijkstra::OCCUPIED_GOAL_COST + longestRun * (Dijkstra::DIAGONAL_STEP_COST + Dijkstra::STEP_COST) + 1;
+	}
+}
+
+// ---------------------------------------------------------------------------
+// SearchGrid -- the map as one search sees it: goal rules, step costs and
+// the regularity test Jump Point Search uses to decide where it may prune.
+// ---------------------------------------------------------------------------
+class Dijkstra::SearchGrid
+{
+public:
+	SearchGrid(
+		Map& map,
+		const GameContext& ctx,
+		Vector2D start,
+		Vector2D goal,
+		int width,
+		int height,
+		const uint8_t* cells)
+		: map(map),
+		  tiles(map.get_tile_grid()),
+		  walkable(map.get_walkable_plane()),
+		  ctx(ctx),
+		  goal(goal),
+		  width(width),
+		  height(height),
+		  startIndex(start.y * width + start.x),
+		  goalIndex(goal.y * width + goal.x),
+		  // Allow the goal even if occupied or a closed door; exclude only solid walls
+		  goalOpen(!map.is_wall(goal) || tiles.type(goalIndex) == TileType::CLOSED_DOOR),
+		  goalOccupied(map.get_actor(goal, ctx) != nullptr),
+		  cells(cells)
+	{
+	}
+
+	Map& map;
+	const TileGrid& tiles;
+	const BitPlane& walkable;
+	const GameContext& ctx;
+	Vector2D goal;
+	int width;
+	int height;
+	int startIndex;
+	int goalIndex;
+	bool goalOpen;
+	bool goalOccupied;
+	const uint8_t* cells; // prepare_jump_cells snapshot, or null to ask the map
+
+	int index_of(int x, int y) const noexcept { return y * width + x; }
+	int estimate(int x, int y) const noexcept { return heuristic(Vector2D{ x, y }, goal); }
+
+	bool is_open(int x, int y) const noexcept
+	{
+		if (x < 0 || x >= width || y < 0 || y >= height)
+		{
+			return false;
+		}
+		const int index = index_of(x, y);
+		if (index == goalIndex)
+		{
+			return goalOpen;
+		}
+		if (cells != nullptr)
+		{
+			return (cells[index] & JUMP_OPEN) != 0;
+		}
+		// Walls fail on the bit plane; creatures, doors and decorations need can_walk.
+		return walkable.test(static_cast<size_t>(index)) && map.can_walk(Vector2D{ x, y }, ctx);
+	}
+
+	int step_cost(int toIndex, bool diagonal) const noexcept
+	{
+		if (toIndex == goalIndex && goalOccupied)
+		{
+			return OCCUPIED_GOAL_COST;
+		}
+		return static_cast<int>(tiles.cost(toIndex)) * (diagonal ? DIAGONAL_STEP_COST : STEP_COST);
+	}
+
+	// A cost-1 tile none of whose walkable neighbours costs anything else
+	// (or is the goal). Only here are all detours around a step equally
+	// priced, which is what makes JPS pruning cost-safe.
+	bool is_regular(int x, int y) const noexcept
+	{
+		if (cells != nullptr)
+		{
+			const bool besideGoal = std::abs(x - goal.x) <= 1 && std::abs(y - goal.y) <= 1;
+			return !besideGoal && (cells[index_of(x, y)] & JUMP_REGULAR) != 0;
+		}
+
+		const int index = index_of(x, y);
+		if (index == goalIndex || tiles.cost(index) != 1.0)
+		{
+			return false;
+		}
+		for (int ny = y - 1; ny <= y + 1; ++ny)
+		{
+			for (int nx = x - 1; nx <= x + 1; ++nx)
+			{
+				if (nx < 0 || nx >= width || ny < 0 || ny >= height)
+				{
+					continue;
+				}
+				const int neighbour = index_of(nx, ny);
+				if (neighbour == goalIndex || (tiles.cost(neighbour) != 1.0 && is_open(nx, ny)))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+};
+
 Dijkstra::Dijkstra(int width, int height)
-	: width(width), infinity(std::numeric_limits<double>::infinity())
+	: width(width), height(height), frontier(frontier_span(width, height))
 {
-	// Pre-allocate work vectors once; they'll be reused and cleared each search
+	// Allocate per-tile scratch once; begin_search invalidates it by generation
 	const size_t gridSize = static_cast<size_t>(width) * height;
-	cameFrom.resize(gridSize);
+	visitedGeneration.assign(gridSize, 0);
 	costSoFar.resize(gridSize);
+	cameFrom.resize(gridSize);
+}
+
+void Dijkstra::begin_search()
+{
+	++generation;
+	if (generation == 0)
+	{
+		// Wrapped after 2^32 searches: stale stamps could now match, so reset once.
+		std::fill(visitedGeneration.begin(), visitedGeneration.end(), 0);
+		generation = 1;
+	}
+	frontier.clear();
+	expandedCount = 0;
+}
+
+bool Dijkstra::find_path(
+	Map& graph,
+	Vector2D start,
+	Vector2D goal,
+	PathAlgorithm algorithm,
+	const GameContext& ctx,
+	std::vector<Vector2D>& outPath)
+{
+	outPath.clear();
+	const auto inside = [this](Vector2D pos)
+	{
+		return pos.x >= 0 && pos.x < width && pos.y >= 0 && pos.y < height;
+	};
+	if (!inside(start) || !inside(goal))
+	{
+		return false;
+	}
+
+	begin_search();
+	const bool jumping = algorithm == PathAlgorithm::JUMP_POINT;
+	uint8_t* cells = jumping ? prepare_jump_cells(graph, ctx) : nullptr;
+	const SearchGrid grid{ graph, ctx, start, goal, width, height, cells };
+
+	switch (algorithm)
+	{
+
+	case PathAlgorithm::DIJKSTRA:
+	{
+		search_astar(grid, false);
+		break;
+	}
+
+	case PathAlgorithm::ASTAR:
+	{
+		search_astar(grid, true);
+		break;
+	}
+
+	case PathAlgorithm::JUMP_POINT:
+	{
+		search_jump_point(grid);
+		break;
+	}
+
+	}
+	PROFILE_COUNT(ProfileCounter::PATH_NODES, expandedCount);
+
+	if (cells != nullptr)
+	{
+		// Hand the map back its snapshot without this search's blockers.
+		for (int index : jumpBlocked)
+		{
+			cells[index] |= JUMP_OPEN;
+		}
+	}
+
+	if (!is_visited(grid.goalIndex))
+	{
+		return false;
+	}
+
+	reconstruct_path(grid.startIndex, grid.goalIndex, outPath);
+	return true;
 }
 
-// set AStar true for A* search, false for Dijkstra's search
-// returns a vector of the path
 std::vector<Vector2D> Dijkstra::a_star_search(
 	Map& graph,
 	Vector2D start,
@@ -27,96 +236,375 @@ std::vector<Vector2D> Dijkstra::a_star_search(
 	bool AStar,
 	const GameContext& ctx)
 {
-	// Reuse persistent work vectors; just reset them for this search
-	// Clear and re-initialize the work vectors (fast: just fills existing capacity)
-	// cameFrom[i] -> Stores which node led to this node
-	// costSoFar[i] -> Stores the lowest cost found to reach this node
-	std::fill(cameFrom.begin(), cameFrom.end(), Vector2D{ -1, -1 });
-	std::fill(costSoFar.begin(), costSoFar.end(), infinity);
-
-	// Priority queue for processing nodes, ordered by lowest cost (min-heap)
-	std::priority_queue<FrontierNode, std::vector<FrontierNode>, std::greater<FrontierNode>> frontier;
-	// Push the start node to the frontier
-	frontier.emplace(start, 0);
-
-	// Get the index of the starting position in the 1D vector representation of the grid
-	const size_t startIndex = graph.get_index(start);
-	cameFrom[startIndex] = start; // The start node leads to itself
-	costSoFar[startIndex] = 0; // Cost to reach the start is 0
-
-	// Process nodes until there are none left in the priority queue
+	std::vector<Vector2D> path;
+	find_path(graph, start, goal, AStar ? PathAlgorithm::ASTAR : PathAlgorithm::DIJKSTRA, ctx, path);
+	return path;
+}
+
+// What JUMP_POINT asks of every tile it scans. Jumps re-read the same rows
+// many times, so a flat snapshot replaces thousands of can_walk calls. Walls,
+// closed doors and costs change rarely: that part is cached on the map and
+// rebuilt only when one of them changed. Creatures and decorations move or
+// break between searches, so each search just closes the cells they stand on
+// (find_path reopens them afterwards) -- O(blockers), not O(map).
+//
+// Regularity is computed without those blockers. A blocked tile of another
+// cost then still keeps its neighbours irregular, which only costs pruning,
+// never path cost.
+uint8_t* Dijkstra::prepare_jump_cells(Map& graph, const GameContext& ctx)
+{
+	const size_t count = static_cast<size_t>(width) * height;
+	bool stale = false;
+	std::vector<uint8_t>& cells = graph.take_path_cells(stale);
+	if (stale || cells.size() != count)
+	{
+		build_jump_cells(graph, cells);
+	}
+
+	jumpBlocked.clear();
+	const auto block = [&](Vector2D pos)
+	{
+		if (pos.x >= 0 && pos.x < width && pos.y >= 0 && pos.y < height)
+		{
+			const int index = pos.y * width + pos.x;
+			if ((cells[index] & JUMP_OPEN) != 0)
+			{
+				cells[index] &= static_cast<uint8_t>(~JUMP_OPEN);
+				jumpBlocked.push_back(index);
+			}
+		}
+	};
+	if (ctx.player)
+	{
+		block(ctx.player->position);
+	}
+	if (ctx.creatures)
+	{
+		for (const auto& creature : *ctx.creatures)
+		{
+			if (creature && !creature->is_dead())
+			{
+				block(creature->position);
+			}
+		}
+	}
+	if (ctx.decorations)
+	{
+		for (const auto& decoration : *ctx.decorations)
+		{
+			if (decoration && !decoration->isBroken)
+			{
+				block(decoration->position);
+			}
+		}
+	}
+	return cells.data();
+}
+
+// Open mirrors the static half of Map::can_walk: walkable and not a closed
+// door.
+void Dijkstra::build_jump_cells(const Map& graph, std::vector<uint8_t>& cells)
+{
+	const TileGrid& tiles = graph.get_tile_grid();
+	const BitPlane& walkable = graph.get_walkable_plane();
+	const size_t count = static_cast<size_t>(width) * height;
+	cells.resize(count);
+	jumpSpecial.resize(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const bool open = walkable.test(i) && tiles.type(i) != TileType::CLOSED_DOOR;
+		cells[i] = open ? JUMP_OPEN : 0;
+	}
+
+	// Regular = cost 1 with no special (open, other-cost) tile in its 3x3:
+	// OR specials across each row triple, then down each column triple.
+	for (size_t i = 0; i < count; ++i)
+	{
+		jumpSpecial[i] = (cells[i] & JUMP_OPEN) != 0 && tiles.cost(i) != 1.0;
+	}
+	for (int y = 0; y < height; ++y)
+	{
+		uint8_t* row = &jumpSpecial[static_cast<size_t>(y) * width];
+		uint8_t previous = 0;
+		for (int x = 0; x < width; ++x)
+		{
+			const uint8_t current = row[x] & 1;
+			const uint8_t next = x + 1 < width ? (row[x + 1] & 1) : 0;
+			row[x] = static_cast<uint8_t>(row[x] | ((previous | current | next) << 1));
+			previous = current;
+		}
+	}
+	for (int y = 0; y < height; ++y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			const size_t i = static_cast<size_t>(y) * width + x;
+			uint8_t nearSpecial = jumpSpecial[i] >> 1;
+			if (y > 0)
+			{
+				nearSpecial |= jumpSpecial[i - width] >> 1;
+			}
+			if (y + 1 < height)
+			{
+				nearSpecial |= jumpSpecial[i + width] >> 1;
+			}
+			if (nearSpecial == 0 && tiles.cost(i) == 1.0)
+			{
+				cells[i] |= JUMP_REGULAR;
+			}
+		}
+	}
+}
+
+void Dijkstra::relax(int fromIndex, int toIndex, int stepCost, int estimate)
+{
+	const int newCost = costSoFar[fromIndex] + stepCost;
+	if (!is_visited(toIndex) || newCost < costSoFar[toIndex])
+	{
+		visitedGeneration[toIndex] = generation;
+		costSoFar[toIndex] = newCost;
+		cameFrom[toIndex] = fromIndex;
+		frontier.push(toIndex, newCost + estimate);
+	}
+}
+
+void Dijkstra::search_astar(const SearchGrid& grid, bool useHeuristic)
+{
+	const auto estimate = [&](int x, int y)
+	{
+		return useHeuristic ? grid.estimate(x, y) : 0;
+	};
+
+	const int startIndex = grid.startIndex;
+	visitedGeneration[startIndex] = generation;
+	costSoFar[startIndex] = 0;
+	cameFrom[startIndex] = startIndex;
+	frontier.push(startIndex, estimate(startIndex % width, startIndex / width));
+
 	while (!frontier.empty())
 	{
-		// Get the node with the lowest cost from the priority queue
-		Vector2D current = frontier.top().vertex;
-		frontier.pop(); // Remove it from the queue
+		const int currentIndex = frontier.pop();
+		const int x = currentIndex % width;
+		const int y = currentIndex / width;
 
-		// If we reached the goal, stop searching (optional optimization)
-		if (current == goal)
+		// Lazy deletion: a cheaper route was queued after this entry.
+		if (frontier.cursor() != costSoFar[currentIndex] + estimate(x, y))
+		{
+			continue;
+		}
+
+		++expandedCount;
+		if (currentIndex == grid.goalIndex)
 		{
 			break;
 		}
 
-		// Explore all valid neighbors of the current node (pass goal to allow reaching target)
-		for (Vector2D next : graph.neighbors(current, ctx, goal))
+		// see "Ugly paths" section for an explanation of the alternating order
+		const bool reversed = (x + y) % 2 == 0;
+		for (int i = 0; i < 8; ++i)
+		{
+			const int dir = reversed ? 7 - i : i;
+			const int nx = x + DIR_X[dir];
+			const int ny = y + DIR_Y[dir];
+			if (!grid.is_open(nx, ny))
+			{
+				continue;
+			}
+
+			const int nextIndex = grid.index_of(nx, ny);
+			const bool diagonal = DIR_X[dir] != 0 && DIR_Y[dir] != 0;
+			relax(currentIndex, nextIndex, grid.step_cost(nextIndex, diagonal), estimate(nx, ny));
+		}
+	}
+}
+
+void Dijkstra::search_jump_point(const SearchGrid& grid)
+{
+	const int startIndex = grid.startIndex;
+	visitedGeneration[startIndex] = generation;
+	costSoFar[startIndex] = 0;
+	cameFrom[startIndex] = startIndex;
+	frontier.push(startIndex, grid.estimate(startIndex % width, startIndex / width));
+
+	while (!frontier.empty())
+	{
+		const int currentIndex = frontier.pop();
+		const int x = currentIndex % width;
+		const int y = currentIndex / width;
+
+		if (frontier.cursor() != costSoFar[currentIndex] + grid.estimate(x, y))
+		{
+			continue;
+		}
+
+		++expandedCount;
+		if (currentIndex == grid.goalIndex)
 		{
-			const size_t currentIndex = graph.get_index(current); // Get index of the current node
-			const size_t nextIndex = graph.get_index(next); // Get index of the next node
+			break;
+		}
 
-			// If this new path is better (lower cost) than the previously known cost
-			double new_cost = costSoFar[currentIndex] + graph.cost(current, next, ctx);
+		// Directions worth jumping in: all eight from the start and from
+		// irregular tiles, otherwise the natural and forced neighbours of
+		// the direction we arrived in.
+		std::array<Vector2D, 8> dirs{};
+		int dirCount = 0;
+		const auto add = [&](int dx, int dy)
+		{
+			dirs[dirCount++] = Vector2D{ dx, dy };
+		};
 
-			if (costSoFar[nextIndex] == infinity || new_cost < costSoFar[nextIndex])
+		if (currentIndex == startIndex || !grid.is_regular(x, y))
+		{
+			for (int dir = 0; dir < 8; ++dir)
+			{
+				add(DIR_X[dir], DIR_Y[dir]);
+			}
+		}
+		else
+		{
+			const int parent = cameFrom[currentIndex];
+			const int dx = sign(x - parent % width);
+			const int dy = sign(y - parent / width);
+			if (dx != 0 && dy != 0)
+			{
+				add(dx, 0);
+				add(0, dy);
+				add(dx, dy);
+				if (!grid.is_open(x - dx, y))
+				{
+					add(-dx, dy);
+				}
+				if (!grid.is_open(x, y - dy))
+				{
+					add(dx, -dy);
+				}
+			}
+			else if (dx != 0)
+			{
+				add(dx, 0);
+				if (!grid.is_open(x, y + 1))
+				{
+					add(dx, 1);
+				}
+				if (!grid.is_open(x, y - 1))
+				{
+					add(dx, -1);
+				}
+			}
+			else
 			{
-				costSoFar[nextIndex] = new_cost; // Update cost to reach this node
-				if (AStar) // for A* search
+				add(0, dy);
+				if (!grid.is_open(x + 1, y))
 				{
-					double priority = new_cost + heuristic(next, goal);
-					frontier.emplace(next, priority);
+					add(1, dy);
 				}
-				else // for Dijkstra's search
+				if (!grid.is_open(x - 1, y))
 				{
-					frontier.emplace(next, new_cost);
+					add(-1, dy);
 				}
-				cameFrom[nextIndex] = current;
 			}
 		}
+
+		for (int i = 0; i < dirCount; ++i)
+		{
+			const Vector2D dir = dirs[i];
+			int steps = 0;
+			const int jumpIndex = jump(grid, x, y, dir.x, dir.y, steps);
+			if (jumpIndex < 0)
+			{
+				continue;
+			}
+
+			// Every tile before the jump point is regular, so costs 1.
+			const bool diagonal = dir.x != 0 && dir.y != 0;
+			const int runCost = (steps - 1) * (diagonal ? DIAGONAL_STEP_COST : STEP_COST);
+			relax(
+				currentIndex,
+				jumpIndex,
+				runCost + grid.step_cost(jumpIndex, diagonal),
+				grid.estimate(jumpIndex % width, jumpIndex / width));
+		}
 	}
-	return reconstruct_path(start, goal, cameFrom);
 }
 
-std::vector<Vector2D> Dijkstra::reconstruct_path(
-	Vector2D start, // The starting position
-	Vector2D goal, // The goal position
-	const std::vector<Vector2D>& cameFrom // Stores the previous node in the path
-)
+// Steps from (x, y) in direction (dx, dy) until a tile where the path may
+// turn: the goal, an irregular tile, or one with a forced neighbour. Returns
+// its index and the number of steps taken, or -1 when a blocker is hit first.
+int Dijkstra::jump(const SearchGrid& grid, int x, int y, int dx, int dy, int& steps) const
 {
-	std::vector<Vector2D> path; // Stores the reconstructed path
-	Vector2D current = goal; // Start reconstruction from the goal
-
-	// use labmda for index
-	auto get_index = [this](Vector2D pos)
+	steps = 0;
+	while (true)
 	{
-		return pos.y * width + pos.x;
-	};
+		x += dx;
+		y += dy;
+		++steps;
+		if (!grid.is_open(x, y))
+		{
+			return -1;
+		}
 
-	int goalIndex = get_index(goal);
+		const int index = grid.index_of(x, y);
+		if (index == grid.goalIndex || !grid.is_regular(x, y))
+		{
+			return index;
+		}
 
-	// Check if the goal is reachable by looking at its cameFrom value
-	if (cameFrom.at(goalIndex) == Vector2D{ -1, -1 })
-	{
-		return path; // No path found, return empty vector
+		if (dx != 0 && dy != 0)
+		{
+			if ((!grid.is_open(x - dx, y) && grid.is_open(x - dx, y + dy))
+				|| (!grid.is_open(x, y - dy) && grid.is_open(x + dx, y - dy)))
+			{
+				return index;
+			}
+
+			// A diagonal tile is a jump point if either straight run from it finds one.
+			int ignored = 0;
+			if (jump(grid, x, y, dx, 0, ignored) >= 0 || jump(grid, x, y, 0, dy, ignored) >= 0)
+			{
+				return index;
+			}
+		}
+		else if (dx != 0)
+		{
+			if ((!grid.is_open(x, y + 1) && grid.is_open(x + dx, y + 1))
+				|| (!grid.is_open(x, y - 1) && grid.is_open(x + dx, y - 1)))
+			{
+				return index;
+			}
+		}
+		else
+		{
+			if ((!grid.is_open(x + 1, y) && grid.is_open(x + 1, y + dy))
+				|| (!grid.is_open(x - 1, y) && grid.is_open(x - 1, y + dy)))
+			{
+				return index;
+			}
+		}
 	}
+}
 
-	// Reconstruct the path by tracing back from goal to start
-	while (current != start)
+void Dijkstra::reconstruct_path(int startIndex, int goalIndex, std::vector<Vector2D>& outPath) const
+{
+	// Trace back from goal to start, then flip into walking order
+	int current = goalIndex;
+	while (current != startIndex)
 	{
-		path.push_back(current); // Add the current node to the path
-		int currentIndex = get_index(current); // Get the index of the current node
-		current = cameFrom.at(currentIndex); // Move to the previous node
+		const int previous = cameFrom[current];
+		const int px = previous % width;
+		const int py = previous / width;
+		int x = current % width;
+		int y = current / width;
+		const int dx = sign(px - x);
+		const int dy = sign(py - y);
+		while (x != px || y != py)
+		{
+			outPath.push_back(Vector2D{ x, y });
+			x += dx;
+			y += dy;
+		}
+		current = previous;
 	}
-
-	path.push_back(start); // Optional: Include the starting point
-	std::reverse(path.begin(), path.end()); // Reverse the path to get it from start to goal
-	return path;
+	outPath.push_back(Vector2D{ startIndex % width, startIndex / width });
+	std::reverse(outPath.begin(), outPath.end());
 }
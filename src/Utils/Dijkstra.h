@@ -1,51 +1,116 @@
 #pragma once
 
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <vector>
 
 #include "../Map/Map.h"
+#include "BucketQueue.h"
 #include "Vector2D.h"
 
 struct GameContext;
 
-class Dijkstra
+// ---------------------------------------------------------------------------
+// PathAlgorithm -- search strategy, chosen per call.
+//
+// DIJKSTRA expands by cost alone, ASTAR adds the Chebyshev heuristic.
+// JUMP_POINT is A* with Jump Point Search pruning: across runs of cost-1
+// tiles it skips straight to the cells where the path could turn, and falls
+// back to full expansion beside water, door or goal tiles so path cost
+// always equals ASTAR's. The jump scans read a per-tile snapshot instead of
+// calling back into the map: walls, closed doors and costs are cached on the
+// map until they change, and each search closes the cells creatures and
+// decorations stand on, so dynamic blockers stop it exactly as they stop
+// ASTAR.
+// ---------------------------------------------------------------------------
+enum class PathAlgorithm
 {
-private:
-	int width;
-	double infinity;
-	std::vector<Vector2D> cameFrom; // Persistent work vector (reused across calls)
-	std::vector<double> costSoFar; // Persistent work vector (reused across calls)
+	DIJKSTRA,
+	ASTAR,
+	JUMP_POINT
+};
 
+// ---------------------------------------------------------------------------
+// Dijkstra -- reusable grid A* / Dijkstra engine (one per game, ctx.pathfinder).
+//
+// Per-search state lives in flat per-tile arrays stamped with a generation
+// number, so starting a search is O(1) instead of refilling every tile.
+// Costs are integers in tenths of a tile step (cardinal 10 x tile cost,
+// diagonal 14 x tile cost) and the open list is a BucketQueue. Neighbours
+// are expanded in place from a fixed direction table and paths are written
+// into a caller-owned buffer, so a search allocates nothing once warm.
+// ---------------------------------------------------------------------------
+class Dijkstra
+{
 public:
+	static constexpr int STEP_COST = 10; // cardinal step over a cost-1 tile
+	static constexpr int DIAGONAL_STEP_COST = 14; // ~10 * sqrt(2)
+	static constexpr int OCCUPIED_GOAL_COST = 10000; // stepping onto a creature at the goal
+
 	Dijkstra(int width, int height);
+
+	// Finds a path from start to goal (both included) and writes it to
+	// outPath, replacing its contents. The goal may be occupied or a closed
+	// door. Returns false and leaves outPath empty when unreachable.
+	bool find_path(
+		Map& graph,
+		Vector2D start,
+		Vector2D goal,
+		PathAlgorithm algorithm,
+		const GameContext& ctx,
+		std::vector<Vector2D>& outPath);
+
+	// Convenience wrapper over find_path that returns a fresh vector.
+	// set AStar true for A* search, false for Dijkstra's search
 	std::vector<Vector2D> a_star_search(
 		Map& graph,
 		Vector2D start,
 		Vector2D goal,
 		bool AStar,
 		const GameContext& ctx);
-	std::vector<Vector2D> reconstruct_path(
-		Vector2D start, Vector2D goal, const std::vector<Vector2D>& cameFrom);
-	// Heuristic function for A* search
-	double heuristic(Vector2D a, Vector2D b)
-	{
-		// Chebyshev distance (max of absolute differences)
-		// Admissible for 8-directional movement where diagonals cost same as cardinal
-		int dx = std::abs(a.x - b.x);
-		int dy = std::abs(a.y - b.y);
-		return static_cast<double>(std::max(dx, dy));
-	}
-};
 
-// Structure to represent a node in the priority queue
-struct FrontierNode
-{
-	Vector2D vertex{}; // The current node (position in grid)
-	double weight{}; // The cost to reach this node
+	// Nodes taken off the open list by the most recent search.
+	int get_expanded_count() const noexcept { return expandedCount; }
 
-	// Comparator for priority queue (min-heap behavior)
-	bool operator>(const FrontierNode& other) const
+	// Chebyshev distance in cost units -- admissible and consistent because
+	// every walkable tile costs at least 1 and a diagonal costs no more than
+	// a cardinal step plus one.
+	static int heuristic(Vector2D a, Vector2D b) noexcept
 	{
-		return weight > other.weight; // Lower cost = higher priority
+		const int dx = std::abs(a.x - b.x);
+		const int dy = std::abs(a.y - b.y);
+		return STEP_COST * (dx > dy ? dx : dy);
 	}
+
+private:
+	class SearchGrid;
+
+	int width;
+	int height;
+	uint32_t generation{ 0 };
+	int expandedCount{ 0 };
+	std::vector<uint32_t> visitedGeneration; // == generation when the tile was reached this search
+	std::vector<int32_t> costSoFar; // valid only where visitedGeneration == generation
+	std::vector<int32_t> cameFrom; // tile index of the predecessor, same validity
+	BucketQueue frontier;
+	std::vector<uint8_t> jumpSpecial; // scratch: open tiles that do not cost 1
+	std::vector<int> jumpBlocked; // snapshot cells the current search closed
+
+	// DIRS order (N, NE, E, SE, S, SW, W, NW), as Map::neighbors walks it.
+	static constexpr std::array<int, 8> DIR_X{ 0, 1, 1, 1, 0, -1, -1, -1 };
+	static constexpr std::array<int, 8> DIR_Y{ -1, -1, 0, 1, 1, 1, 0, -1 };
+
+	void begin_search();
+	bool is_visited(int index) const noexcept { return visitedGeneration[index] == generation; }
+	void relax(int fromIndex, int toIndex, int stepCost, int estimate);
+	void search_astar(const SearchGrid& grid, bool useHeuristic);
+	void search_jump_point(const SearchGrid& grid);
+	uint8_t* prepare_jump_cells(Map& graph, const GameContext& ctx);
+	void build_jump_cells(const Map& graph, std::vector<uint8_t>& cells);
+	int jump(const SearchGrid& grid, int x, int y, int dx, int dy, int& steps) const;
+
+	// Walks cameFrom back from the goal; consecutive entries may be a
+	// straight or diagonal run apart (jump points) and are filled in.
+	void reconstruct_path(int startIndex, int goalIndex, std::vector<Vector2D>& outPath) const;
 };
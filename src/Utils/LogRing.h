@@ -0,0 +1,97 @@
+#pragma once
+// LogRing.h -- bounded lock-free multi-producer queue of log lines.
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// ---------------------------------------------------------------------------
+// LogRing -- fixed-capacity ring of (level, text) entries.
+//
+// Any number of threads may push; one thread pops (Logger's writer). Each
+// slot carries a sequence number that says whose turn it is: a producer
+// claims a slot with one compare-exchange on the head, fills it and
+// publishes it by bumping the slot's sequence; the consumer reads slots in
+// order the same way. Nobody ever blocks: a push into a full ring fails and
+// the caller decides what to drop. Strings are moved in and out, so a slot
+// keeps its buffer across uses once the ring is warm.
+// ---------------------------------------------------------------------------
+template <typename Level>
+class LogRing
+{
+public:
+	// capacity is rounded up to a power of two.
+	explicit LogRing(size_t capacity)
+		: slots_(std::make_unique<Slot[]>(std::bit_ceil(capacity < 2 ? size_t{ 2 } : capacity))),
+		  mask_(std::bit_ceil(capacity < 2 ? size_t{ 2 } : capacity) - 1)
+	{
+		for (size_t i = 0; i <= mask_; ++i)
+		{
+			slots_[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	size_t capacity() const noexcept { return mask_ + 1; }
+
+	// Moves text into the ring; false (text untouched) when the ring is full.
+	bool try_push(Level level, std::string& text)
+	{
+		size_t pos = head_.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			Slot& slot = slots_[pos & mask_];
+			const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+			const auto lag = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+			if (lag == 0)
+			{
+				if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					slot.level = level;
+					slot.text.swap(text);
+					text.clear();
+					slot.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (lag < 0)
+			{
+				return false; // the consumer has not freed this slot yet
+			}
+			else
+			{
+				pos = head_.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	// Moves the oldest entry out; false when the ring is empty. Single consumer.
+	bool try_pop(Level& level, std::string& text)
+	{
+		const size_t pos = tail_.load(std::memory_order_relaxed);
+		Slot& slot = slots_[pos & mask_];
+		if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+		{
+			return false;
+		}
+		level = slot.level;
+		text.swap(slot.text);
+		slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+		tail_.store(pos + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+private:
+	struct Slot
+	{
+		std::atomic<size_t> sequence{ 0 };
+		Level level{};
+		std::string text;
+	};
+
+	std::unique_ptr<Slot[]> slots_;
+	size_t mask_;
+	alignas(64) std::atomic<size_t> head_{ 0 }; // next slot to claim for a push
+	alignas(64) std::atomic<size_t> tail_{ 0 }; // next slot to pop
+};
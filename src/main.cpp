@@ -3,6 +3,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <string_view>
 
 #ifdef EMSCRIPTEN
 #include <emscripten/emscripten.h>
@@ -14,6 +15,7 @@
 #include "Factories/MonsterCreator.h"
 #include "Game.h"
 #include "Menu/Menu.h"
+#include "Systems/Logger.h"
 #include "Systems/SpellSystem.h"
 
 #ifdef EMSCRIPTEN
@@ -36,7 +38,7 @@ void emscripten_loop(void* arg)
 }
 #endif
 
-int main()
+int main(int argc, char* argv[])
 {
 	// Debug logging
 	std::ofstream debugFile;
@@ -51,30 +53,39 @@ int main()
 		std::cerr << "Warning: Could not open debug file: " << e.what() << std::endl;
 	}
 
-	std::clog << "STARTUP: Opened debug log\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Opened debug log");
 
 	// Load data before Game construction (MonsterFactory is built inside Map ctor).
-	std::clog << "STARTUP: Loading MonsterCreator\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Loading MonsterCreator");
 	MonsterCreator::load(Paths::MONSTERS);
-	std::clog << "STARTUP: Loading SpellSystem\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Loading SpellSystem");
 	SpellSystem::load(Paths::SPELLS);
-	std::clog << "STARTUP: Loading ItemCreator\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Loading ItemCreator");
 	ItemCreator::load(Paths::ITEMS);
-	std::clog << "STARTUP: Loading enhanced rules\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Loading enhanced rules");
 	ItemCreator::load_enhanced_rules(Paths::ENHANCED_RULES);
 
-	std::clog << "STARTUP: Creating Game\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Creating Game");
 	// Game owns everything including Renderer and InputSystem
 	auto game = std::make_unique<Game>();
-	std::clog << "STARTUP: Loading tile config\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Loading tile config");
 	game->tileConfig.load(Paths::TILE_CONFIG);
-	std::clog << "STARTUP: Initializing world\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Initializing world");
 	game->init_world();
 
-	std::clog << "STARTUP: Initializing renderer\n" << std::flush;
+	// --record FILE: keep the latest new game's seed and input for headless_exe --replay.
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (std::string_view{ argv[i] } == "--record")
+		{
+			game->inputRecorder.set_output(argv[i + 1]);
+		}
+	}
+
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Initializing renderer");
 	// Initialize raylib window (fullscreen, auto-detect resolution)
 	game->renderer.init();
-	std::clog << "STARTUP: Loading Dawnlike tileset\n" << std::flush;
+	Logger::instance().print<LogLevel::LOG_INFO>("STARTUP: Loading Dawnlike tileset");
 	game->renderer.load_dawnlike(Paths::DAWNLIKE_DIR);
 
 	game->renderer.load_font(Paths::DAWNLIKE_FONT, 16);
@@ -103,6 +114,9 @@ int main()
 	game->shutdown();
 	game->renderer.shutdown();
 
+	// Write out queued lines before the file behind std::clog goes away.
+	Logger::instance().shutdown();
+
 	if (debugFile.is_open())
 	{
 		try
@@ -0,0 +1,110 @@
+// file: HeadlessRunnerTest.cpp
+// Verifies the headless runner: BotPlayer plays a real game through
+// GameLoopCoordinator::update for the requested number of turns, the
+// report accounts for every update, and a recorded game replays to the
+// same state.
+
+#include <algorithm>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+#include "src/Core/Paths.h"
+#include "src/Factories/ItemCreator.h"
+#include "src/Factories/MonsterCreator.h"
+#include "src/Game.h"
+#include "src/Headless/BotPlayer.h"
+#include "src/Headless/HeadlessRunner.h"
+#include "src/Systems/InputRecorder.h"
+#include "src/Systems/SpellSystem.h"
+
+class HeadlessRunnerTest : public ::testing::Test
+{
+protected:
+	Game game;
+
+	void SetUp() override
+	{
+		try
+		{
+			MonsterCreator::load(Paths::MONSTERS);
+			SpellSystem::load(Paths::SPELLS);
+			ItemCreator::load(Paths::ITEMS);
+			ItemCreator::load_enhanced_rules(Paths::ENHANCED_RULES);
+			game.tileConfig.load(Paths::TILE_CONFIG);
+			game.prefabLibrary.load(Paths::PREFABS);
+		}
+		catch (...) {}
+		game.init_world();
+	}
+};
+
+TEST_F(HeadlessRunnerTest, BotPlaysRequestedTurns)
+{
+	HeadlessOptions options;
+	options.turns = 300;
+	options.seed = 7;
+
+	BotPlayer bot{ options.seed };
+	HeadlessRunner runner{ game };
+	const HeadlessReport report = runner.run(bot, options);
+
+	EXPECT_FALSE(report.stalled);
+	EXPECT_EQ(report.turns, 300);
+	EXPECT_GE(report.games, 1);
+	EXPECT_GE(report.deepestLevel, 1);
+	EXPECT_EQ(report.phase(HeadlessPhase::NEW_GAME).calls, report.games);
+	EXPECT_EQ(report.phase(HeadlessPhase::THINK).calls, report.updates);
+	EXPECT_EQ(report.phase(HeadlessPhase::TURN).calls + report.phase(HeadlessPhase::DESCENT).calls, report.updates);
+	EXPECT_GT(report.turns_per_second(), 0.0);
+	EXPECT_TRUE(game.menus.empty());
+}
+
+TEST_F(HeadlessRunnerTest, ReportListsEveryPhase)
+{
+	HeadlessReport report;
+	report.turns = 10;
+	const std::string text = format_report(report);
+
+	EXPECT_NE(text.find("turns/s"), std::string::npos);
+	for (int i = 0; i < static_cast<int>(HeadlessPhase::COUNT); ++i)
+	{
+		EXPECT_NE(text.find(phase_name(static_cast<HeadlessPhase>(i))), std::string::npos);
+	}
+}
+
+TEST_F(HeadlessRunnerTest, ReplayReproducesARecordedGame)
+{
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "headless_replay_test.rec";
+	HeadlessOptions options;
+	options.turns = 200;
+	options.seed = 11;
+	options.restartOnDeath = false;
+
+	game.inputRecorder.set_output(path);
+	BotPlayer bot{ options.seed };
+	HeadlessRunner runner{ game };
+	const HeadlessReport recorded = runner.run(bot, options);
+	ASSERT_TRUE(game.inputRecorder.finish(game.context()));
+
+	const InputRecording recording = InputRecording::read_file(path);
+	std::filesystem::remove(path);
+	const auto is_update = [](const InputStep& step) { return step.kind == InputStep::Kind::UPDATE; };
+	EXPECT_EQ(std::ranges::count_if(recording.steps, is_update), recorded.updates);
+
+	auto replayGame = std::make_unique<Game>();
+	try
+	{
+		replayGame->tileConfig.load(Paths::TILE_CONFIG);
+		replayGame->prefabLibrary.load(Paths::PREFABS);
+	}
+	catch (...) {}
+	replayGame->init_world();
+	HeadlessRunner replayer{ *replayGame };
+	const ReplayReport replayed = replayer.replay(recording);
+
+	EXPECT_EQ(replayed.steps, static_cast<int>(recording.steps.size()));
+	EXPECT_EQ(replayed.turns, recorded.turns);
+	EXPECT_TRUE(replayed.matches()) << format_replay(replayed);
+}
@@ -0,0 +1,104 @@
+// file: AutotileMasksTest.cpp
+// Verifies the precomputed autotile masks: floor and wall masks for a plain
+// room, and that patching after single-tile edits (including Map::set_tile
+// and doors) always matches a full rebuild.
+
+#include <gtest/gtest.h>
+#include <random>
+
+#include "../../src/Map/AutotileMasks.h"
+#include "../../src/Map/Map.h"
+#include "../../src/Map/TileGrid.h"
+#include "../../src/Utils/Vector2D.h"
+
+namespace
+{
+	constexpr int MASK_TEST_WIDTH = 24;
+	constexpr int MASK_TEST_HEIGHT = 16;
+
+	// Room floor spans [x1, x2] x [y1, y2]; everything else stays wall.
+	void dig_room(TileGrid& grid, int x1, int y1, int x2, int y2)
+	{
+		for (int y = y1; y <= y2; ++y)
+		{
+			for (int x = x1; x <= x2; ++x)
+			{
+				grid.set_type(grid.index_of(Vector2D{ x, y }), TileType::FLOOR);
+			}
+		}
+	}
+
+	void expect_matches_rebuild(const AutotileMasks& masks, const TileGrid& grid)
+	{
+		AutotileMasks fresh;
+		fresh.rebuild(grid);
+		ASSERT_EQ(masks.size(), fresh.size());
+		for (size_t i = 0; i < fresh.size(); ++i)
+		{
+			const Vector2D pos = grid.position_of(i);
+			ASSERT_EQ(masks.get(i), fresh.get(i)) << "tile " << pos.x << "," << pos.y;
+		}
+	}
+}
+
+TEST(AutotileMasksTest, RoomFloorAndWallMasks)
+{
+	TileGrid grid;
+	grid.resize(MASK_TEST_WIDTH, MASK_TEST_HEIGHT);
+	dig_room(grid, 2, 2, 6, 5);
+	AutotileMasks masks;
+	masks.rebuild(grid);
+
+	// Interior floor sees floor on all four sides; a corner floor only two.
+	EXPECT_EQ(masks.cardinal_mask(grid.index_of(Vector2D{ 4, 3 })), AutotileMasks::CARDINALS);
+	EXPECT_EQ(masks.cardinal_mask(grid.index_of(Vector2D{ 2, 2 })), AutotileMasks::EAST | AutotileMasks::SOUTH);
+
+	// The top wall runs east-west; the outer corner joins east and south.
+	const size_t topWall = grid.index_of(Vector2D{ 4, 1 });
+	EXPECT_TRUE(masks.is_border_wall(topWall));
+	EXPECT_EQ(masks.cardinal_mask(topWall), AutotileMasks::EAST | AutotileMasks::WEST);
+	const size_t corner = grid.index_of(Vector2D{ 1, 1 });
+	EXPECT_TRUE(masks.is_border_wall(corner));
+	EXPECT_EQ(masks.cardinal_mask(corner), AutotileMasks::EAST | AutotileMasks::SOUTH);
+
+	// Walls with no walkable neighbour are not drawn at all.
+	EXPECT_FALSE(masks.is_border_wall(grid.index_of(Vector2D{ 15, 10 })));
+	EXPECT_EQ(masks.get(grid.index_of(Vector2D{ 15, 10 })), 0);
+}
+
+TEST(AutotileMasksTest, PatchedEditsMatchRebuild)
+{
+	TileGrid grid;
+	grid.resize(MASK_TEST_WIDTH, MASK_TEST_HEIGHT);
+	dig_room(grid, 2, 2, 8, 7);
+	dig_room(grid, 12, 4, 20, 12);
+	AutotileMasks masks;
+	masks.rebuild(grid);
+
+	constexpr TileType types[]{
+		TileType::FLOOR, TileType::WALL, TileType::WATER,
+		TileType::CLOSED_DOOR, TileType::OPEN_DOOR, TileType::CORRIDOR };
+	std::mt19937 rng(77);
+	for (int edit = 0; edit < 500; ++edit)
+	{
+		const Vector2D pos{
+			static_cast<int>(rng() % MASK_TEST_WIDTH),
+			static_cast<int>(rng() % MASK_TEST_HEIGHT) };
+		grid.set_type(grid.index_of(pos), types[rng() % std::size(types)]);
+		masks.patch(grid, pos);
+		expect_matches_rebuild(masks, grid);
+	}
+}
+
+TEST(AutotileMasksTest, MapKeepsMasksInSyncWithTilesAndDoors)
+{
+	Map map{ MASK_TEST_WIDTH, MASK_TEST_HEIGHT };
+	map.init_tiles();
+	for (int x = 2; x <= 14; ++x)
+	{
+		map.set_tile(Vector2D{ x, 5 }, TileType::CORRIDOR, 1);
+	}
+	map.set_tile(Vector2D{ 8, 5 }, TileType::CLOSED_DOOR, 2);
+	map.set_tile(Vector2D{ 8, 5 }, TileType::OPEN_DOOR, 1);
+	expect_matches_rebuild(map.get_autotile_masks(), map.get_tile_grid());
+}
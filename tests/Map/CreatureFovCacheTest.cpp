@@ -0,0 +1,118 @@
+// file: CreatureFovCacheTest.cpp
+// Verifies per-creature FOV results match a direct FovMap computation and
+// that cached sets are reused until the viewer or the map changes.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "../../src/Actor/Creature.h"
+#include "../../src/Combat/HealthPool.h"
+#include "../../src/Map/CreatureFovCache.h"
+#include "../../src/Map/FovMap.h"
+#include "../../src/Utils/Vector2D.h"
+
+namespace
+{
+	constexpr int CACHE_TEST_WIDTH = 24;
+	constexpr int CACHE_TEST_HEIGHT = 16;
+	constexpr int CACHE_TEST_RADIUS = 4;
+}
+
+class CreatureFovCacheTest : public ::testing::Test
+{
+protected:
+	FovMap fov{ CACHE_TEST_WIDTH, CACHE_TEST_HEIGHT };
+	CreatureFovCache cache{ CACHE_TEST_RADIUS };
+	std::vector<std::unique_ptr<Creature>> creatures;
+
+	void SetUp() override
+	{
+		for (int y = 0; y < CACHE_TEST_HEIGHT; ++y)
+		{
+			for (int x = 0; x < CACHE_TEST_WIDTH; ++x)
+			{
+				fov.set_properties(x, y, true, true);
+			}
+		}
+		// A wall segment to cast a shadow
+		for (int y = 4; y <= 12; ++y)
+		{
+			fov.set_properties(10, y, false, false);
+		}
+	}
+
+	Creature& spawn(Vector2D pos)
+	{
+		auto creature = std::make_unique<Creature>(pos, ActorData{});
+		creature->healthPool = std::make_unique<HealthPool>(5);
+		creatures.push_back(std::move(creature));
+		return *creatures.back();
+	}
+};
+
+TEST_F(CreatureFovCacheTest, CanSee_MatchesFovMapFromSameOrigin)
+{
+	Creature& orc = spawn(Vector2D{ 8, 8 });
+
+	FovMap reference{ CACHE_TEST_WIDTH, CACHE_TEST_HEIGHT };
+	for (int y = 0; y < CACHE_TEST_HEIGHT; ++y)
+	{
+		for (int x = 0; x < CACHE_TEST_WIDTH; ++x)
+		{
+			reference.set_properties(x, y, fov.is_walkable(x, y), fov.is_transparent(x, y));
+		}
+	}
+	reference.compute_fov(8, 8, CACHE_TEST_RADIUS);
+
+	for (int y = 0; y < CACHE_TEST_HEIGHT; ++y)
+	{
+		for (int x = 0; x < CACHE_TEST_WIDTH; ++x)
+		{
+			EXPECT_EQ(cache.can_see(fov, orc, Vector2D{ x, y }), reference.is_in_fov(x, y))
+				<< "cell (" << x << "," << y << ")";
+		}
+	}
+}
+
+TEST_F(CreatureFovCacheTest, Refresh_ComputesOncePerViewer)
+{
+	Creature& orc = spawn(Vector2D{ 3, 3 });
+	spawn(Vector2D{ 15, 8 });
+
+	cache.refresh(fov, creatures);
+	EXPECT_EQ(cache.get_compute_count(), 2u);
+
+	cache.refresh(fov, creatures);
+	EXPECT_TRUE(cache.can_see(fov, orc, Vector2D{ 4, 4 }));
+	EXPECT_EQ(cache.get_compute_count(), 2u);
+}
+
+TEST_F(CreatureFovCacheTest, Moving_RecomputesOnlyThatViewer)
+{
+	Creature& orc = spawn(Vector2D{ 3, 3 });
+	spawn(Vector2D{ 15, 8 });
+	cache.refresh(fov, creatures);
+
+	orc.position = Vector2D{ 9, 8 };
+
+	EXPECT_FALSE(cache.can_see(fov, orc, Vector2D{ 11, 8 })); // behind the wall
+	EXPECT_EQ(cache.get_compute_count(), 3u);
+}
+
+TEST_F(CreatureFovCacheTest, MapChange_InvalidatesEntries)
+{
+	Creature& orc = spawn(Vector2D{ 9, 8 });
+	ASSERT_FALSE(cache.can_see(fov, orc, Vector2D{ 11, 8 }));
+
+	fov.set_properties(10, 8, true, true);
+
+	EXPECT_TRUE(cache.can_see(fov, orc, Vector2D{ 11, 8 }));
+}
+
+TEST_F(CreatureFovCacheTest, OutsideRadius_NotSeen)
+{
+	Creature& orc = spawn(Vector2D{ 3, 3 });
+
+	EXPECT_FALSE(cache.can_see(fov, orc, Vector2D{ 3 + CACHE_TEST_RADIUS + 1, 3 }));
+}
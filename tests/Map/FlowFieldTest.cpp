@@ -0,0 +1,256 @@
+// file: FlowFieldTest.cpp
+// Verifies that FlowField repairs (tiles opening and closing, decorations)
+// match a from-scratch BFS, that an unchanged update touches nothing, and
+// that Map keeps its player flow in sync with doors.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../../src/Core/GameContext.h"
+#include "../../src/Map/BitPlane.h"
+#include "../../src/Map/Decoration.h"
+#include "../../src/Map/FlowField.h"
+#include "../../src/Map/Map.h"
+#include "../../src/Utils/Vector2D.h"
+
+namespace
+{
+	constexpr int FLOW_TEST_WIDTH = 32;
+	constexpr int FLOW_TEST_HEIGHT = 20;
+
+	// Straightforward multi-source BFS over the same rules as FlowField.
+	std::vector<int> reference_costs(const BitPlane& passable, const std::vector<Vector2D>& goals, int width, int height)
+	{
+		std::vector<int> costs(static_cast<size_t>(width) * height, FlowField::UNREACHABLE);
+		std::vector<Vector2D> frontier;
+		for (const Vector2D& goal : goals)
+		{
+			costs[goal.y * width + goal.x] = 0;
+			frontier.push_back(goal);
+		}
+		for (size_t head = 0; head < frontier.size(); ++head)
+		{
+			const Vector2D current = frontier[head];
+			for (int dy = -1; dy <= 1; ++dy)
+			{
+				for (int dx = -1; dx <= 1; ++dx)
+				{
+					const Vector2D next{ current.x + dx, current.y + dy };
+					if (next.x < 0 || next.x >= width || next.y < 0 || next.y >= height)
+					{
+						continue;
+					}
+					const int index = next.y * width + next.x;
+					if (passable.test(index) && costs[index] == FlowField::UNREACHABLE)
+					{
+						costs[index] = costs[current.y * width + current.x] + 1;
+						frontier.push_back(next);
+					}
+				}
+			}
+		}
+		return costs;
+	}
+
+	void expect_matches_reference(const FlowField& field, const BitPlane& passable, const std::vector<Vector2D>& goals)
+	{
+		const auto expected = reference_costs(passable, goals, field.get_width(), field.get_height());
+		for (size_t i = 0; i < expected.size(); ++i)
+		{
+			ASSERT_EQ(field.cost(i), expected[i]) << "tile " << i % field.get_width() << "," << i / field.get_width();
+		}
+	}
+}
+
+class FlowFieldTest : public ::testing::Test
+{
+protected:
+	FlowField field;
+	BitPlane passable{ static_cast<size_t>(FLOW_TEST_WIDTH) * FLOW_TEST_HEIGHT };
+
+	void SetUp() override
+	{
+		field.resize(FLOW_TEST_WIDTH, FLOW_TEST_HEIGHT);
+		for (int y = 1; y < FLOW_TEST_HEIGHT - 1; ++y)
+		{
+			for (int x = 1; x < FLOW_TEST_WIDTH - 1; ++x)
+			{
+				passable.set(y * FLOW_TEST_WIDTH + x);
+			}
+		}
+		// A wall with one gap so distances wrap around it
+		for (int y = 1; y < FLOW_TEST_HEIGHT - 3; ++y)
+		{
+			passable.reset(y * FLOW_TEST_WIDTH + FLOW_TEST_WIDTH / 2);
+		}
+		field.assign_passable(passable);
+	}
+
+	void set_passable(int x, int y, bool value)
+	{
+		const int index = y * FLOW_TEST_WIDTH + x;
+		passable.assign(index, value);
+		field.set_passable(index, value);
+	}
+};
+
+TEST_F(FlowFieldTest, RebuildMatchesBreadthFirstSearch)
+{
+	const std::vector<Vector2D> goals{ Vector2D{ 3, 3 } };
+	field.update(goals);
+	expect_matches_reference(field, passable, goals);
+	EXPECT_EQ(field.cost(0), FlowField::UNREACHABLE);
+}
+
+TEST_F(FlowFieldTest, UnchangedUpdateTouchesNothing)
+{
+	const std::vector<Vector2D> goals{ Vector2D{ 3, 3 } };
+	field.update(goals);
+	field.reset_touched_count();
+
+	field.update(goals);
+	field.update(goals);
+	EXPECT_EQ(field.get_touched_count(), 0u);
+
+	// Re-asserting a tile's current passability is not a change either.
+	set_passable(5, 5, true);
+	field.update(goals);
+	EXPECT_EQ(field.get_touched_count(), 0u);
+}
+
+TEST_F(FlowFieldTest, ToggledTileRepairsLocally)
+{
+	const std::vector<Vector2D> goals{ Vector2D{ 4, 10 } };
+	field.update(goals);
+	field.reset_touched_count();
+
+	// A pillar beside the goal only lengthens the paths that bent around it.
+	set_passable(6, 10, false);
+	field.update(goals);
+	expect_matches_reference(field, passable, goals);
+	EXPECT_GT(field.get_touched_count(), 0u);
+	EXPECT_LT(field.get_touched_count(), static_cast<size_t>(FLOW_TEST_WIDTH) * FLOW_TEST_HEIGHT / 4);
+
+	field.reset_touched_count();
+	set_passable(6, 10, true);
+	field.update(goals);
+	expect_matches_reference(field, passable, goals);
+	EXPECT_LT(field.get_touched_count(), static_cast<size_t>(FLOW_TEST_WIDTH) * FLOW_TEST_HEIGHT / 4);
+}
+
+TEST_F(FlowFieldTest, ClosingTheGapOrphansTheFarSide)
+{
+	const std::vector<Vector2D> goals{ Vector2D{ 4, 4 } };
+	field.update(goals);
+	ASSERT_NE(field.cost(4 * FLOW_TEST_WIDTH + FLOW_TEST_WIDTH - 4), FlowField::UNREACHABLE);
+
+	for (int y = FLOW_TEST_HEIGHT - 3; y < FLOW_TEST_HEIGHT - 1; ++y)
+	{
+		set_passable(FLOW_TEST_WIDTH / 2, y, false);
+	}
+	field.update(goals);
+	expect_matches_reference(field, passable, goals);
+	EXPECT_EQ(field.cost(4 * FLOW_TEST_WIDTH + FLOW_TEST_WIDTH - 4), FlowField::UNREACHABLE);
+
+	set_passable(FLOW_TEST_WIDTH / 2, FLOW_TEST_HEIGHT - 2, true);
+	field.update(goals);
+	expect_matches_reference(field, passable, goals);
+}
+
+TEST_F(FlowFieldTest, MovedGoalRebuilds)
+{
+	std::vector<Vector2D> goals{ Vector2D{ 3, 3 } };
+	field.update(goals);
+	field.reset_touched_count();
+
+	goals[0] = Vector2D{ 4, 3 };
+	field.update(goals);
+	expect_matches_reference(field, passable, goals);
+	EXPECT_GE(field.get_touched_count(), static_cast<size_t>(FLOW_TEST_WIDTH) * FLOW_TEST_HEIGHT);
+}
+
+TEST_F(FlowFieldTest, RandomWalkWithToggledTilesMatchesRebuild)
+{
+	std::mt19937 rng(1234);
+	std::vector<Vector2D> goals{ Vector2D{ 2, 2 } };
+	field.update(goals);
+
+	for (int turn = 0; turn < 400; ++turn)
+	{
+		// Now and then step the goal onto a passable neighbour.
+		const Vector2D step{ static_cast<int>(rng() % 3) - 1, static_cast<int>(rng() % 3) - 1 };
+		const Vector2D next{ goals[0].x + step.x, goals[0].y + step.y };
+		if (rng() % 4 == 0 && passable.test(next.y * FLOW_TEST_WIDTH + next.x))
+		{
+			goals[0] = next;
+		}
+
+		// Open or close a few interior tiles, as doors and decorations do.
+		const int toggles = static_cast<int>(rng() % 3);
+		for (int i = 0; i < toggles; ++i)
+		{
+			const int x = 1 + static_cast<int>(rng() % (FLOW_TEST_WIDTH - 2));
+			const int y = 1 + static_cast<int>(rng() % (FLOW_TEST_HEIGHT - 2));
+			if (Vector2D{ x, y } != goals[0])
+			{
+				set_passable(x, y, !passable.test(y * FLOW_TEST_WIDTH + x));
+			}
+		}
+
+		field.update(goals);
+		expect_matches_reference(field, passable, goals);
+	}
+}
+
+TEST(FlowFieldMapTest, DoorsAndDecorationsFollowTheMap)
+{
+	Map map{ FLOW_TEST_WIDTH, FLOW_TEST_HEIGHT };
+	map.init_tiles();
+	std::vector<std::unique_ptr<Decoration>> decorations;
+	GameContext ctx;
+	ctx.map = &map;
+	ctx.decorations = &decorations;
+
+	// Two rooms joined by a single doorway at (10, 5).
+	for (int y = 1; y <= 9; ++y)
+	{
+		for (int x = 1; x <= 20; ++x)
+		{
+			if (x != 10)
+			{
+				map.set_tile(Vector2D{ x, y }, TileType::FLOOR, 1);
+			}
+		}
+	}
+	map.set_tile(Vector2D{ 10, 5 }, TileType::CLOSED_DOOR, 2);
+
+	const std::vector<Vector2D> goals{ Vector2D{ 3, 5 } };
+	const Vector2D farSide{ 18, 5 };
+	map.update_dijkstra_map(goals);
+	EXPECT_EQ(map.get_dijkstra_cost(farSide), FlowField::UNREACHABLE);
+
+	map.set_tile(Vector2D{ 10, 5 }, TileType::OPEN_DOOR, 1);
+	map.update_dijkstra_map(goals);
+	EXPECT_EQ(map.get_dijkstra_cost(farSide), 15);
+
+	auto crate = std::make_unique<Decoration>();
+	crate->position = Vector2D{ 10, 5 };
+	crate->isBroken = false;
+	Decoration& placed = *crate;
+	map.add_decoration(std::move(crate), ctx);
+	map.update_dijkstra_map(goals);
+	EXPECT_EQ(map.get_dijkstra_cost(farSide), FlowField::UNREACHABLE);
+
+	map.break_decoration(placed, ctx);
+	map.update_dijkstra_map(goals);
+	EXPECT_EQ(map.get_dijkstra_cost(farSide), 15);
+
+	// A full rebuild agrees with what the incremental updates left behind.
+	map.reset_dijkstra_touched_count();
+	map.update_dijkstra_map(goals);
+	EXPECT_EQ(map.get_dijkstra_touched_count(), 0u);
+	map.rebuild_dijkstra_map(goals);
+	EXPECT_EQ(map.get_dijkstra_cost(farSide), 15);
+}
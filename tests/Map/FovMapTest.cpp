@@ -0,0 +1,134 @@
+// file: FovMapTest.cpp
+// Verifies FovMap's visibility results, the visible-cell list it reports
+// for incremental explored-stamping, and that both FOV engines agree.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+#include "../../src/Map/FovMap.h"
+
+namespace
+{
+	constexpr int FOV_TEST_WIDTH = 30;
+	constexpr int FOV_TEST_HEIGHT = 20;
+	constexpr int FOV_TEST_RADIUS = 4;
+}
+
+class FovMapTest : public ::testing::Test
+{
+protected:
+	FovMap fov{ FOV_TEST_WIDTH, FOV_TEST_HEIGHT };
+
+	void SetUp() override
+	{
+		for (int y = 0; y < FOV_TEST_HEIGHT; ++y)
+		{
+			for (int x = 0; x < FOV_TEST_WIDTH; ++x)
+			{
+				fov.set_properties(x, y, true, true);
+			}
+		}
+	}
+};
+
+TEST_F(FovMapTest, VisibleCells_MatchVisiblePlane)
+{
+	fov.compute_fov(10, 10, FOV_TEST_RADIUS);
+
+	const auto& cells = fov.visible_cells();
+	EXPECT_EQ(cells.size(), fov.visible_plane().count());
+	for (int index : cells)
+	{
+		EXPECT_TRUE(fov.is_in_fov(index % FOV_TEST_WIDTH, index / FOV_TEST_WIDTH));
+	}
+}
+
+TEST_F(FovMapTest, VisibleCells_ListedOnce)
+{
+	fov.compute_fov(10, 10, FOV_TEST_RADIUS);
+
+	auto cells = fov.visible_cells();
+	std::sort(cells.begin(), cells.end());
+	EXPECT_EQ(std::adjacent_find(cells.begin(), cells.end()), cells.end());
+}
+
+TEST_F(FovMapTest, Recompute_ClearsPreviousVisibleSet)
+{
+	fov.compute_fov(5, 5, FOV_TEST_RADIUS);
+	ASSERT_TRUE(fov.is_in_fov(5, 5));
+
+	fov.compute_fov(24, 14, FOV_TEST_RADIUS);
+
+	EXPECT_FALSE(fov.is_in_fov(5, 5));
+	EXPECT_TRUE(fov.is_in_fov(24, 14));
+	EXPECT_EQ(fov.visible_cells().size(), fov.visible_plane().count());
+}
+
+TEST_F(FovMapTest, Wall_BlocksSightBehindIt)
+{
+	for (int y = 0; y < FOV_TEST_HEIGHT; ++y)
+	{
+		fov.set_properties(12, y, false, false);
+	}
+
+	fov.compute_fov(10, 10, FOV_TEST_RADIUS);
+
+	EXPECT_TRUE(fov.is_in_fov(12, 10));
+	EXPECT_FALSE(fov.is_in_fov(13, 10));
+}
+
+// ----------------------------------------------------------------------------
+// Differential test: ITERATIVE must match the RECURSIVE reference cell for
+// cell on random maps, origins (including map edges) and radii.
+// ----------------------------------------------------------------------------
+
+TEST(FovMapDifferentialTest, IterativeMatchesRecursive)
+{
+	std::mt19937 rng(20240601);
+	constexpr int MAP_COUNT = 40;
+	constexpr int ORIGINS_PER_MAP = 25;
+
+	for (int m = 0; m < MAP_COUNT; ++m)
+	{
+		const int width = 8 + static_cast<int>(rng() % 60);
+		const int height = 8 + static_cast<int>(rng() % 45);
+		const int wallPercent = static_cast<int>(rng() % 50);
+
+		FovMap reference{ width, height };
+		FovMap candidate{ width, height };
+		reference.set_algorithm(FovAlgorithm::RECURSIVE);
+		candidate.set_algorithm(FovAlgorithm::ITERATIVE);
+
+		for (int y = 0; y < height; ++y)
+		{
+			for (int x = 0; x < width; ++x)
+			{
+				const bool open = static_cast<int>(rng() % 100) >= wallPercent;
+				reference.set_properties(x, y, open, open);
+				candidate.set_properties(x, y, open, open);
+			}
+		}
+
+		for (int o = 0; o < ORIGINS_PER_MAP; ++o)
+		{
+			const int ox = static_cast<int>(rng() % width);
+			const int oy = static_cast<int>(rng() % height);
+			const int radius = 1 + static_cast<int>(rng() % 30);
+
+			reference.compute_fov(ox, oy, radius);
+			candidate.compute_fov(ox, oy, radius);
+
+			for (int y = 0; y < height; ++y)
+			{
+				for (int x = 0; x < width; ++x)
+				{
+					ASSERT_EQ(reference.is_in_fov(x, y), candidate.is_in_fov(x, y))
+						<< "map " << m << " origin (" << ox << "," << oy << ") radius " << radius
+						<< " cell (" << x << "," << y << ")";
+				}
+			}
+			ASSERT_EQ(reference.visible_cells().size(), candidate.visible_cells().size());
+		}
+	}
+}
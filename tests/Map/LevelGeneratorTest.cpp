@@ -0,0 +1,163 @@
+// file: LevelGeneratorTest.cpp
+// Verifies that a level depends only on its seed: generating twice, and
+// prefetching on the worker thread then entering, give the same level.
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "src/Actor/Creature.h"
+#include "src/Actor/Item.h"
+#include "src/Actor/Object.h"
+#include "src/Actor/Stairs.h"
+#include "src/ActorTypes/Player.h"
+#include "src/Combat/ExperienceReward.h"
+#include "src/Core/GameContext.h"
+#include "src/Core/Paths.h"
+#include "src/Factories/ItemCreator.h"
+#include "src/Factories/MonsterCreator.h"
+#include "src/Map/Decoration.h"
+#include "src/Map/DungeonRoom.h"
+#include "src/Map/LevelGenerator.h"
+#include "src/Map/Map.h"
+#include "src/Persistent/BinaryStream.h"
+#include "src/Systems/DataManager.h"
+#include "src/Systems/LevelManager.h"
+#include "src/Systems/MessageSystem.h"
+#include "tests/mocks/MockGameContext.h"
+
+namespace
+{
+	constexpr int LEVEL = 2;
+	constexpr long SEED = 987654;
+
+	std::vector<uint8_t> map_bytes(const Map& map)
+	{
+		BinaryWriter out;
+		map.save(out);
+		return std::vector<uint8_t>(out.data().begin(), out.data().end());
+	}
+
+	using Placement = std::tuple<std::string, int, int>;
+
+	template <typename T>
+	std::vector<Placement> placements(const std::vector<std::unique_ptr<T>>& actors)
+	{
+		std::vector<Placement> result;
+		for (const auto& actor : actors)
+		{
+			result.emplace_back(actor->actorData.name, actor->position.x, actor->position.y);
+		}
+		return result;
+	}
+
+	std::vector<std::tuple<int, int, int, int>> room_bounds(const std::vector<DungeonRoom>& rooms)
+	{
+		std::vector<std::tuple<int, int, int, int>> result;
+		for (const DungeonRoom& room : rooms)
+		{
+			result.emplace_back(room.col, room.row, room.width, room.height);
+		}
+		return result;
+	}
+}
+
+class LevelGeneratorTest : public ::testing::Test
+{
+protected:
+	MockGameContext mock;
+	GameContext ctx;
+	DataManager dataManager;
+	MessageSystem messageSystem;
+	LevelManager levelManager;
+	std::unique_ptr<Map> map;
+	std::unique_ptr<Player> player;
+	std::unique_ptr<Stairs> stairs;
+	std::vector<DungeonRoom> rooms;
+	std::vector<std::unique_ptr<Creature>> creatures;
+	std::vector<std::unique_ptr<Object>> objects;
+	std::vector<std::unique_ptr<Decoration>> decorations;
+
+	void SetUp() override
+	{
+		try
+		{
+			dataManager.load_all_data(messageSystem);
+			ItemCreator::load(Paths::ITEMS);
+			ItemCreator::load_enhanced_rules(Paths::ENHANCED_RULES);
+			MonsterCreator::load(Paths::MONSTERS);
+		}
+		catch (...) {}
+
+		map = std::make_unique<Map>(get_map_width(), get_map_height());
+		player = std::make_unique<Player>(Vector2D{ 1, 1 });
+		player->experienceReward = std::make_unique<ExperienceReward>(0);
+		player->healthPool = std::make_unique<HealthPool>(20);
+		stairs = std::make_unique<Stairs>(Vector2D{ 0, 0 });
+
+		ctx = mock.to_game_context();
+		ctx.map = map.get();
+		ctx.player = player.get();
+		ctx.stairs = stairs.get();
+		ctx.rooms = &rooms;
+		ctx.creatures = &creatures;
+		ctx.objects = &objects;
+		ctx.decorations = &decorations;
+		ctx.dataManager = &dataManager;
+		ctx.messageSystem = &messageSystem;
+		ctx.levelManager = &levelManager;
+		levelManager.set_dungeon_level(LEVEL);
+	}
+};
+
+TEST_F(LevelGeneratorTest, SameSeedGeneratesSameLevel)
+{
+	const LevelRequest request = LevelGenerator::make_request(ctx, LEVEL, SEED);
+	const auto first = LevelGenerator::generate(request);
+	const auto second = LevelGenerator::generate(request);
+
+	EXPECT_EQ(map_bytes(first->map), map_bytes(second->map));
+	EXPECT_EQ(room_bounds(first->rooms), room_bounds(second->rooms));
+	EXPECT_EQ(placements(first->creatures), placements(second->creatures));
+	EXPECT_EQ(placements(first->floorItems.items), placements(second->floorItems.items));
+	EXPECT_EQ(first->playerPosition, second->playerPosition);
+	EXPECT_EQ(first->stairsPosition, second->stairsPosition);
+	EXPECT_FALSE(first->rooms.empty());
+}
+
+TEST_F(LevelGeneratorTest, PrefetchedLevelMatchesSynchronous)
+{
+	const auto expected = LevelGenerator::generate(LevelGenerator::make_request(ctx, LEVEL, SEED));
+
+	LevelGenerator generator;
+	generator.prefetch(ctx, LEVEL, SEED);
+#ifndef EMSCRIPTEN
+	EXPECT_TRUE(generator.is_prefetched(LEVEL, SEED));
+#endif
+	EXPECT_FALSE(generator.is_prefetched(LEVEL, SEED + 1));
+	generator.enter_level(ctx, LEVEL, SEED);
+	EXPECT_FALSE(generator.is_prefetched(LEVEL, SEED));
+
+	EXPECT_EQ(map_bytes(*map), map_bytes(expected->map));
+	EXPECT_EQ(room_bounds(rooms), room_bounds(expected->rooms));
+	EXPECT_EQ(placements(creatures), placements(expected->creatures));
+	EXPECT_EQ(placements(mock.inventory.items), placements(expected->floorItems.items));
+	EXPECT_EQ(player->position, expected->playerPosition);
+	EXPECT_EQ(stairs->position, expected->stairsPosition);
+	EXPECT_EQ(map->get_seed(), SEED);
+}
+
+TEST_F(LevelGeneratorTest, MismatchedPrefetchGeneratesRequestedLevel)
+{
+	const auto expected = LevelGenerator::generate(LevelGenerator::make_request(ctx, LEVEL, SEED));
+
+	LevelGenerator generator;
+	generator.prefetch(ctx, LEVEL, SEED + 1);
+	generator.enter_level(ctx, LEVEL, SEED);
+
+	EXPECT_EQ(map_bytes(*map), map_bytes(expected->map));
+	EXPECT_EQ(stairs->position, expected->stairsPosition);
+}
@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 #include <limits>
+#include <stdexcept>
+#include <vector>
 
 #include "src/Map/Map.h"
 #include "src/Map/DungeonRoom.h"
+#include "src/Persistent/Base64.h"
+#include "src/Persistent/BinaryStream.h"
+#include "src/Persistent/RunLength.h"
+#include "src/Persistent/SaveFile.h"
 #include "src/Core/GameContext.h"
 #include "src/ActorTypes/Player.h"
 #include "src/Combat/ExperienceReward.h"
@@ -343,6 +349,118 @@ TEST_F(MapTest, Serialization_TilesPreserved)
     EXPECT_EQ(loadedMap->get_tile_type(testPos), TileType::WATER);
 }
 
+TEST_F(MapTest, Serialization_PlanesRestoreTilesExactly)
+{
+    for (int x = 3; x <= 8; ++x)
+    {
+        map->set_tile(Vector2D{x, 5}, TileType::FLOOR, 1.0);
+    }
+    map->set_tile(Vector2D{4, 5}, TileType::WATER, 10.0);
+    map->set_tile(Vector2D{9, 5}, TileType::CORRIDOR, 1.0); // a doorway post_process_doors would fill
+    map->compute_fov(ctx);
+
+    json j;
+    map->save(j);
+    EXPECT_FALSE(j.contains("tiles"));
+    ASSERT_TRUE(j.contains("planes"));
+    EXPECT_LT(j.dump().size(), 300u);
+
+    auto loadedMap = std::make_unique<Map>(TEST_MAP_HEIGHT, TEST_MAP_WIDTH);
+    loadedMap->load(j);
+
+    for (int y = 0; y < TEST_MAP_HEIGHT; ++y)
+    {
+        for (int x = 0; x < TEST_MAP_WIDTH; ++x)
+        {
+            const Vector2D pos{x, y};
+            EXPECT_EQ(loadedMap->get_tile_type(pos), map->get_tile_type(pos));
+            EXPECT_EQ(loadedMap->is_explored(pos), map->is_explored(pos));
+            EXPECT_EQ(loadedMap->get_cost(pos), map->get_cost(pos));
+        }
+    }
+    EXPECT_EQ(loadedMap->get_tile_type(Vector2D{9, 5}), TileType::CORRIDOR);
+
+    j["planes"]["types"] = "not base64!";
+    EXPECT_THROW(loadedMap->load(j), std::runtime_error);
+}
+
+TEST_F(MapTest, Serialization_BinaryRoundTrip)
+{
+    map->set_tile(Vector2D{5, 5}, TileType::WATER, 10.0);
+    map->set_tile(Vector2D{6, 5}, TileType::FLOOR, 1.0);
+    map->compute_fov(ctx);
+
+    BinaryWriter out;
+    map->save(out);
+
+    auto loadedMap = std::make_unique<Map>(TEST_MAP_HEIGHT, TEST_MAP_WIDTH);
+    BinaryReader in(out.data());
+    loadedMap->load(in, SaveWriter::VERSION);
+    EXPECT_TRUE(in.at_end());
+
+    ASSERT_EQ(loadedMap->get_width(), TEST_MAP_WIDTH);
+    ASSERT_EQ(loadedMap->get_height(), TEST_MAP_HEIGHT);
+    for (int y = 0; y < TEST_MAP_HEIGHT; ++y)
+    {
+        for (int x = 0; x < TEST_MAP_WIDTH; ++x)
+        {
+            const Vector2D pos{x, y};
+            EXPECT_EQ(loadedMap->get_tile_type(pos), map->get_tile_type(pos));
+            EXPECT_EQ(loadedMap->is_explored(pos), map->is_explored(pos));
+            EXPECT_EQ(loadedMap->get_cost(pos), map->get_cost(pos));
+        }
+    }
+
+    // A truncated section fails the load instead of reading past the end.
+    BinaryReader truncated(out.data().first(out.size() - 1));
+    EXPECT_THROW(loadedMap->load(truncated, SaveWriter::VERSION), std::runtime_error);
+}
+
+TEST_F(MapTest, Serialization_RejectsImplausibleSizes)
+{
+    auto loadedMap = std::make_unique<Map>(TEST_MAP_HEIGHT, TEST_MAP_WIDTH);
+
+    // Far past anything generation builds: rejected before allocating.
+    BinaryWriter huge;
+    huge.write_i32(50000);
+    huge.write_i32(50000);
+    huge.write_u64(0);
+    BinaryReader hugeIn(huge.data());
+    EXPECT_THROW(loadedMap->load(hugeIn, SaveWriter::VERSION), std::runtime_error);
+
+    // A plausible size whose format 1 planes cannot fit in the section.
+    BinaryWriter cut;
+    cut.write_i32(TEST_MAP_WIDTH);
+    cut.write_i32(TEST_MAP_HEIGHT);
+    cut.write_u64(0);
+    cut.write_u32(0);
+    BinaryReader cutIn(cut.data());
+    EXPECT_THROW(loadedMap->load(cutIn, 1), std::runtime_error);
+    EXPECT_EQ(loadedMap->get_width(), TEST_MAP_HEIGHT);
+}
+
+TEST_F(MapTest, Serialization_RejectsUnknownTileBytes)
+{
+    json j;
+    map->save(j);
+    const size_t count = static_cast<size_t>(TEST_MAP_WIDTH * TEST_MAP_HEIGHT);
+
+    std::vector<uint8_t> types(count, static_cast<uint8_t>(TileType::FLOOR));
+    types[count / 2] = static_cast<uint8_t>(LAST_TILE_TYPE) + 1;
+    json badTypes = j;
+    badTypes["planes"]["types"] = Base64::encode(RunLength::encode_bytes(types));
+    auto loadedMap = std::make_unique<Map>(TEST_MAP_HEIGHT, TEST_MAP_WIDTH);
+    EXPECT_THROW(loadedMap->load(badTypes), std::runtime_error);
+
+    std::vector<uint8_t> doors(count, static_cast<uint8_t>(DoorState::OPEN));
+    doors[0] = 0xFF;
+    json badDoors = j;
+    badDoors["planes"]["doors"] = Base64::encode(RunLength::encode_bytes(doors));
+    EXPECT_THROW(loadedMap->load(badDoors), std::runtime_error);
+
+    EXPECT_NO_THROW(loadedMap->load(j));
+}
+
 // ----------------------------------------------------------------------------
 // Edge Cases
 // ----------------------------------------------------------------------------
@@ -389,6 +507,27 @@ TEST_F(MapTest, HasLOS_AdjacentFloor_ReturnsTrue)
     // (depends on tcodMap state which is set during dig operations)
 }
 
+TEST_F(MapTest, HasLOS_WallBetween_ReturnsFalse)
+{
+    create_simple_room(2, 5, 10, 5);
+    map->set_tile(Vector2D{6, 5}, TileType::WALL, 0.0);
+
+    EXPECT_FALSE(map->has_los(Vector2D{2, 5}, Vector2D{10, 5}));
+    EXPECT_TRUE(map->has_los(Vector2D{2, 5}, Vector2D{5, 5}));
+}
+
+TEST_F(MapTest, HasLOS_CachedResultInvalidatedBySetTile)
+{
+    create_simple_room(2, 5, 10, 5);
+    ASSERT_TRUE(map->has_los(Vector2D{2, 5}, Vector2D{10, 5}));
+
+    map->set_tile(Vector2D{6, 5}, TileType::CLOSED_DOOR, 2.0);
+    EXPECT_FALSE(map->has_los(Vector2D{2, 5}, Vector2D{10, 5}));
+
+    map->set_tile(Vector2D{6, 5}, TileType::OPEN_DOOR, 1.0);
+    EXPECT_TRUE(map->has_los(Vector2D{2, 5}, Vector2D{10, 5}));
+}
+
 // ----------------------------------------------------------------------------
 // Neighbor Finding Tests
 // ----------------------------------------------------------------------------
@@ -431,6 +570,64 @@ TEST_F(MapTest, Reveal_MarksAllExplored)
     EXPECT_TRUE(map->is_explored(Vector2D{TEST_MAP_WIDTH - 2, TEST_MAP_HEIGHT - 2}));
 }
 
+TEST_F(MapTest, ViewVersion_ChangesOnlyWhenViewChanges)
+{
+    create_simple_room(1, 1, 10, 10);
+
+    const uint64_t initial = map->get_view_version();
+    map->compute_fov(ctx);
+    const uint64_t afterFov = map->get_view_version();
+    EXPECT_NE(afterFov, initial);
+
+    // The first update explores the lit tiles; a repeat has nothing to add.
+    map->update();
+    const uint64_t afterExplore = map->get_view_version();
+    EXPECT_NE(afterExplore, afterFov);
+    map->update();
+    EXPECT_EQ(map->get_view_version(), afterExplore);
+
+    map->reveal();
+    EXPECT_NE(map->get_view_version(), afterExplore);
+
+    // Versions are never reused by another map.
+    Map other{TEST_MAP_WIDTH, TEST_MAP_HEIGHT};
+    other.init_tiles();
+    EXPECT_NE(other.get_view_version(), map->get_view_version());
+}
+
+TEST_F(MapTest, TerrainVersion_ChangesOnlyNearEdits)
+{
+    create_simple_room(1, 1, 10, 10);
+    ASSERT_GE(map->get_terrain_chunks_x(), 2);
+
+    const uint64_t nearChunk = map->get_terrain_version(0, 0);
+    const uint64_t farChunk = map->get_terrain_version(1, 0);
+
+    map->set_tile(Vector2D{5, 5}, TileType::WATER, 1);
+    EXPECT_NE(map->get_terrain_version(0, 0), nearChunk);
+    EXPECT_EQ(map->get_terrain_version(1, 0), farChunk);
+
+    // Masks read two tiles out, so an edit near the seam dirties both chunks.
+    const uint64_t beforeSeam = map->get_terrain_version(0, 0);
+    map->set_tile(Vector2D{TERRAIN_CHUNK_SIZE - 2, 5}, TileType::FLOOR, 1);
+    EXPECT_NE(map->get_terrain_version(0, 0), beforeSeam);
+    EXPECT_NE(map->get_terrain_version(1, 0), farChunk);
+
+    // FOV only dirties the chunks whose lit tiles changed.
+    const uint64_t beforeFov = map->get_terrain_version(1, 0);
+    map->compute_fov(ctx);
+    EXPECT_EQ(map->get_terrain_version(1, 0), beforeFov);
+
+    // Exploring the lit tiles dirties their chunk again (the minimap shows
+    // explored tiles); a repeat has nothing new to explore.
+    const uint64_t beforeExplore = map->get_terrain_version(0, 0);
+    map->update();
+    const uint64_t afterExplore = map->get_terrain_version(0, 0);
+    EXPECT_NE(afterExplore, beforeExplore);
+    map->update();
+    EXPECT_EQ(map->get_terrain_version(0, 0), afterExplore);
+}
+
 // ----------------------------------------------------------------------------
 // Get Actor Tests
 // ----------------------------------------------------------------------------
@@ -479,3 +676,57 @@ TEST_F(MapTest, Cost_WaterTile_IsHigher)
     EXPECT_GT(waterCost, floorCost);
 }
 
+
+// ----------------------------------------------------------------------------
+// Decoration Index Tests
+// ----------------------------------------------------------------------------
+
+TEST_F(MapTest, FindDecoration_AddedDecorationIsFound)
+{
+    std::vector<std::unique_ptr<Decoration>> decorations;
+    ctx.decorations = &decorations;
+
+    map->stamp_decoration(Vector2D{3, 4}, TileRef{}, ctx);
+
+    ASSERT_EQ(decorations.size(), 1u);
+    EXPECT_EQ(map->find_decoration_at(Vector2D{3, 4}, ctx), decorations[0].get());
+    EXPECT_EQ(map->find_decoration_at(Vector2D{4, 3}, ctx), nullptr);
+}
+
+TEST_F(MapTest, FindDecoration_BrokenDecorationIsGone)
+{
+    std::vector<std::unique_ptr<Decoration>> decorations;
+    ctx.decorations = &decorations;
+
+    map->stamp_decoration(Vector2D{3, 4}, TileRef{}, ctx);
+    map->break_decoration(*decorations[0], ctx);
+
+    EXPECT_TRUE(decorations[0]->isBroken);
+    EXPECT_EQ(map->find_decoration_at(Vector2D{3, 4}, ctx), nullptr);
+}
+
+TEST_F(MapTest, PruneDecorations_KeepsSurvivorsIndexed)
+{
+    std::vector<std::unique_ptr<Decoration>> decorations;
+    ctx.decorations = &decorations;
+
+    map->stamp_decoration(Vector2D{1, 1}, TileRef{}, ctx);
+    map->stamp_decoration(Vector2D{2, 2}, TileRef{}, ctx);
+    map->break_decoration(*decorations[0], ctx);
+    map->prune_decorations(ctx);
+
+    ASSERT_EQ(decorations.size(), 1u);
+    EXPECT_EQ(map->find_decoration_at(Vector2D{1, 1}, ctx), nullptr);
+    EXPECT_EQ(map->find_decoration_at(Vector2D{2, 2}, ctx), decorations[0].get());
+}
+
+TEST_F(MapTest, StampDecoration_SameTileReusesDecoration)
+{
+    std::vector<std::unique_ptr<Decoration>> decorations;
+    ctx.decorations = &decorations;
+
+    map->stamp_decoration(Vector2D{5, 5}, TileRef{}, ctx);
+    map->stamp_decoration(Vector2D{5, 5}, TileRef{}, ctx);
+
+    EXPECT_EQ(decorations.size(), 1u);
+}
@@ -0,0 +1,84 @@
+// file: TileGridTest.cpp
+// Verifies the struct-of-arrays tile store and its packed bit planes.
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../../src/Map/BitPlane.h"
+#include "../../src/Map/TileGrid.h"
+#include "../../src/Utils/Vector2D.h"
+
+TEST(BitPlaneTest, SetAllLeavesTailBitsClear)
+{
+	BitPlane plane(70);
+	plane.set_all();
+
+	EXPECT_EQ(plane.count(), 70u);
+	EXPECT_EQ(plane.words().back() >> 6, 0u);
+}
+
+TEST(BitPlaneTest, MergeIsBitwiseOr)
+{
+	BitPlane explored(130);
+	BitPlane visible(130);
+	explored.set(3);
+	visible.set(3);
+	visible.set(129);
+
+	explored.merge(visible);
+
+	EXPECT_TRUE(explored.test(3));
+	EXPECT_TRUE(explored.test(129));
+	EXPECT_EQ(explored.count(), 2u);
+}
+
+TEST(BitPlaneTest, ForEachSetInUnion_VisitsEachIndexOnceInOrder)
+{
+	BitPlane a(200);
+	BitPlane b(200);
+	a.set(5);
+	a.set(64);
+	b.set(64);
+	b.set(199);
+
+	std::vector<size_t> visited;
+	a.for_each_set_in_union(b, [&](size_t index) { visited.push_back(index); });
+
+	EXPECT_EQ(visited, (std::vector<size_t>{ 5, 64, 199 }));
+}
+
+TEST(TileGridTest, Resize_DefaultsToUnexploredWall)
+{
+	TileGrid grid;
+	grid.resize(12, 7);
+
+	ASSERT_EQ(grid.size(), 84u);
+	EXPECT_EQ(grid.type(0), TileType::WALL);
+	EXPECT_EQ(grid.door_state(0), DoorState::OPEN);
+	EXPECT_DOUBLE_EQ(grid.cost(0), 0.0);
+	EXPECT_EQ(grid.explored().count(), 0u);
+}
+
+TEST(TileGridTest, IndexAndPositionRoundTrip)
+{
+	TileGrid grid;
+	grid.resize(12, 7);
+
+	const Vector2D pos{ 11, 6 };
+	const size_t index = grid.index_of(pos);
+
+	EXPECT_EQ(index, 83u);
+	EXPECT_EQ(grid.position_of(index), pos);
+}
+
+TEST(TileGridTest, CostPlaneHoldsMovementCosts)
+{
+	TileGrid grid;
+	grid.resize(4, 4);
+
+	grid.set_cost(1, 10.0);
+	grid.set_cost(2, 2.0);
+
+	EXPECT_DOUBLE_EQ(grid.cost(1), 10.0);
+	EXPECT_DOUBLE_EQ(grid.cost(2), 2.0);
+}
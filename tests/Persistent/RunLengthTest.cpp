@@ -0,0 +1,81 @@
+// file: RunLengthTest.cpp
+// Verifies the map plane encodings: byte and bit run-length round trips,
+// runs that do not cover the plane rejected, and base64 round trips.
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../../src/Map/BitPlane.h"
+#include "../../src/Persistent/Base64.h"
+#include "../../src/Persistent/RunLength.h"
+
+TEST(RunLengthTest, BytePlaneRoundTrip)
+{
+    std::vector<uint8_t> plane(1000, 1);
+    for (size_t i = 200; i < 700; ++i)
+    {
+        plane[i] = 0;
+    }
+    plane[450] = 2;
+
+    const std::vector<uint8_t> runs = RunLength::encode_bytes(plane);
+    EXPECT_LT(runs.size(), 16u);
+
+    std::vector<uint8_t> decoded(plane.size());
+    ASSERT_TRUE(RunLength::decode_bytes(runs, decoded));
+    EXPECT_EQ(decoded, plane);
+
+    // Runs must cover the plane exactly.
+    std::vector<uint8_t> tooLarge(plane.size() + 1);
+    EXPECT_FALSE(RunLength::decode_bytes(runs, tooLarge));
+    std::vector<uint8_t> tooSmall(plane.size() - 1);
+    EXPECT_FALSE(RunLength::decode_bytes(runs, tooSmall));
+}
+
+TEST(RunLengthTest, BitPlaneRoundTrip)
+{
+    BitPlane plane(300);
+    for (size_t i = 0; i < 300; ++i)
+    {
+        if ((i >= 64 && i < 130) || i == 299 || i % 50 == 7)
+        {
+            plane.set(i);
+        }
+    }
+
+    const std::vector<uint8_t> runs = RunLength::encode_bits(plane);
+    BitPlane decoded(300);
+    decoded.set_all();
+    ASSERT_TRUE(RunLength::decode_bits(runs, decoded));
+    for (size_t i = 0; i < 300; ++i)
+    {
+        EXPECT_EQ(decoded.test(i), plane.test(i)) << "bit " << i;
+    }
+
+    BitPlane wrongSize(301);
+    EXPECT_FALSE(RunLength::decode_bits(runs, wrongSize));
+}
+
+TEST(RunLengthTest, Base64RoundTrip)
+{
+    for (size_t length = 0; length < 8; ++length)
+    {
+        std::vector<uint8_t> bytes;
+        for (size_t i = 0; i < length; ++i)
+        {
+            bytes.push_back(static_cast<uint8_t>(i * 97 + 3));
+        }
+        const std::string text = Base64::encode(bytes);
+        EXPECT_EQ(text.size() % 4, 0u);
+        const std::optional<std::vector<uint8_t>> decoded = Base64::decode(text);
+        ASSERT_TRUE(decoded.has_value());
+        EXPECT_EQ(*decoded, bytes);
+    }
+
+    EXPECT_EQ(Base64::encode(std::vector<uint8_t>{ 'M', 'a', 'n' }), "TWFu");
+    EXPECT_FALSE(Base64::decode("TWF").has_value());
+    EXPECT_FALSE(Base64::decode("TW!u").has_value());
+}
@@ -0,0 +1,169 @@
+// file: SaveFileTest.cpp
+// Verifies the binary save container: LZ round trips, section lookup and
+// codecs, unknown sections skipped, and malformed files rejected.
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "../../src/Persistent/BinaryStream.h"
+#include "../../src/Persistent/LzCodec.h"
+#include "../../src/Persistent/SaveFile.h"
+
+namespace
+{
+    std::vector<uint8_t> to_bytes(const std::string& text)
+    {
+        return std::vector<uint8_t>(text.begin(), text.end());
+    }
+
+    // A map-like plane: wall rows with floor runs and a few odd bytes.
+    std::vector<uint8_t> make_plane(size_t size)
+    {
+        std::vector<uint8_t> plane(size, 1);
+        for (size_t i = 0; i < size; ++i)
+        {
+            if ((i / 40) % 3 == 1 && i % 40 > 4 && i % 40 < 30)
+            {
+                plane[i] = 0;
+            }
+            if (i % 97 == 0)
+            {
+                plane[i] = static_cast<uint8_t>(i % 6);
+            }
+        }
+        return plane;
+    }
+}
+
+TEST(SaveFileTest, LzRoundTripsAndShrinksPlanes)
+{
+    const std::vector<uint8_t> plane = make_plane(9600);
+    const std::vector<uint8_t> packed = LzCodec::compress(plane);
+    EXPECT_LT(packed.size(), plane.size() / 4);
+
+    std::vector<uint8_t> decoded(plane.size());
+    ASSERT_TRUE(LzCodec::decompress(packed, decoded));
+    EXPECT_EQ(decoded, plane);
+}
+
+TEST(SaveFileTest, LzHandlesEmptyAndIncompressibleInput)
+{
+    const std::vector<uint8_t> empty;
+    std::vector<uint8_t> none;
+    EXPECT_TRUE(LzCodec::decompress(LzCodec::compress(empty), none));
+
+    std::vector<uint8_t> noise(300);
+    uint32_t state = 12345;
+    for (uint8_t& byte : noise)
+    {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+    std::vector<uint8_t> decoded(noise.size());
+    ASSERT_TRUE(LzCodec::decompress(LzCodec::compress(noise), decoded));
+    EXPECT_EQ(decoded, noise);
+
+    // Wrong decoded size is reported, not overrun.
+    std::vector<uint8_t> tooSmall(noise.size() - 1);
+    EXPECT_FALSE(LzCodec::decompress(LzCodec::compress(noise), tooSmall));
+}
+
+TEST(SaveFileTest, SectionsRoundTrip)
+{
+    std::ostringstream stream;
+    SaveWriter writer(stream);
+
+    const std::vector<uint8_t> plane = make_plane(4096);
+    writer.write_section(SaveSection::MAP, plane, true);
+
+    BinaryWriter time;
+    time.write_i32(1234);
+    writer.write_section(SaveSection::TIME, time.data());
+
+    const nlohmann::json player = { { "name", "Tester" }, { "hp", 17 }, { "items", { 1, 2, 3 } } };
+    writer.write_json_section(SaveSection::PLAYER, player);
+    writer.finish();
+    EXPECT_EQ(writer.bytes_written(), stream.str().size());
+
+    const SaveReader reader(to_bytes(stream.str()));
+    EXPECT_EQ(reader.get_version(), SaveWriter::VERSION);
+    EXPECT_EQ(reader.payload(SaveSection::MAP), plane);
+    EXPECT_EQ(reader.json_section(SaveSection::PLAYER), player);
+
+    const std::vector<uint8_t> timeBytes = reader.payload(SaveSection::TIME);
+    BinaryReader in(timeBytes);
+    EXPECT_EQ(in.read_i32(), 1234);
+
+    EXPECT_FALSE(reader.has(SaveSection::GUI));
+    EXPECT_TRUE(reader.payload(SaveSection::GUI).empty());
+    EXPECT_TRUE(reader.json_section(SaveSection::GUI).is_null());
+}
+
+TEST(SaveFileTest, UnknownSectionsAreSkipped)
+{
+    std::ostringstream stream;
+    SaveWriter writer(stream);
+    const std::vector<uint8_t> future{ 9, 9, 9 };
+    writer.write_section(static_cast<SaveSection>(999), future);
+    BinaryWriter time;
+    time.write_i32(7);
+    writer.write_section(SaveSection::TIME, time.data());
+    writer.finish();
+
+    const SaveReader reader(to_bytes(stream.str()));
+    EXPECT_TRUE(reader.has(SaveSection::TIME));
+}
+
+TEST(SaveFileTest, MalformedFilesThrow)
+{
+    EXPECT_FALSE(SaveReader::is_binary(to_bytes("{\"map_width\": 1}")));
+    EXPECT_THROW(SaveReader(to_bytes("{}")), std::runtime_error);
+
+    std::ostringstream stream;
+    SaveWriter writer(stream);
+    writer.write_section(SaveSection::MAP, make_plane(512), true);
+    writer.finish();
+    std::string file = stream.str();
+
+    // Cut inside the MAP payload.
+    EXPECT_THROW(SaveReader(to_bytes(file.substr(0, file.size() - 10))), std::runtime_error);
+
+    // A newer version than this build understands.
+    std::string newer = file;
+    newer[4] = static_cast<char>(SaveWriter::VERSION + 1);
+    EXPECT_THROW(SaveReader(to_bytes(newer)), std::runtime_error);
+}
+
+TEST(SaveFileTest, CorruptSectionSizesThrow)
+{
+    std::ostringstream stream;
+    SaveWriter writer(stream);
+    writer.write_section(SaveSection::MAP, make_plane(512), true);
+    writer.finish();
+    const std::string file = stream.str();
+    // magic, version, then the MAP header: id, codec, stored size, raw size.
+    constexpr size_t RAW_SIZE_AT = 4 + 4 + 4 + 1 + 4;
+    ASSERT_EQ(static_cast<SaveCodec>(file[12]), SaveCodec::LZ);
+
+    // A raw size no LZ block of this length can decode to: rejected before
+    // anything is allocated for it.
+    std::string huge = file;
+    huge.replace(RAW_SIZE_AT, 4, "\xF0\xFF\xFF\xFF");
+    EXPECT_THROW(SaveReader(to_bytes(huge)), std::runtime_error);
+
+    // A raw section whose sizes disagree.
+    std::ostringstream rawStream;
+    SaveWriter rawWriter(rawStream);
+    rawWriter.write_section(SaveSection::MAP, make_plane(16));
+    rawWriter.finish();
+    std::string raw = rawStream.str();
+    raw[RAW_SIZE_AT] = static_cast<char>(raw[RAW_SIZE_AT] + 1);
+    EXPECT_THROW(SaveReader(to_bytes(raw)), std::runtime_error);
+}
@@ -0,0 +1,156 @@
+// file: RandomDiceTest.cpp
+// Verifies the seeded dice: same seed, same rolls; named streams do not
+// disturb each other; bounded rolls stay in range; dice expressions parse;
+// a saved generator resumes where it stopped.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include "src/Persistent/BinaryStream.h"
+#include "src/Random/RandomDice.h"
+
+TEST(RandomDiceTest, SameSeedRollsTheSame)
+{
+	RandomDice a{ 42 };
+	RandomDice b{ 42 };
+	RandomDice c{ 43 };
+
+	int differences = 0;
+	for (int i = 0; i < 100; ++i)
+	{
+		const int roll = a.d100();
+		EXPECT_EQ(roll, b.d100());
+		differences += roll != c.d100() ? 1 : 0;
+	}
+	EXPECT_GT(differences, 50);
+	EXPECT_EQ(a.get_seed(), 42u);
+}
+
+TEST(RandomDiceTest, StreamsAreIndependent)
+{
+	RandomDice quiet{ 7 };
+	RandomDice busy{ 7 };
+
+	// Extra combat rolls must not shift what AI or mapgen roll next.
+	for (int i = 0; i < 37; ++i)
+	{
+		busy.stream(RngStream::COMBAT).d20();
+	}
+	for (int i = 0; i < 50; ++i)
+	{
+		EXPECT_EQ(quiet.stream(RngStream::AI).d20(), busy.stream(RngStream::AI).d20());
+		EXPECT_EQ(quiet.roll(RngStream::MAPGEN, 0, 1000), busy.roll(RngStream::MAPGEN, 0, 1000));
+	}
+}
+
+TEST(RandomDiceTest, RollsStayInRangeAndCoverIt)
+{
+	RandomDice dice{ 1 };
+	std::array<int, 6> seen{};
+	for (int i = 0; i < 6000; ++i)
+	{
+		const int value = dice.d6();
+		ASSERT_GE(value, 1);
+		ASSERT_LE(value, 6);
+		++seen[value - 1];
+	}
+	for (int count : seen)
+	{
+		EXPECT_GT(count, 800);
+	}
+
+	EXPECT_EQ(dice.roll(5, 5), 5);
+	EXPECT_EQ(dice.roll(5, 2), 5);
+	const int wide = dice.roll(-100, 100);
+	EXPECT_GE(wide, -100);
+	EXPECT_LE(wide, 100);
+}
+
+TEST(RandomDiceTest, RollManyFillsTheSpan)
+{
+	RandomDice dice{ 3 };
+	std::vector<int> values(500, -1);
+	dice.roll_many(values, 10, 12);
+	EXPECT_TRUE(std::ranges::all_of(values, [](int v) { return v >= 10 && v <= 12; }));
+
+	dice.roll_many(RngStream::LOOT, values, DiceExpr{ 3, 6, 2 });
+	EXPECT_TRUE(std::ranges::all_of(values, [](int v) { return v >= 5 && v <= 20; }));
+	const double mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+	EXPECT_NEAR(mean, 12.5, 0.6);
+}
+
+TEST(RandomDiceTest, ParsesDiceExpressions)
+{
+	const auto full = DiceExpr::parse("3d6+2");
+	ASSERT_TRUE(full);
+	EXPECT_EQ(full->num, 3);
+	EXPECT_EQ(full->sides, 6);
+	EXPECT_EQ(full->bonus, 2);
+
+	const auto bare = DiceExpr::parse("d20");
+	ASSERT_TRUE(bare);
+	EXPECT_EQ(bare->num, 1);
+	EXPECT_EQ(bare->sides, 20);
+
+	const auto minus = DiceExpr::parse("2d4-1");
+	ASSERT_TRUE(minus);
+	EXPECT_EQ(minus->bonus, -1);
+	EXPECT_EQ(minus->to_string(), "2d4-1");
+
+	EXPECT_FALSE(DiceExpr::parse(""));
+	EXPECT_FALSE(DiceExpr::parse("3d"));
+	EXPECT_FALSE(DiceExpr::parse("3d0"));
+	EXPECT_FALSE(DiceExpr::parse("3x6"));
+	EXPECT_FALSE(DiceExpr::parse("1d6+"));
+	EXPECT_FALSE(DiceExpr::parse("1d6+2x"));
+
+	RandomDice dice{ 9 };
+	EXPECT_EQ(dice.roll(DiceExpr{ 0, 6, 4 }), 0);
+}
+
+TEST(RandomDiceTest, SaveAndLoadResumeEveryStream)
+{
+	RandomDice original{ 123 };
+	original.d20();
+	original.stream(RngStream::COMBAT).d100();
+
+	BinaryWriter out;
+	original.save(out);
+	RandomDice restored{ 999 };
+	BinaryReader in(out.data());
+	restored.load(in);
+
+	EXPECT_EQ(restored.get_seed(), 123u);
+	for (int i = 0; i < 20; ++i)
+	{
+		EXPECT_EQ(original.d20(), restored.d20());
+		EXPECT_EQ(original.stream(RngStream::COMBAT).d100(), restored.stream(RngStream::COMBAT).d100());
+		EXPECT_EQ(original.stream(RngStream::LOOT).d6(), restored.stream(RngStream::LOOT).d6());
+	}
+}
+
+TEST(RandomDiceTest, FixedRollsOverrideEveryStream)
+{
+	RandomDice dice{ 5 };
+	dice.set_next_roll(17);
+	dice.set_next_roll(2);
+	EXPECT_EQ(dice.stream(RngStream::COMBAT).d20(), 17);
+	EXPECT_EQ(dice.stream(RngStream::AI).d6(), 2);
+	dice.clear_fixed_rolls();
+}
+
+TEST(RandomDiceTest, GeneratorWorksWithStandardAlgorithms)
+{
+	RandomDice a{ 11 };
+	RandomDice b{ 11 };
+	std::vector<int> first(20);
+	std::iota(first.begin(), first.end(), 0);
+	std::vector<int> second = first;
+
+	std::ranges::shuffle(first, a.get_rng(RngStream::MAPGEN));
+	std::ranges::shuffle(second, b.stream(RngStream::MAPGEN).get_rng());
+	EXPECT_EQ(first, second);
+}
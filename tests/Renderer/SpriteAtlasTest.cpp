@@ -0,0 +1,76 @@
+// file: SpriteAtlasTest.cpp
+// Verifies the sprite atlas shelf packer: rects never overlap, stay on
+// their page with the gutter between them, spill to a new page when one is
+// full, and oversize or empty inputs get an invalid rect.
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../../src/Renderer/SpriteAtlas.h"
+#include "../../src/Utils/Vector2D.h"
+
+namespace
+{
+	// True if a and b, each grown by gutter on the right and bottom, overlap.
+	bool overlaps(const AtlasRect& a, const AtlasRect& b, int gutter)
+	{
+		return a.page == b.page &&
+			a.x < b.x + b.width + gutter && b.x < a.x + a.width + gutter &&
+			a.y < b.y + b.height + gutter && b.y < a.y + a.height + gutter;
+	}
+}
+
+TEST(SpriteAtlasTest, PackedRectsStayOnPageWithoutOverlap)
+{
+	// Roughly the DawnLike sheet sizes: a mix of tall and wide images
+	const std::vector<Vector2D> sizes{
+		{ 320, 816 }, { 336, 624 }, { 128, 112 }, { 128, 112 }, { 256, 288 },
+		{ 128, 64 }, { 128, 64 }, { 16, 16 }, { 512, 80 }, { 336, 624 },
+	};
+	const auto rects = SpriteAtlas::pack(sizes, 1024, 2);
+	ASSERT_EQ(rects.size(), sizes.size());
+
+	for (size_t i = 0; i < rects.size(); ++i)
+	{
+		ASSERT_TRUE(rects[i].is_valid());
+		EXPECT_EQ(rects[i].width, sizes[i].x);
+		EXPECT_EQ(rects[i].height, sizes[i].y);
+		EXPECT_GE(rects[i].x, 0);
+		EXPECT_GE(rects[i].y, 0);
+		EXPECT_LE(rects[i].x + rects[i].width, 1024);
+		EXPECT_LE(rects[i].y + rects[i].height, 1024);
+		for (size_t j = i + 1; j < rects.size(); ++j)
+		{
+			EXPECT_FALSE(overlaps(rects[i], rects[j], 2)) << i << " and " << j;
+		}
+	}
+}
+
+TEST(SpriteAtlasTest, FullPageSpillsToNextPage)
+{
+	const std::vector<Vector2D> sizes{ { 60, 60 }, { 60, 60 }, { 60, 60 }, { 60, 60 }, { 60, 60 } };
+	const auto rects = SpriteAtlas::pack(sizes, 128, 4);
+
+	// Two fit on a shelf, two shelves fit on a page; the fifth needs page 1.
+	int onSecondPage = 0;
+	for (const AtlasRect& r : rects)
+	{
+		ASSERT_TRUE(r.is_valid());
+		onSecondPage += (r.page == 1) ? 1 : 0;
+	}
+	EXPECT_EQ(onSecondPage, 1);
+	EXPECT_EQ(rects[0].page, 0);
+	EXPECT_EQ(rects[1].x, 64);
+}
+
+TEST(SpriteAtlasTest, OversizeAndEmptyInputsAreInvalid)
+{
+	const std::vector<Vector2D> sizes{ { 32, 32 }, { 300, 10 }, { 0, 0 }, { 32, 32 } };
+	const auto rects = SpriteAtlas::pack(sizes, 256, 2);
+
+	EXPECT_TRUE(rects[0].is_valid());
+	EXPECT_FALSE(rects[1].is_valid());
+	EXPECT_FALSE(rects[2].is_valid());
+	EXPECT_TRUE(rects[3].is_valid());
+	EXPECT_FALSE(overlaps(rects[0], rects[3], 2));
+}
@@ -0,0 +1,120 @@
+// file: CreatureOccupancyTest.cpp
+// Verifies that CreatureManager's tile-indexed creature lookup stays in sync
+// with the creature list across spawn, move, death and cleanup.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+#include "../../src/Actor/Creature.h"
+#include "../../src/Combat/HealthPool.h"
+#include "../../src/Systems/CreatureManager.h"
+#include "../../src/Utils/Vector2D.h"
+
+namespace
+{
+	constexpr int GRID_WIDTH = 20;
+	constexpr int GRID_HEIGHT = 15;
+}
+
+class CreatureOccupancyTest : public ::testing::Test
+{
+protected:
+	CreatureManager manager;
+	std::vector<std::unique_ptr<Creature>> creatures;
+
+	void SetUp() override
+	{
+		manager.bind_occupancy(GRID_WIDTH, GRID_HEIGHT);
+	}
+
+	Creature& spawn(Vector2D pos)
+	{
+		auto creature = std::make_unique<Creature>(pos, ActorData{ TileRef{}, "goblin", 1 });
+		creature->healthPool = std::make_unique<HealthPool>(5);
+		creatures.push_back(std::move(creature));
+		return *creatures.back();
+	}
+};
+
+TEST_F(CreatureOccupancyTest, Spawn_IsIndexedWithoutNotification)
+{
+	Creature& goblin = spawn(Vector2D{ 3, 4 });
+
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 3, 4 }), &goblin);
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 4, 3 }), nullptr);
+	EXPECT_TRUE(manager.verify_occupancy(creatures));
+}
+
+TEST_F(CreatureOccupancyTest, Move_UpdatesBothTiles)
+{
+	Creature& goblin = spawn(Vector2D{ 3, 4 });
+	ASSERT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 3, 4 }), &goblin);
+
+	manager.move_creature(goblin, Vector2D{ 4, 4 });
+
+	EXPECT_EQ(goblin.position, (Vector2D{ 4, 4 }));
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 3, 4 }), nullptr);
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 4, 4 }), &goblin);
+	EXPECT_TRUE(manager.verify_occupancy(creatures));
+}
+
+TEST_F(CreatureOccupancyTest, DeadCreature_DoesNotBlock)
+{
+	Creature& goblin = spawn(Vector2D{ 6, 6 });
+	ASSERT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 6, 6 }), &goblin);
+
+	goblin.healthPool->set_hp(0);
+
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 6, 6 }), nullptr);
+}
+
+TEST_F(CreatureOccupancyTest, Cleanup_ReindexesSurvivors)
+{
+	Creature& first = spawn(Vector2D{ 1, 1 });
+	spawn(Vector2D{ 2, 2 });
+	Creature& third = spawn(Vector2D{ 3, 3 });
+	ASSERT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 3, 3 }), &third);
+
+	first.healthPool->set_hp(0);
+	manager.cleanup_dead_creatures(creatures);
+
+	ASSERT_EQ(creatures.size(), 2u);
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 1, 1 }), nullptr);
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 2, 2 }), creatures[0].get());
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 3, 3 }), creatures[1].get());
+	EXPECT_TRUE(manager.verify_occupancy(creatures));
+}
+
+TEST_F(CreatureOccupancyTest, LivingCreature_ReclaimsTileOfTheDead)
+{
+	Creature& corpse = spawn(Vector2D{ 5, 5 });
+	Creature& goblin = spawn(Vector2D{ 5, 6 });
+	ASSERT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 5, 5 }), &corpse);
+
+	corpse.healthPool->set_hp(0);
+	manager.move_creature(goblin, Vector2D{ 5, 5 });
+	manager.cleanup_dead_creatures(creatures);
+
+	EXPECT_EQ(manager.get_actor_at_position(creatures, Vector2D{ 5, 5 }), &goblin);
+	EXPECT_TRUE(manager.verify_occupancy(creatures));
+}
+
+TEST_F(CreatureOccupancyTest, UnnotifiedMove_IsCaughtByVerifier)
+{
+	Creature& goblin = spawn(Vector2D{ 8, 8 });
+	ASSERT_TRUE(manager.verify_occupancy(creatures));
+
+	goblin.position = Vector2D{ 9, 8 };
+
+	EXPECT_FALSE(manager.verify_occupancy(creatures));
+}
+
+TEST_F(CreatureOccupancyTest, Unbound_FallsBackToScan)
+{
+	CreatureManager unbound;
+	Creature& goblin = spawn(Vector2D{ 2, 3 });
+
+	EXPECT_EQ(unbound.get_actor_at_position(creatures, Vector2D{ 2, 3 }), &goblin);
+	EXPECT_EQ(unbound.get_actor_at_position(creatures, Vector2D{ 3, 2 }), nullptr);
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "src/Systems/ItemEnhancements/ItemEnhancements.h"
+#include "src/Random/RandomDice.h"
 #include "src/Actor/Actor.h"
 #include "src/Factories/ItemCreator.h"
 #include "src/Combat/WeaponDamageRegistry.h"
@@ -12,6 +13,7 @@
 class EnhancementSystemTest : public ::testing::Test {
 protected:
     ItemEnhancement defaultEnhancement;
+    RandomDice dice{ 42 };
 
     void SetUp() override {
         defaultEnhancement = ItemEnhancement{};
@@ -283,7 +285,7 @@ TEST_F(EnhancementSystemTest, ColdResistance_InValidRange) {
 // ----------------------------------------------------------------------------
 
 TEST_F(EnhancementSystemTest, GenerateRandom_ReturnsValidEnhancement) {
-    auto enhancement = ItemEnhancement::generate_random_enhancement(true);
+    auto enhancement = ItemEnhancement::generate_random_enhancement(true, dice);
 
     // Should have at least one enhancement (prefix or suffix or level)
     bool hasEnhancement = (enhancement.prefix != PrefixType::NONE) ||
@@ -296,7 +298,7 @@ TEST_F(EnhancementSystemTest, GenerateRandom_ReturnsValidEnhancement) {
 }
 
 TEST_F(EnhancementSystemTest, GenerateWeaponEnhancement_ValidForWeapons) {
-    auto enhancement = ItemEnhancement::generate_weapon_enhancement();
+    auto enhancement = ItemEnhancement::generate_weapon_enhancement(dice);
 
     // Weapon enhancements should typically affect damage or to-hit
     // After applying effects
@@ -307,7 +309,7 @@ TEST_F(EnhancementSystemTest, GenerateWeaponEnhancement_ValidForWeapons) {
 }
 
 TEST_F(EnhancementSystemTest, GenerateArmorEnhancement_ValidForArmor) {
-    auto enhancement = ItemEnhancement::generate_armor_enhancement();
+    auto enhancement = ItemEnhancement::generate_armor_enhancement(dice);
 
     enhancement.apply_enhancement_effects();
 
@@ -316,7 +318,7 @@ TEST_F(EnhancementSystemTest, GenerateArmorEnhancement_ValidForArmor) {
 }
 
 TEST_F(EnhancementSystemTest, GenerateByRarity_Level1_BasicEnhancement) {
-    auto enhancement = ItemEnhancement::generate_by_rarity(1);
+    auto enhancement = ItemEnhancement::generate_by_rarity(1, dice);
 
     // Low rarity should have minimal bonuses
     enhancement.apply_enhancement_effects();
@@ -326,7 +328,7 @@ TEST_F(EnhancementSystemTest, GenerateByRarity_Level1_BasicEnhancement) {
 }
 
 TEST_F(EnhancementSystemTest, GenerateByRarity_Level5_PowerfulEnhancement) {
-    auto enhancement = ItemEnhancement::generate_by_rarity(5);
+    auto enhancement = ItemEnhancement::generate_by_rarity(5, dice);
 
     enhancement.apply_enhancement_effects();
 
@@ -0,0 +1,232 @@
+// file: InputRecorderTest.cpp
+// Verifies input recordings: steps, clicks and menu polls survive the file
+// round trip compactly, foreign files are rejected, the recorder reseeds
+// the dice and stamps the final state's checksum, and a session that
+// equips an item through the inventory menu replays to the same state.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "src/Actor/EquipmentSlot.h"
+#include "src/Actor/Item.h"
+#include "src/ActorTypes/Player.h"
+#include "src/Controls/Controls.h"
+#include "src/Core/GameContext.h"
+#include "src/Core/Paths.h"
+#include "src/Factories/ItemCreator.h"
+#include "src/Factories/MonsterCreator.h"
+#include "src/Game.h"
+#include "src/Headless/HeadlessRunner.h"
+#include "src/Random/RandomDice.h"
+#include "src/Renderer/InputSystem.h"
+#include "src/Systems/InputHandler.h"
+#include "src/Systems/InputRecorder.h"
+#include "src/Systems/SpellSystem.h"
+
+class InputRecorderTest : public ::testing::Test
+{
+protected:
+	std::filesystem::path path;
+
+	void SetUp() override
+	{
+		const auto* info = ::testing::UnitTest::GetInstance()->current_test_info();
+		path = std::filesystem::temp_directory_path() / (std::string("input_recorder_test_") + info->name() + ".rec");
+		std::filesystem::remove(path);
+	}
+
+	void TearDown() override
+	{
+		std::filesystem::remove(path);
+	}
+
+	// Content first: a Game takes its item spawn tables from ItemCreator
+	// when it is built.
+	static std::unique_ptr<Game> make_game()
+	{
+		try
+		{
+			MonsterCreator::load(Paths::MONSTERS);
+			SpellSystem::load(Paths::SPELLS);
+			ItemCreator::load(Paths::ITEMS);
+			ItemCreator::load_enhanced_rules(Paths::ENHANCED_RULES);
+		}
+		catch (...) {}
+		auto game = std::make_unique<Game>();
+		try
+		{
+			game->tileConfig.load(Paths::TILE_CONFIG);
+			game->prefabLibrary.load(Paths::PREFABS);
+		}
+		catch (...) {}
+		game->init_world();
+		return game;
+	}
+};
+
+TEST_F(InputRecorderTest, RoundTripsThroughAFile)
+{
+	InputRecording recording;
+	recording.seed = 0x1234'5678'9abc'def0ULL;
+	recording.blueprint.playerClass = "Wizard";
+	recording.blueprint.playerRace = "Elf";
+	recording.checksum = 99;
+	recording.steps = {
+		InputStep{ 0x103 },
+		InputStep{ 0x199, Vector2D{ 41, 17 } },
+		InputStep{ -1 },
+		InputStep{ 'g' },
+		InputStep{ 0x19A, Vector2D{ -1, 300 } },
+		InputStep{ .kind = InputStep::Kind::VIEW, .view = MenuView{ 32, 1920, 1080 } },
+		InputStep{ .kind = InputStep::Kind::MENU },
+		InputStep{ .kind = InputStep::Kind::MENU, .input = InputEvent{ GameKey::ENTER, 0, Vector2D{ 640, 96 }, true } },
+		InputStep{ .kind = InputStep::Kind::MENU, .input = InputEvent{ GameKey::NONE, 'a', Vector2D{ -3, 2000 }, false } },
+		InputStep{ .kind = InputStep::Kind::DISMISS_MENUS },
+	};
+	for (int i = 0; i < 2000; ++i)
+	{
+		recording.steps.push_back(InputStep{ -1 }); // a long mouse walk
+	}
+
+	recording.write_file(path);
+	const InputRecording loaded = InputRecording::read_file(path);
+
+	EXPECT_EQ(loaded.seed, recording.seed);
+	EXPECT_EQ(loaded.blueprint.playerClass, "Wizard");
+	EXPECT_EQ(loaded.blueprint.playerRace, "Elf");
+	EXPECT_EQ(loaded.checksum, 99u);
+	EXPECT_EQ(loaded.steps, recording.steps);
+	EXPECT_LT(std::filesystem::file_size(path), 200u);
+}
+
+TEST_F(InputRecorderTest, RejectsOtherFiles)
+{
+	{
+		std::ofstream file(path, std::ios::binary);
+		file << "not a recording at all";
+	}
+	EXPECT_THROW(static_cast<void>(InputRecording::read_file(path)), std::runtime_error);
+	EXPECT_THROW(static_cast<void>(InputRecording::read_file(path.string() + ".missing")), std::runtime_error);
+}
+
+TEST_F(InputRecorderTest, RecorderReseedsAndStampsTheChecksum)
+{
+	RandomDice dice{ 5 };
+	PlayerBlueprint blueprint{ .playerClass = "Rogue" };
+	GameContext ctx{};
+	ctx.dice = &dice;
+	ctx.playerBlueprint = &blueprint;
+
+	InputRecorder recorder;
+	recorder.begin(ctx);
+	EXPECT_FALSE(recorder.is_recording()); // no output path, no recording
+
+	recorder.set_output(path);
+	recorder.begin(ctx);
+	ASSERT_TRUE(recorder.is_recording());
+	EXPECT_EQ(recorder.current()->seed, dice.get_seed());
+
+	InputHandler input;
+	input.set_key(0x103);
+	recorder.record_step(input);
+	input.reset_key();
+	input.set_key(0x199);
+	input.set_click_tile(Vector2D{ 3, 4 });
+	recorder.record_step(input);
+	input.reset_key();
+	EXPECT_FALSE(input.get_click_tile());
+
+	dice.d20();
+	recorder.finish(ctx);
+	EXPECT_FALSE(recorder.is_recording());
+
+	const InputRecording loaded = InputRecording::read_file(path);
+	ASSERT_EQ(loaded.steps.size(), 2u);
+	EXPECT_EQ(loaded.steps[0], InputStep{ 0x103 });
+	EXPECT_EQ(loaded.steps[1], (InputStep{ 0x199, Vector2D{ 3, 4 } }));
+	EXPECT_EQ(loaded.blueprint.playerClass, "Rogue");
+	EXPECT_EQ(loaded.checksum, state_checksum(ctx));
+
+	const uint64_t before = state_checksum(ctx);
+	dice.d20();
+	EXPECT_NE(state_checksum(ctx), before);
+}
+
+TEST_F(InputRecorderTest, MenuInputReplaysToTheSameState)
+{
+	auto game = make_game();
+	game->inputSystem.set_scripted(true);
+	game->inputRecorder.set_output(path);
+	game->levelGenerator.discard();
+	game->playerBlueprint.playerClass = "Fighter";
+	game->playerBlueprint.playerRace = "Human";
+
+	auto headless_context = [&game]()
+	{
+		GameContext ctx = game->context();
+		ctx.animSystem = nullptr;
+		ctx.floatingText = nullptr;
+		ctx.minimap = nullptr;
+		return ctx;
+	};
+	GameContext ctx = headless_context();
+	game->stateManager.init_new_game(ctx);
+	game->gameState.set_should_save(false);
+	ASSERT_TRUE(game->inputRecorder.is_recording());
+
+	auto update = [&](int key)
+	{
+		GameContext ctx = headless_context();
+		game->inputHandler.reset_key();
+		game->inputHandler.set_key(key);
+		game->gameLoopCoordinator.update(ctx);
+	};
+	auto menu_frame = [&](const InputEvent& event)
+	{
+		GameContext ctx = headless_context();
+		game->inputSystem.push_event(event);
+		game->menuManager.handle_menus(game->menus, ctx);
+	};
+
+	update(static_cast<int>(Controls::INVENTORY));
+	ASSERT_EQ(game->menus.size(), 1u);
+	menu_frame(InputEvent{});
+	for (int i = 0; i < 5; ++i)
+	{
+		menu_frame(InputEvent{ .key = GameKey::DOWN }); // Head .. Right Hand
+	}
+	menu_frame(InputEvent{ .key = GameKey::ENTER }); // unequip the long sword
+	ASSERT_EQ(game->player->get_equipped_item(EquipmentSlot::RIGHT_HAND), nullptr);
+	menu_frame(InputEvent{ .key = GameKey::ENTER }); // empty slot: list what fits
+	menu_frame(InputEvent{ .charInput = 'a' }); // equip the first of them
+	const Item* wielded = game->player->get_equipped_item(EquipmentSlot::RIGHT_HAND);
+	ASSERT_NE(wielded, nullptr);
+	EXPECT_EQ(wielded->itemKey, "long_sword");
+	menu_frame(InputEvent{ .key = GameKey::DOWN });
+	menu_frame(InputEvent{ .key = GameKey::ENTER }); // and take the shield off
+	EXPECT_EQ(game->player->get_equipped_item(EquipmentSlot::LEFT_HAND), nullptr);
+	menu_frame(InputEvent{ .key = GameKey::ESCAPE });
+	EXPECT_TRUE(game->menus.empty());
+	update(static_cast<int>(Controls::WAIT));
+	ASSERT_TRUE(game->inputRecorder.finish(game->context()));
+
+	const InputRecording recording = InputRecording::read_file(path);
+	const auto is_menu = [](const InputStep& step) { return step.kind == InputStep::Kind::MENU; };
+	EXPECT_EQ(std::ranges::count_if(recording.steps, is_menu), 12);
+
+	auto replayGame = make_game();
+	HeadlessRunner replayer{ *replayGame };
+	const ReplayReport replayed = replayer.replay(recording);
+
+	EXPECT_TRUE(replayed.matches()) << format_replay(replayed);
+	EXPECT_TRUE(replayGame->menus.empty());
+	const Item* replayWielded = replayGame->player->get_equipped_item(EquipmentSlot::RIGHT_HAND);
+	ASSERT_NE(replayWielded, nullptr);
+	EXPECT_EQ(replayWielded->itemKey, "long_sword");
+	EXPECT_EQ(replayGame->player->get_equipped_item(EquipmentSlot::LEFT_HAND), nullptr);
+}
@@ -0,0 +1,193 @@
+// file: ProfilerTest.cpp
+// Verifies the frame profiler: zones nest within a frame, counters land in
+// the frame that closes, the ring keeps the newest FRAME_HISTORY frames, and
+// both exports carry every frame.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "src/Systems/Profiler.h"
+
+class ProfilerTest : public ::testing::Test
+{
+protected:
+	Profiler& profiler = Profiler::instance();
+
+	void SetUp() override
+	{
+		profiler.reset();
+		profiler.set_enabled(true);
+	}
+
+	void TearDown() override
+	{
+		profiler.reset();
+	}
+
+	void record_frame()
+	{
+		profiler.begin_frame();
+		{
+			const ProfileScope update("update");
+			const ProfileScope creatures("creatures");
+		}
+		{
+			const ProfileScope render("render");
+		}
+		profiler.count(ProfileCounter::PATH_NODES, 5);
+		profiler.end_frame();
+	}
+};
+
+TEST_F(ProfilerTest, RecordsNestedZones)
+{
+	record_frame();
+
+	ASSERT_EQ(profiler.frame_count(), 1u);
+	const ProfileFrame& frame = profiler.frame(0);
+	ASSERT_EQ(frame.zoneCount, 3u);
+	EXPECT_STREQ(frame.zones[0].name, "update");
+	EXPECT_EQ(frame.zones[0].depth, 0u);
+	EXPECT_STREQ(frame.zones[1].name, "creatures");
+	EXPECT_EQ(frame.zones[1].depth, 1u);
+	EXPECT_STREQ(frame.zones[2].name, "render");
+	EXPECT_EQ(frame.zones[2].depth, 0u);
+	EXPECT_GE(frame.zones[0].durationNs, frame.zones[1].durationNs);
+	EXPECT_GE(frame.durationNs, frame.zones[0].durationNs);
+	EXPECT_EQ(frame.counter(ProfileCounter::PATH_NODES), 5);
+}
+
+TEST_F(ProfilerTest, IgnoresZonesOutsideAFrameAndOnOtherThreads)
+{
+	{
+		const ProfileScope early("early");
+	}
+	profiler.begin_frame();
+	std::thread worker([this]
+	{
+		const ProfileScope zone("worker");
+		profiler.count(ProfileCounter::FOV_CELLS, 7); // counters are fine from any thread
+	});
+	worker.join();
+	profiler.end_frame();
+
+	ASSERT_EQ(profiler.frame_count(), 1u);
+	EXPECT_EQ(profiler.frame(0).zoneCount, 0u);
+	EXPECT_EQ(profiler.frame(0).counter(ProfileCounter::FOV_CELLS), 7);
+}
+
+TEST_F(ProfilerTest, RingKeepsNewestFrames)
+{
+	for (size_t i = 0; i < Profiler::FRAME_HISTORY + 10; ++i)
+	{
+		record_frame();
+	}
+
+	ASSERT_EQ(profiler.frame_count(), Profiler::FRAME_HISTORY);
+	EXPECT_EQ(profiler.frame(0).index, 10u);
+	EXPECT_EQ(profiler.frame(Profiler::FRAME_HISTORY - 1).index, Profiler::FRAME_HISTORY + 9);
+}
+
+TEST_F(ProfilerTest, CountsAllocations)
+{
+	profiler.begin_frame();
+	auto allocation = std::make_unique<int>(1);
+	profiler.end_frame();
+
+	if (PROFILER_ENABLED)
+	{
+		EXPECT_GE(profiler.frame(0).counter(ProfileCounter::ALLOCATIONS), 1);
+	}
+}
+
+TEST_F(ProfilerTest, TopZonesSortsByTotalTime)
+{
+	record_frame();
+	record_frame();
+
+	const std::vector<ZoneTotal> top = profiler.top_zones(2, Profiler::FRAME_HISTORY);
+	ASSERT_EQ(top.size(), 2u);
+	EXPECT_GE(top[0].totalNs, top[1].totalNs);
+	for (const ZoneTotal& zone : top)
+	{
+		EXPECT_EQ(zone.calls, 2);
+	}
+}
+
+TEST_F(ProfilerTest, ChromeTraceHasEveryFrameAndZone)
+{
+	record_frame();
+	record_frame();
+
+	std::ostringstream out;
+	profiler.write_chrome_trace(out);
+	const nlohmann::json trace = nlohmann::json::parse(out.str());
+
+	int frames = 0;
+	int zones = 0;
+	int counters = 0;
+	for (const auto& event : trace.at("traceEvents"))
+	{
+		if (event.at("ph") == "C")
+		{
+			++counters;
+			EXPECT_EQ(event.at("args").at("path nodes"), 5);
+		}
+		else if (event.at("name") == "frame")
+		{
+			++frames;
+		}
+		else
+		{
+			++zones;
+		}
+	}
+	EXPECT_EQ(frames, 2);
+	EXPECT_EQ(zones, 6);
+	EXPECT_EQ(counters, 2);
+}
+
+TEST_F(ProfilerTest, CsvHasOneRowPerFrameZoneAndCounter)
+{
+	record_frame();
+
+	std::ostringstream out;
+	profiler.write_csv(out);
+	std::istringstream in(out.str());
+	std::string line;
+	std::getline(in, line);
+	EXPECT_EQ(line, "frame,kind,name,depth,start_us,duration_us,value");
+
+	int rows = 0;
+	bool sawCounter = false;
+	while (std::getline(in, line))
+	{
+		++rows;
+		sawCounter = sawCounter || line.starts_with("0,counter,path nodes,");
+	}
+	// frame + 3 zones + path nodes (+ allocations when counted)
+	EXPECT_GE(rows, 5);
+	EXPECT_TRUE(sawCounter);
+}
+
+#if PROFILER_ENABLED
+TEST_F(ProfilerTest, MacrosRecordZones)
+{
+	{
+		PROFILE_FRAME();
+		PROFILE_ZONE("macro zone");
+		PROFILE_COUNT(ProfileCounter::DRAW_CALLS, 3);
+	}
+
+	ASSERT_EQ(profiler.frame_count(), 1u);
+	ASSERT_EQ(profiler.frame(0).zoneCount, 1u);
+	EXPECT_STREQ(profiler.frame(0).zones[0].name, "macro zone");
+	EXPECT_EQ(profiler.frame(0).counter(ProfileCounter::DRAW_CALLS), 3);
+}
+#endif
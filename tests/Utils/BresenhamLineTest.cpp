@@ -0,0 +1,78 @@
+// file: BresenhamLineTest.cpp
+// Verifies the lazy BresenhamLine range yields exactly the cells of the
+// reference vector-building implementation.
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+#include "../../src/Utils/BresenhamLine.h"
+#include "../../src/Utils/Vector2D.h"
+
+namespace
+{
+	// The original Map::bresenham_line body.
+	std::vector<Vector2D> reference_line(Vector2D from, Vector2D to)
+	{
+		std::vector<Vector2D> path;
+		int x0 = from.x;
+		int y0 = from.y;
+		const int dx = std::abs(to.x - x0);
+		const int dy = std::abs(to.y - y0);
+		const int sx = (x0 < to.x) ? 1 : -1;
+		const int sy = (y0 < to.y) ? 1 : -1;
+		int err = dx - dy;
+
+		while (x0 != to.x || y0 != to.y)
+		{
+			int e2 = 2 * err;
+			if (e2 > -dy)
+			{
+				err -= dy;
+				x0 += sx;
+			}
+			if (e2 < dx)
+			{
+				err += dx;
+				y0 += sy;
+			}
+			path.push_back(Vector2D{ x0, y0 });
+		}
+		return path;
+	}
+
+	std::vector<Vector2D> collect(Vector2D from, Vector2D to)
+	{
+		std::vector<Vector2D> cells;
+		for (Vector2D pos : BresenhamLine{ from, to })
+		{
+			cells.push_back(pos);
+		}
+		return cells;
+	}
+}
+
+TEST(BresenhamLineTest, SamePoint_IsEmpty)
+{
+	EXPECT_TRUE(collect(Vector2D{ 3, 3 }, Vector2D{ 3, 3 }).empty());
+}
+
+TEST(BresenhamLineTest, ExcludesStart_IncludesEnd)
+{
+	const auto cells = collect(Vector2D{ 0, 0 }, Vector2D{ 3, 0 });
+
+	EXPECT_EQ(cells, (std::vector<Vector2D>{ { 1, 0 }, { 2, 0 }, { 3, 0 } }));
+}
+
+TEST(BresenhamLineTest, MatchesReferenceOnRandomLines)
+{
+	std::mt19937 rng(99);
+	std::uniform_int_distribution<int> coord(-30, 30);
+
+	for (int i = 0; i < 2000; ++i)
+	{
+		const Vector2D from{ coord(rng), coord(rng) };
+		const Vector2D to{ coord(rng), coord(rng) };
+		ASSERT_EQ(collect(from, to), reference_line(from, to));
+	}
+}
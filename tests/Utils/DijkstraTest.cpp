@@ -0,0 +1,405 @@
+// file: DijkstraTest.cpp
+// Verifies the reusable A* engine: optimal integer-cost paths, goal rules,
+// unreachable goals, and scratch reuse across many searches.
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <functional>
+#include <gtest/gtest.h>
+#include <memory>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../../src/Actor/Creature.h"
+#include "../../src/Combat/HealthPool.h"
+#include "../../src/Core/GameContext.h"
+#include "../../src/Map/Map.h"
+#include "../../src/Utils/BucketQueue.h"
+#include "../../src/Utils/Dijkstra.h"
+#include "../../src/Utils/Vector2D.h"
+
+namespace
+{
+	constexpr int TEST_MAP_WIDTH = 24;
+	constexpr int TEST_MAP_HEIGHT = 16;
+
+	int step_cost(const Map& map, Vector2D from, Vector2D to)
+	{
+		const bool diagonal = from.x != to.x && from.y != to.y;
+		const int tileCost = static_cast<int>(map.get_cost(to));
+		return tileCost * (diagonal ? Dijkstra::DIAGONAL_STEP_COST : Dijkstra::STEP_COST);
+	}
+
+	int path_cost(const Map& map, const std::vector<Vector2D>& path)
+	{
+		int total = 0;
+		for (size_t i = 1; i < path.size(); ++i)
+		{
+			total += step_cost(map, path[i - 1], path[i]);
+		}
+		return total;
+	}
+
+	// Textbook binary-heap Dijkstra over the same cost model; INT_MAX if unreachable.
+	int reference_cost(const Map& map, Vector2D start, Vector2D goal)
+	{
+		std::vector<int> best(TEST_MAP_WIDTH * TEST_MAP_HEIGHT, INT_MAX);
+		using Entry = std::pair<int, int>;
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+		best[start.y * TEST_MAP_WIDTH + start.x] = 0;
+		open.emplace(0, start.y * TEST_MAP_WIDTH + start.x);
+		while (!open.empty())
+		{
+			const auto [cost, index] = open.top();
+			open.pop();
+			if (cost != best[index])
+			{
+				continue;
+			}
+			const Vector2D current{ index % TEST_MAP_WIDTH, index / TEST_MAP_WIDTH };
+			for (int dy = -1; dy <= 1; ++dy)
+			{
+				for (int dx = -1; dx <= 1; ++dx)
+				{
+					const Vector2D next{ current.x + dx, current.y + dy };
+					if ((dx == 0 && dy == 0) || !map.get_tile_grid().in_bounds(next) || map.is_wall(next))
+					{
+						continue;
+					}
+					const int nextIndex = next.y * TEST_MAP_WIDTH + next.x;
+					const int nextCost = cost + step_cost(map, current, next);
+					if (nextCost < best[nextIndex])
+					{
+						best[nextIndex] = nextCost;
+						open.emplace(nextCost, nextIndex);
+					}
+				}
+			}
+		}
+		return best[goal.y * TEST_MAP_WIDTH + goal.x];
+	}
+
+	bool is_connected_walk(const std::vector<Vector2D>& path)
+	{
+		for (size_t i = 1; i < path.size(); ++i)
+		{
+			if (std::abs(path[i].x - path[i - 1].x) > 1 || std::abs(path[i].y - path[i - 1].y) > 1)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+class DijkstraTest : public ::testing::Test
+{
+protected:
+	Map map{ TEST_MAP_WIDTH, TEST_MAP_HEIGHT };
+	Dijkstra pathfinder{ TEST_MAP_WIDTH, TEST_MAP_HEIGHT };
+	std::vector<std::unique_ptr<Creature>> creatures;
+	GameContext ctx;
+	std::vector<Vector2D> path;
+
+	void SetUp() override
+	{
+		ctx.creatures = &creatures;
+		ctx.map = &map;
+		map.init_tiles();
+	}
+
+	void carve(int x1, int y1, int x2, int y2)
+	{
+		for (int y = y1; y <= y2; ++y)
+		{
+			for (int x = x1; x <= x2; ++x)
+			{
+				map.set_tile(Vector2D{ x, y }, TileType::FLOOR, 1);
+			}
+		}
+	}
+};
+
+TEST_F(DijkstraTest, OpenRoom_PathIsChebyshevLength)
+{
+	carve(1, 1, 20, 12);
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 2, 2 }, Vector2D{ 15, 6 }, PathAlgorithm::ASTAR, ctx, path));
+
+	EXPECT_EQ(path.front(), (Vector2D{ 2, 2 }));
+	EXPECT_EQ(path.back(), (Vector2D{ 15, 6 }));
+	EXPECT_EQ(path.size(), 14u); // 13 steps, start included
+	EXPECT_TRUE(is_connected_walk(path));
+}
+
+TEST_F(DijkstraTest, StartEqualsGoal_ReturnsSingleCell)
+{
+	carve(1, 1, 5, 5);
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 3, 3 }, Vector2D{ 3, 3 }, PathAlgorithm::ASTAR, ctx, path));
+
+	ASSERT_EQ(path.size(), 1u);
+	EXPECT_EQ(path.front(), (Vector2D{ 3, 3 }));
+}
+
+TEST_F(DijkstraTest, WallSplit_PathGoesThroughGap)
+{
+	carve(1, 1, 20, 12);
+	for (int y = 1; y <= 12; ++y)
+	{
+		if (y != 11)
+		{
+			map.set_tile(Vector2D{ 10, y }, TileType::WALL, 0);
+		}
+	}
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 3, 2 }, Vector2D{ 17, 2 }, PathAlgorithm::ASTAR, ctx, path));
+
+	EXPECT_TRUE(is_connected_walk(path));
+	bool usedGap = false;
+	for (Vector2D pos : path)
+	{
+		EXPECT_FALSE(map.is_wall(pos));
+		usedGap = usedGap || pos == Vector2D{ 10, 11 };
+	}
+	EXPECT_TRUE(usedGap);
+}
+
+TEST_F(DijkstraTest, Unreachable_ReturnsFalseAndEmptiesBuffer)
+{
+	carve(1, 1, 5, 5);
+	carve(10, 1, 14, 5);
+	path.assign(3, Vector2D{ 9, 9 });
+
+	EXPECT_FALSE(pathfinder.find_path(map, Vector2D{ 2, 2 }, Vector2D{ 12, 2 }, PathAlgorithm::ASTAR, ctx, path));
+	EXPECT_TRUE(path.empty());
+	EXPECT_TRUE(pathfinder.a_star_search(map, Vector2D{ 2, 2 }, Vector2D{ 12, 2 }, true, ctx).empty());
+}
+
+TEST_F(DijkstraTest, OccupiedGoal_IsReachableButOthersBlock)
+{
+	carve(1, 1, 12, 1);
+	auto goblin = std::make_unique<Creature>(Vector2D{ 8, 1 }, ActorData{ TileRef{}, "goblin", 1 });
+	goblin->healthPool = std::make_unique<HealthPool>(5);
+	creatures.push_back(std::move(goblin));
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 2, 1 }, Vector2D{ 8, 1 }, PathAlgorithm::ASTAR, ctx, path));
+	EXPECT_EQ(path.back(), (Vector2D{ 8, 1 }));
+
+	// The goblin fills the only corridor, so anything past it is cut off.
+	EXPECT_FALSE(pathfinder.find_path(map, Vector2D{ 2, 1 }, Vector2D{ 11, 1 }, PathAlgorithm::ASTAR, ctx, path));
+}
+
+TEST_F(DijkstraTest, ClosedDoorGoal_IsReachable)
+{
+	carve(1, 1, 6, 1);
+	map.set_tile(Vector2D{ 7, 1 }, TileType::CLOSED_DOOR, 2);
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 1, 1 }, Vector2D{ 7, 1 }, PathAlgorithm::ASTAR, ctx, path));
+	EXPECT_EQ(path.back(), (Vector2D{ 7, 1 }));
+}
+
+TEST_F(DijkstraTest, Water_IsDetouredWhenCheaper)
+{
+	carve(1, 1, 20, 6);
+	for (int y = 1; y <= 5; ++y)
+	{
+		map.set_tile(Vector2D{ 10, y }, TileType::WATER, 10);
+	}
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 5, 2 }, Vector2D{ 15, 2 }, PathAlgorithm::ASTAR, ctx, path));
+
+	for (Vector2D pos : path)
+	{
+		EXPECT_NE(map.get_tile_type(pos), TileType::WATER);
+	}
+	EXPECT_EQ(path_cost(map, path), reference_cost(map, Vector2D{ 5, 2 }, Vector2D{ 15, 2 }));
+}
+
+TEST_F(DijkstraTest, RandomMaps_MatchReferenceCostAcrossReuse)
+{
+	std::mt19937 rng(99);
+	std::uniform_int_distribution<int> xDist(1, TEST_MAP_WIDTH - 2);
+	std::uniform_int_distribution<int> yDist(1, TEST_MAP_HEIGHT - 2);
+	std::uniform_int_distribution<int> roll(0, 99);
+
+	for (int trial = 0; trial < 40; ++trial)
+	{
+		map.init_tiles();
+		for (int y = 1; y < TEST_MAP_HEIGHT - 1; ++y)
+		{
+			for (int x = 1; x < TEST_MAP_WIDTH - 1; ++x)
+			{
+				const int r = roll(rng);
+				if (r >= 75)
+				{
+					continue; // wall
+				}
+				r < 10 ? map.set_tile(Vector2D{ x, y }, TileType::WATER, 10)
+					   : map.set_tile(Vector2D{ x, y }, TileType::FLOOR, 1);
+			}
+		}
+		const Vector2D start{ xDist(rng), yDist(rng) };
+		const Vector2D goal{ xDist(rng), yDist(rng) };
+		map.set_tile(start, TileType::FLOOR, 1);
+		map.set_tile(goal, TileType::FLOOR, 1);
+
+		const int expected = reference_cost(map, start, goal);
+		for (PathAlgorithm algorithm : { PathAlgorithm::DIJKSTRA, PathAlgorithm::ASTAR, PathAlgorithm::JUMP_POINT })
+		{
+			const bool found = pathfinder.find_path(map, start, goal, algorithm, ctx, path);
+			ASSERT_EQ(found, expected != INT_MAX) << "trial " << trial;
+			if (found)
+			{
+				EXPECT_EQ(path.front(), start);
+				EXPECT_EQ(path.back(), goal);
+				EXPECT_TRUE(is_connected_walk(path));
+				EXPECT_EQ(path_cost(map, path), expected) << "trial " << trial << " algorithm " << static_cast<int>(algorithm);
+			}
+		}
+	}
+}
+
+TEST_F(DijkstraTest, JumpPoint_OpenRoomExpandsFarFewerNodes)
+{
+	carve(1, 1, 22, 14);
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 1, 2 }, Vector2D{ 22, 13 }, PathAlgorithm::ASTAR, ctx, path));
+	const int astarCost = path_cost(map, path);
+	const int astarExpanded = pathfinder.get_expanded_count();
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 1, 2 }, Vector2D{ 22, 13 }, PathAlgorithm::JUMP_POINT, ctx, path));
+
+	EXPECT_EQ(path_cost(map, path), astarCost);
+	EXPECT_TRUE(is_connected_walk(path));
+	EXPECT_LT(pathfinder.get_expanded_count() * 4, astarExpanded);
+}
+
+TEST_F(DijkstraTest, JumpPoint_RespectsCreaturesAndClosedDoors)
+{
+	carve(1, 1, 22, 14);
+	for (int y = 1; y <= 14; ++y)
+	{
+		map.set_tile(Vector2D{ 11, y }, TileType::WALL, 0);
+	}
+	map.set_tile(Vector2D{ 11, 3 }, TileType::CLOSED_DOOR, 2);
+	map.set_tile(Vector2D{ 11, 8 }, TileType::FLOOR, 1);
+	map.set_tile(Vector2D{ 11, 12 }, TileType::FLOOR, 1);
+	const auto spawn_goblin = [this](Vector2D pos)
+	{
+		auto goblin = std::make_unique<Creature>(pos, ActorData{ TileRef{}, "goblin", 1 });
+		goblin->healthPool = std::make_unique<HealthPool>(5);
+		creatures.push_back(std::move(goblin));
+	};
+	// Goblins plug the east side of the lower gap.
+	for (int y = 11; y <= 13; ++y)
+	{
+		spawn_goblin(Vector2D{ 12, y });
+	}
+
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 3, 13 }, Vector2D{ 20, 13 }, PathAlgorithm::ASTAR, ctx, path));
+	const int astarCost = path_cost(map, path);
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 3, 13 }, Vector2D{ 20, 13 }, PathAlgorithm::JUMP_POINT, ctx, path));
+
+	EXPECT_EQ(path_cost(map, path), astarCost);
+	EXPECT_TRUE(is_connected_walk(path));
+	bool usedUpperGap = false;
+	for (Vector2D pos : path)
+	{
+		EXPECT_NE(pos, (Vector2D{ 11, 3 })); // closed door
+		EXPECT_NE(pos, (Vector2D{ 11, 12 })); // plugged gap
+		usedUpperGap = usedUpperGap || pos == Vector2D{ 11, 8 };
+	}
+	EXPECT_TRUE(usedUpperGap);
+
+	// A goblin standing in the upper gap cuts the east side off entirely.
+	spawn_goblin(Vector2D{ 11, 8 });
+	EXPECT_FALSE(pathfinder.find_path(map, Vector2D{ 3, 13 }, Vector2D{ 20, 13 }, PathAlgorithm::JUMP_POINT, ctx, path));
+
+	// The snapshot cached on the map keeps up: the goblins' cells reopen once
+	// they leave, and walling the upper gap is seen by the next search.
+	creatures.clear();
+	map.set_tile(Vector2D{ 11, 8 }, TileType::WALL, 0);
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 3, 13 }, Vector2D{ 20, 13 }, PathAlgorithm::ASTAR, ctx, path));
+	const int reroutedCost = path_cost(map, path);
+	ASSERT_TRUE(pathfinder.find_path(map, Vector2D{ 3, 13 }, Vector2D{ 20, 13 }, PathAlgorithm::JUMP_POINT, ctx, path));
+	EXPECT_EQ(path_cost(map, path), reroutedCost);
+	EXPECT_TRUE(std::ranges::find(path, Vector2D{ 11, 12 }) != path.end());
+}
+
+TEST_F(DijkstraTest, JumpPoint_SparseMapsMatchAStarCost)
+{
+	std::mt19937 rng(7);
+	std::uniform_int_distribution<int> xDist(1, TEST_MAP_WIDTH - 2);
+	std::uniform_int_distribution<int> yDist(1, TEST_MAP_HEIGHT - 2);
+	std::uniform_int_distribution<int> roll(0, 99);
+
+	for (int trial = 0; trial < 60; ++trial)
+	{
+		map.init_tiles();
+		creatures.clear();
+		carve(1, 1, TEST_MAP_WIDTH - 2, TEST_MAP_HEIGHT - 2);
+		for (int i = 0; i < 30; ++i)
+		{
+			const Vector2D pos{ xDist(rng), yDist(rng) };
+			const int r = roll(rng);
+			if (r < 50)
+			{
+				map.set_tile(pos, TileType::WALL, 0);
+			}
+			else if (r < 70)
+			{
+				map.set_tile(pos, TileType::WATER, 10);
+			}
+			else
+			{
+				auto goblin = std::make_unique<Creature>(pos, ActorData{ TileRef{}, "goblin", 1 });
+				goblin->healthPool = std::make_unique<HealthPool>(5);
+				creatures.push_back(std::move(goblin));
+			}
+		}
+		const Vector2D start{ xDist(rng), yDist(rng) };
+		const Vector2D goal{ xDist(rng), yDist(rng) };
+		map.set_tile(start, TileType::FLOOR, 1);
+		map.set_tile(goal, TileType::FLOOR, 1);
+
+		const bool astarFound = pathfinder.find_path(map, start, goal, PathAlgorithm::ASTAR, ctx, path);
+		const int astarCost = path_cost(map, path);
+		const bool jumpFound = pathfinder.find_path(map, start, goal, PathAlgorithm::JUMP_POINT, ctx, path);
+
+		ASSERT_EQ(jumpFound, astarFound) << "trial " << trial;
+		if (jumpFound)
+		{
+			EXPECT_TRUE(is_connected_walk(path));
+			EXPECT_EQ(path_cost(map, path), astarCost) << "trial " << trial;
+		}
+	}
+}
+
+TEST(BucketQueueTest, PopsInPriorityOrderAcrossRingWrap)
+{
+	BucketQueue queue{ 64 };
+	int priority = 0;
+	for (int round = 0; round < 10; ++round)
+	{
+		queue.push(1, priority + 40);
+		queue.push(2, priority + 5);
+		queue.push(3, priority + 63);
+
+		EXPECT_EQ(queue.pop(), 2);
+		EXPECT_EQ(queue.cursor(), priority + 5);
+		EXPECT_EQ(queue.pop(), 1);
+		EXPECT_EQ(queue.pop(), 3);
+		priority = queue.cursor();
+		EXPECT_TRUE(queue.empty());
+	}
+
+	queue.push(7, priority + 1);
+	queue.clear();
+	EXPECT_TRUE(queue.empty());
+	queue.push(8, 3);
+	EXPECT_EQ(queue.pop(), 8);
+}
@@ -0,0 +1,116 @@
+// file: LogRingTest.cpp
+// Verifies the log ring behind Logger: FIFO order, refusing pushes when
+// full, and no lost or duplicated lines with several producers.
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../src/Systems/Logger.h"
+#include "../../src/Utils/LogRing.h"
+
+TEST(LogRingTest, CapacityRoundsUpToPowerOfTwo)
+{
+    LogRing<int> ring{ 5 };
+    EXPECT_EQ(ring.capacity(), 8u);
+}
+
+TEST(LogRingTest, PopsInPushOrder)
+{
+    LogRing<int> ring{ 8 };
+    for (int i = 0; i < 5; ++i)
+    {
+        std::string text = "line " + std::to_string(i);
+        ASSERT_TRUE(ring.try_push(i, text));
+        EXPECT_TRUE(text.empty());
+    }
+
+    int level = -1;
+    std::string text;
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(ring.try_pop(level, text));
+        EXPECT_EQ(level, i);
+        EXPECT_EQ(text, "line " + std::to_string(i));
+    }
+    EXPECT_FALSE(ring.try_pop(level, text));
+}
+
+TEST(LogRingTest, FullRingRefusesPushAndKeepsText)
+{
+    LogRing<int> ring{ 4 };
+    for (int i = 0; i < 4; ++i)
+    {
+        std::string text = "x";
+        ASSERT_TRUE(ring.try_push(i, text));
+    }
+
+    std::string overflow = "dropped";
+    EXPECT_FALSE(ring.try_push(9, overflow));
+    EXPECT_EQ(overflow, "dropped");
+
+    int level = -1;
+    std::string text;
+    ASSERT_TRUE(ring.try_pop(level, text));
+    EXPECT_TRUE(ring.try_push(4, overflow)); // a freed slot is usable again
+}
+
+TEST(LogRingTest, ConcurrentProducersLoseNothing)
+{
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 2000;
+    LogRing<int> ring{ 64 };
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&ring, p] {
+            for (int i = 0; i < PER_PRODUCER; ++i)
+            {
+                std::string text = std::to_string(p * PER_PRODUCER + i);
+                while (!ring.try_push(p, text))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::set<int> seen;
+    int level = -1;
+    std::string text;
+    while (seen.size() < static_cast<size_t>(PRODUCERS * PER_PRODUCER))
+    {
+        if (ring.try_pop(level, text))
+        {
+            EXPECT_TRUE(seen.insert(std::stoi(text)).second) << "duplicate " << text;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (std::thread& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_FALSE(ring.try_pop(level, text));
+}
+
+TEST(LogRingTest, LoggerLevelFiltersAtRuntime)
+{
+    Logger& logger = Logger::instance();
+    const LogLevel saved = logger.get_level();
+
+    logger.set_level(LogLevel::LOG_WARN);
+    EXPECT_FALSE(logger.is_enabled(LogLevel::LOG_DEBUG));
+    EXPECT_TRUE(logger.is_enabled(LogLevel::LOG_ERROR));
+
+    logger.set_level(LogLevel::LOG_OFF);
+    EXPECT_FALSE(logger.is_enabled(LogLevel::LOG_ERROR));
+
+    logger.set_level(saved);
+}